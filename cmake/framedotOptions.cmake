@@ -10,6 +10,12 @@ set(CMAKE_POSITION_INDEPENDENT_CODE ON)
 set(FRAMEDOT_MAX_INPUT_EVENTS "256" CACHE STRING "프레임당 입력 이벤트 최대 개수(InputQueue 용량)")
 set(FRAMEDOT_INPUT_OVERFLOW_POLICY "1" CACHE STRING "입력 큐 오버플로 정책: 0=DropNewest, 1=DropOldest, 2=CoalesceMouseMove(예약)")
 
+# RenderQueue 기본 용량 (RenderQueueConfig로 런타임 변경 가능)
+set(FRAMEDOT_RENDER_QUEUE_MAX_COMMANDS "8192" CACHE STRING "RenderQueue 프레임당 최대 커맨드 수 (paged 모드에서는 상한)")
+set(FRAMEDOT_RENDER_QUEUE_TEXT_BYTES "16384" CACHE STRING "RenderQueue 프레임당 text arena 바이트")
+set(FRAMEDOT_RENDER_QUEUE_PAGE_COMMANDS "4096" CACHE STRING "RenderQueue paged 모드의 페이지당 커맨드 수 (2의 거듭제곱으로 올림)")
+set(FRAMEDOT_RENDER_QUEUE_INSTANCES "16384" CACHE STRING "RenderQueue 프레임당 instance arena 항목 수 (alloc_instances)")
+
 # SMP / JobSystem
 set(FRAMEDOT_ENABLE_SMP "ON" CACHE BOOL "Enable SMP job system")
 set(FRAMEDOT_MAX_WORKER_THREADS "8" CACHE STRING "Maximum worker threads (upper bound)")
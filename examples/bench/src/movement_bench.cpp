@@ -0,0 +1,113 @@
+// examples/bench/src/movement_bench.cpp
+// Movement2D: 1M 엔티티 적분 시간 (시스템 전체 + 커널 단독, 스칼라 대비, 단순 view 루프 대비)
+#include <framedot/ecs/Fecs.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+constexpr std::size_t kEntities = 1'000'000;
+constexpr int kFrames = 60;
+
+template <class F>
+double time_ms(F&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    fn();
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+void bench_kernel() {
+    std::vector<float> px(kEntities, 0.0f), py(kEntities, 0.0f);
+    std::vector<float> vx(kEntities, 1.0f), vy(kEntities, -1.0f);
+    std::vector<float> ax(kEntities, 0.5f), ay(kEntities, 0.25f);
+    std::vector<float> damp(kEntities, 0.999f);
+
+    ecs::systems::MovementSoA2D soa{};
+    soa.px = px.data(); soa.py = py.data();
+    soa.vx = vx.data(); soa.vy = vy.data();
+    soa.ax = ax.data(); soa.ay = ay.data();
+    soa.damp = damp.data();
+    soa.count = kEntities;
+
+    const float dt = 1.0f / 60.0f;
+    const double scalar = time_ms([&] { for (int i = 0; i < kFrames; ++i) ecs::systems::integrate_soa_2d_scalar(soa, dt); });
+    const double simd   = time_ms([&] { for (int i = 0; i < kFrames; ++i) ecs::systems::integrate_soa_2d(soa, dt); });
+
+    std::cout << "[kernel] scalar " << scalar / kFrames << " ms/frame, "
+              << ecs::systems::movement_2d_kernel_name() << " " << simd / kFrames << " ms/frame\n";
+}
+
+void populate(fecs::Registry& reg) {
+    for (std::size_t i = 0; i < kEntities; ++i) {
+        const auto e = reg.create();
+        reg.emplace<fecs::Transform2D>(e);
+        reg.emplace<fecs::Velocity2D>(e, math::Vec2f{1.0f, 0.5f});
+        if ((i & 3u) == 0u) reg.emplace<fecs::Acceleration2D>(e, math::Vec2f{0.0f, 9.8f});
+        if ((i & 7u) == 0u) reg.emplace<fecs::Damping2D>(e, 0.1f);
+    }
+}
+
+void bench_system(std::uint32_t workers) {
+    core::JobSystem* jobs = core::internal::create_default_jobsystem(workers);
+
+    fecs::World world;
+    fecs::systems::install_movement_2d(world);
+    populate(world.registry());
+
+    core::FrameContext ctx{};
+    ctx.jobs = jobs;
+    ctx.dt_seconds = 1.0 / 60.0;
+
+    world.tick(ctx); // warm-up
+    const double ms = time_ms([&] {
+        for (int i = 0; i < kFrames; ++i) {
+            ctx.frame_index = (std::uint64_t)i;
+            world.tick(ctx);
+        }
+    });
+
+    std::cout << "[system] entities=" << kEntities << " workers=" << jobs->worker_count()
+              << " " << ms / kFrames << " ms/frame\n";
+
+    core::internal::destroy_default_jobsystem(jobs);
+}
+
+/// @brief 기준선: 엔티티마다 view + try_get으로 적분하는 단순 스칼라 루프 (단일 스레드)
+void bench_view_loop() {
+    fecs::Registry reg;
+    populate(reg);
+
+    const float dt = 1.0f / 60.0f;
+    auto step = [&] {
+        for (auto [e, t, v] : reg.view<fecs::Transform2D, fecs::Velocity2D>().each()) {
+            const auto* a = reg.try_get<fecs::Acceleration2D>(e);
+            const auto* d = reg.try_get<fecs::Damping2D>(e);
+            const float damp = d ? 1.0f / (1.0f + d->damping * dt) : 1.0f;
+            v.v.x = (v.v.x + (a ? a->a.x : 0.0f) * dt) * damp;
+            v.v.y = (v.v.y + (a ? a->a.y : 0.0f) * dt) * damp;
+            t.position.x = t.position.x + v.v.x * dt;
+            t.position.y = t.position.y + v.v.y * dt;
+        }
+    };
+
+    step(); // warm-up
+    const double ms = time_ms([&] { for (int i = 0; i < kFrames; ++i) step(); });
+    std::cout << "[view]   entities=" << kEntities << " " << ms / kFrames << " ms/frame\n";
+}
+
+} // namespace
+
+int main() {
+    bench_kernel();
+    bench_view_loop();
+    bench_system(1);
+    bench_system(0);
+    return 0;
+}
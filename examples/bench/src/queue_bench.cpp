@@ -0,0 +1,72 @@
+// examples/bench/src/queue_bench.cpp
+// RenderQueue push 처리량(Mcmd/s): 공유 atomic 경로 vs 워커 세그먼트, 워커 수별 비교
+#include <framedot/core/Tasks.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+using namespace framedot;
+
+namespace {
+
+constexpr std::size_t kPerWorker = 200000;
+constexpr int kReps = 10;
+
+double run(core::JobSystem* js, std::uint32_t workers, bool segments) {
+    gfx::RenderQueueConfig cfg{};
+    cfg.max_commands = kPerWorker * workers;
+    cfg.worker_segments = segments;
+    gfx::RenderQueue rq(cfg);
+
+    double best = 1e30;
+    for (int r = 0; r < kReps; ++r) {
+        rq.begin_frame();
+
+        const auto t0 = std::chrono::steady_clock::now();
+        {
+            core::TaskGroup tg(js, core::JobLane::Engine);
+            for (std::uint32_t w = 0; w < workers; ++w) {
+                tg.run([&rq, w]() noexcept {
+                    for (std::size_t i = 0; i < kPerWorker; ++i) {
+                        rq.fill_rect((int)i, (int)w, 4, 4, gfx::ColorRGBA8{255, 0, 0, 255}, (std::uint32_t)i);
+                    }
+                });
+            }
+            tg.wait();
+        }
+        rq.end_frame();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        if (rq.size() != cfg.max_commands) {
+            std::cout << "unexpected size " << rq.size() << "\n";
+            return 0.0;
+        }
+        const double s = std::chrono::duration<double>(t1 - t0).count();
+        if (s < best) best = s;
+    }
+    return (double)cfg.max_commands / best / 1e6;
+}
+
+} // namespace
+
+int main() {
+    const std::uint32_t hw = std::thread::hardware_concurrency();
+    const std::uint32_t max_workers = (hw > 1) ? hw - 1 : 1;
+
+    for (std::uint32_t w = 1; w <= max_workers; w *= 2) {
+        core::JobSystem* js = core::internal::create_default_jobsystem(w);
+        const std::uint32_t n = js->worker_count();   // Config 상한으로 줄어들 수 있음
+
+        std::cout << "workers=" << n
+                  << " shared " << run(js, n, false) << " Mcmd/s"
+                  << " | segments " << run(js, n, true) << " Mcmd/s\n";
+
+        core::internal::destroy_default_jobsystem(js);
+        if (n < w) break;
+    }
+    return 0;
+}
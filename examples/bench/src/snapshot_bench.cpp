@@ -0,0 +1,113 @@
+// examples/bench/src/snapshot_bench.cpp
+// Snapshot: 100k 엔티티 full 스냅샷 쓰기/복원, delta 인코딩/재구성, RollbackBuffer capture/restore 시간
+#include <framedot/ecs/Fecs.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+constexpr std::size_t kEntities = 100'000;
+constexpr int kIters = 50;
+
+template <class F>
+double time_ms(F&& fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    fn();
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+void populate(fecs::Registry& reg) {
+    for (std::size_t i = 0; i < kEntities; ++i) {
+        const auto e = reg.create();
+        fecs::Transform2D t{};
+        t.position = math::Vec2f{(float)(i % 1000), (float)(i / 1000)};
+        reg.emplace<fecs::Transform2D>(e, t);
+        reg.emplace<fecs::Velocity2D>(e, math::Vec2f{1.0f, 0.5f});
+        reg.emplace<fecs::WorldTransform2D>(e);
+        if ((i & 1u) == 0u) reg.emplace<fecs::Rect2D>(e);
+        if ((i & 3u) == 0u) reg.emplace<fecs::RenderOrder2D>(e, (std::uint32_t)i);
+    }
+}
+
+/// @brief 매 반복 1%의 Transform2D만 바꾼다 (delta/COW가 보는 전형적인 변화량)
+void touch(fecs::Registry& reg, int iter) {
+    auto& tr = reg.storage<fecs::Transform2D>();
+    const entt::entity* ents = tr.data();
+    for (std::size_t i = (std::size_t)iter % 100; i < tr.size(); i += 100) {
+        tr.get(ents[i]).position.x += 1.0f;
+    }
+}
+
+void bench_snapshot() {
+    fecs::Registry reg;
+    populate(reg);
+
+    std::vector<std::byte> base, cur, delta, rebuilt;
+    fecs::write_snapshot(reg, base, 0, fecs::BasicSnapshot2D{});
+
+    const double write_ms = time_ms([&] {
+        for (int i = 0; i < kIters; ++i) fecs::write_snapshot(reg, cur, (std::uint64_t)i, fecs::BasicSnapshot2D{});
+    });
+
+    fecs::SnapshotView view;
+    fecs::SnapshotView::parse(cur, view);
+    fecs::Registry out;
+    const double restore_ms = time_ms([&] {
+        for (int i = 0; i < kIters; ++i) fecs::restore_snapshot(out, view, fecs::BasicSnapshot2D{});
+    });
+
+    touch(reg, 0);
+    fecs::write_snapshot(reg, cur, 1, fecs::BasicSnapshot2D{});
+    fecs::SnapshotView vb, vc, vd;
+    fecs::SnapshotView::parse(base, vb);
+    fecs::SnapshotView::parse(cur, vc);
+    const double delta_ms = time_ms([&] {
+        for (int i = 0; i < kIters; ++i) fecs::write_snapshot_delta(vb, vc, delta);
+    });
+    fecs::SnapshotView::parse(delta, vd);
+    const double apply_ms = time_ms([&] {
+        for (int i = 0; i < kIters; ++i) fecs::apply_snapshot_delta(vb, vd, rebuilt);
+    });
+
+    std::cout << "[snapshot] entities=" << kEntities << " bytes=" << cur.size() << " delta=" << delta.size() << "\n"
+              << "  write   " << write_ms / kIters << " ms\n"
+              << "  restore " << restore_ms / kIters << " ms\n"
+              << "  delta   " << delta_ms / kIters << " ms\n"
+              << "  apply   " << apply_ms / kIters << " ms\n";
+}
+
+void bench_rollback() {
+    fecs::Registry reg;
+    populate(reg);
+    fecs::RollbackBuffer rb(reg, 8);
+
+    const double capture_ms = time_ms([&] {
+        for (int i = 0; i < kIters; ++i) {
+            touch(reg, i);
+            rb.capture((std::uint64_t)i);
+        }
+    });
+
+    const std::uint64_t last = (std::uint64_t)kIters - 1;
+    const double restore_ms = time_ms([&] {
+        for (int i = 0; i < kIters; ++i) rb.restore(last - (std::uint64_t)(i % 8));
+    });
+
+    std::cout << "[rollback] frames=8 resident=" << rb.resident_bytes() << "\n"
+              << "  capture " << capture_ms / kIters << " ms\n"
+              << "  restore " << restore_ms / kIters << " ms\n";
+}
+
+} // namespace
+
+int main() {
+    bench_snapshot();
+    bench_rollback();
+    return 0;
+}
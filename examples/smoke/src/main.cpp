@@ -12,6 +12,7 @@ using namespace framedot;
 namespace {
 class NullSurface final : public rhi::Surface {
 public:
+    using rhi::Surface::present;   // damage 버전은 기본 구현(전체 present)
     void present(const gfx::PixelFrame&) override {}
 };
 
@@ -11,11 +11,15 @@
 
 #include <framedot/gfx/PixelCanvas.hpp>
 #include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/gfx/TextureCache.hpp>
 #include <framedot/rhi/Surface.hpp>
 #include <framedot/input/InputSource.hpp>
 #include <framedot/core/FrameContext.hpp>
 
 
+namespace framedot::ecs { class RollbackBuffer; }
+
 namespace framedot::app {
 
     class Client {
@@ -32,6 +36,23 @@ namespace framedot::app {
         /// @brief RenderPrep: 그릴 것을 RenderQueue에 기록한다. (픽셀 write 금지)
         virtual void render_prep(const framedot::core::FrameContext& ctx,
                                  framedot::gfx::RenderQueue& rq) = 0;
+
+        /// @brief 래스터 계측 훅 (RunLoopConfig::render_profile일 때 매 프레임 present 전, 기본 no-op).
+        ///        renderer.stats()/profile()/tile_ns()를 로그 등으로 내보낸다
+        virtual void on_render_profile(const framedot::core::FrameContext& /*ctx*/,
+                                       const framedot::gfx::SoftwareRenderer& /*renderer*/) {}
+
+        // ----------------------------
+        // 롤백 (fixed_timestep 전용)
+        // ----------------------------
+
+        /// @brief 프레임 상태 링 버퍼. nullptr이 아니면 RunLoop가 매 tick 시작 상태를 capture한다.
+        virtual framedot::ecs::RollbackBuffer* rollback() { return nullptr; }
+
+        /// @brief 늦게 도착한 입력 등으로 되감아야 할 프레임 질의. on_input 이후, update 전에 호출
+        /// @return true면 frame부터 현재 tick 직전까지 재시뮬레이션한다.
+        ///         재시뮬레이션 update는 ctx.resimulating=true로 호출되며, 입력은 클라이언트 기록을 사용할 것.
+        virtual bool rollback_target(const framedot::core::FrameContext& /*ctx*/, std::uint64_t& /*frame*/) { return false; }
     };
 
     struct RunLoopConfig {
@@ -43,6 +64,22 @@ namespace framedot::app {
 
         /// @brief 워커 스레드 수(0=자동). SMP 비활성/플랫폼 제약이면 내부에서 0으로 축소될 수 있음.
         std::uint32_t worker_threads = 0;
+
+        /// @brief 프레임 RenderQueue 용량 (기본값은 CMake 캐시 변수)
+        framedot::gfx::RenderQueueConfig render_queue{};
+
+        /// @brief 바뀌지 않은 타일은 다시 그리지 않는다 (SoftwareRenderer::set_dirty_tracking).
+        ///        canvas는 RunLoop 밖에서 수정하지 않아야 한다. present에는 항상 damage 사각형이 전달된다
+        bool dirty_tiles = false;
+
+        /// @brief 래스터 계측 (SoftwareRenderer::set_profiling). 결과는 Client::on_render_profile로 전달된다
+        bool render_profile = false;
+
+        /// @brief 타일 시간 heatmap을 캔버스에 덮어 그린다 (render_profile일 때만)
+        bool render_heatmap = false;
+
+        /// @brief FrameContext::textures로 전달할 텍스처 저장소 (선택)
+        const framedot::gfx::TextureCache* textures = nullptr;
     };
 
     int run(Client& client,
@@ -0,0 +1,25 @@
+// include/framedot/core/CpuFeatures.hpp
+/**
+ * @file CpuFeatures.hpp
+ * @brief 런타임 CPU 기능 감지(cpuid). SIMD 커널 디스패치의 단일 기준.
+ *
+ * - 첫 호출 시 한 번 감지하고 이후에는 캐시된 값을 돌려준다(스레드 안전).
+ * - x86 이외 아키텍처에서는 전부 false (스칼라 경로 사용)
+ */
+#pragma once
+#include <cstdint>
+
+
+namespace framedot::core {
+
+    struct CpuFeatures {
+        bool sse2  {false};
+        bool sse41 {false};
+        bool avx   {false};
+        bool avx2  {false};
+    };
+
+    /// @brief 현재 CPU의 SIMD 지원 여부 (OS의 AVX 상태 저장 지원까지 확인)
+    const CpuFeatures& cpu_features() noexcept;
+
+} // namespace framedot::core
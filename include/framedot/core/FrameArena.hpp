@@ -0,0 +1,84 @@
+// include/framedot/core/FrameArena.hpp
+/**
+ * @file FrameArena.hpp
+ * @brief 프레임 단위 bump 할당기. reset()은 청크를 해제하지 않고 재사용한다.
+ *
+ * - 워밍업 이후에는 동적 할당이 발생하지 않는다(청크 재사용).
+ * - 청크 단위라서 이미 할당한 포인터는 reset 전까지 안정적이다.
+ * - 스레드 안전하지 않다: 스레드(워커/시스템)마다 하나씩 사용.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace framedot::core {
+
+    class FrameArena {
+    public:
+        explicit FrameArena(std::size_t chunk_bytes = 64 * 1024) noexcept
+            : m_chunk_bytes(chunk_bytes ? chunk_bytes : 1024) {}
+
+        FrameArena(FrameArena&&) noexcept = default;
+        FrameArena& operator=(FrameArena&&) noexcept = default;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /// @brief bytes 크기, align 정렬의 블록 할당 (align은 2의 거듭제곱)
+        void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) {
+            while (m_cur < m_chunks.size()) {
+                Chunk& c = m_chunks[m_cur];
+                const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(c.data.get());
+                const std::uintptr_t p = (base + m_ofs + (align - 1)) & ~(std::uintptr_t)(align - 1);
+                const std::size_t end = (std::size_t)(p - base) + bytes;
+                if (end <= c.size) {
+                    m_ofs = end;
+                    m_used += bytes;
+                    return reinterpret_cast<void*>(p);
+                }
+                ++m_cur;
+                m_ofs = 0;
+            }
+
+            // 새 청크 (큰 요청은 그 크기만큼)
+            const std::size_t size = (bytes + align > m_chunk_bytes) ? (bytes + align) : m_chunk_bytes;
+            m_chunks.push_back(Chunk{std::make_unique<std::byte[]>(size), size});
+            m_cur = m_chunks.size() - 1;
+            m_ofs = 0;
+            return allocate(bytes, align);
+        }
+
+        /// @brief 전체 되감기 (청크 유지)
+        void reset() noexcept {
+            m_cur = 0;
+            m_ofs = 0;
+            m_used = 0;
+        }
+
+        /// @brief 이번 프레임 사용량(정렬 패딩 제외)
+        std::size_t used_bytes() const noexcept { return m_used; }
+
+        /// @brief 확보된 총 용량
+        std::size_t capacity_bytes() const noexcept {
+            std::size_t n = 0;
+            for (const auto& c : m_chunks) n += c.size;
+            return n;
+        }
+
+    private:
+        struct Chunk {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t size{0};
+        };
+
+        std::vector<Chunk> m_chunks;
+        std::size_t m_chunk_bytes{0};
+        std::size_t m_cur{0};
+        std::size_t m_ofs{0};
+        std::size_t m_used{0};
+    };
+
+} // namespace framedot::core
@@ -10,6 +10,7 @@
 #include <framedot/input/InputState.hpp>
 #include <framedot/core/JobSystem.hpp>
 #include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/TextureCache.hpp>
 
 #include <cstdint>
 
@@ -39,6 +40,13 @@ namespace framedot::core {
 
         /// @brief RenderPrep 기록 대상(프레임당). 게임/시스템은 여기에 그릴 내용을 기록.
         framedot::gfx::RenderQueue* render_queue{nullptr};
+
+        /// @brief 텍스처 저장소 (Sprite2D::texture handle 해석용, 없으면 nullptr). 프레임 동안 수정하지 않는다
+        const framedot::gfx::TextureCache* textures{nullptr};
+
+        /// @brief 롤백 재시뮬레이션 중인 프레임인지
+        /// - true면 RenderPrep/픽셀화/present를 건너뛴다. 입력은 클라이언트가 기록해 둔 것을 사용.
+        bool resimulating{false};
     };  
 
 } // namespace framedot::core
\ No newline at end of file
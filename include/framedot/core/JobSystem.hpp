@@ -38,6 +38,19 @@ namespace framedot::core {
 
         /// @brief 지금까지 enqueue된 잡이 전부 끝날 때까지 대기
         virtual void wait_idle() = 0;
+
+        /// @brief 현재 스레드의 워커 번호
+        /// - 1..worker_count(): 워커 스레드 (구현체가 시작 시 지정)
+        /// - 0: 워커가 아닌 스레드 (메인 등)
+        static std::uint32_t current_worker_index() noexcept;
+
+        /// @brief 현재 스레드가 워커로 속한 잡 시스템 (워커가 아니거나 구현체가 알리지 않았으면 nullptr)
+        /// - 워커 번호는 잡 시스템마다 1부터이므로, 여러 잡 시스템이 함께 돌 때 번호만으로는 스레드를 구분할 수 없다
+        static const JobSystem* current_owner() noexcept;
+
+    protected:
+        /// @brief 구현체가 워커 스레드 시작 시 호출 (1부터). owner는 current_owner()로 돌려준다
+        static void set_current_worker_index(std::uint32_t index, const JobSystem* owner = nullptr) noexcept;
     };
 
 } // namespace framedot::core
\ No newline at end of file
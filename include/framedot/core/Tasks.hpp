@@ -68,9 +68,7 @@ namespace framedot::core {
         void wait() noexcept {
             if (!m_js) return;
 
-            // inflight가 0이면 빠르게 리턴
-            if (m_inflight.load(std::memory_order_acquire) == 0) return;
-
+            // 마지막 태스크가 notify를 마치기 전에 리턴하면 소멸자와 경합하므로 항상 락을 거친다
             std::unique_lock<std::mutex> lock(m_mtx);
             m_cv.wait(lock, [this]() {
                 return m_inflight.load(std::memory_order_acquire) == 0;
@@ -79,11 +77,9 @@ namespace framedot::core {
     
     private:
         void done_one_() {
+            std::lock_guard<std::mutex> lock(m_mtx);
             const auto left = m_inflight.fetch_sub(1, std::memory_order_acq_rel) - 1;
-            if (left == 0) {
-                std::lock_guard<std::mutex> lock(m_mtx);
-                m_cv.notify_all();
-            }
+            if (left == 0) m_cv.notify_all();
         }
 
         JobSystem* m_js{nullptr};
@@ -0,0 +1,180 @@
+// include/framedot/ecs/CommandBuffer.hpp
+/**
+ * @file CommandBuffer.hpp
+ * @brief ReadOnly 시스템이 구조 변경(create/destroy/emplace/remove)을 예약하는 지연 커맨드 버퍼.
+ *
+ * 설계 포인트:
+ * - 기록은 registry를 건드리지 않는다. 페이로드는 FrameArena에 복사된다.
+ * - create()는 재생 전까지 실제 entity가 없으므로 Pending 핸들을 돌려준다.
+ *   같은 버퍼 안에서는 Pending에도 emplace할 수 있다.
+ * - World::tick이 Phase 끝에서 시스템 등록 순서대로 재생한다(결정적).
+ * - 시스템 내부에서 워커로 일을 나누면 fork(n)으로 하위 버퍼를 받아
+ *   청크 i는 하위 버퍼 i에만 기록한다. 재생은 자기 기록 -> 하위 0..n-1 순서.
+ * - 스레드 안전하지 않다: 버퍼 하나에 동시에 한 스레드만 기록.
+ */
+#pragma once
+#include <entt/entt.hpp>
+
+#include <framedot/core/FrameArena.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace framedot::ecs {
+
+    class CommandBuffer {
+    public:
+        using Registry = entt::registry;
+
+        /// @brief 재생 전까지 실제 entity가 없는 예약 핸들 (이 버퍼 안에서만 유효)
+        struct Pending {
+            std::uint32_t index{0xFFFFFFFFu};
+        };
+
+        CommandBuffer() = default;
+        ~CommandBuffer() { reset(); }
+
+        CommandBuffer(CommandBuffer&&) noexcept = default;
+
+        /// @brief 재생하지 않은 기존 기록은 reset()으로 정리(페이로드 소멸자 호출)한 뒤 o의 기록을 넘겨받는다
+        CommandBuffer& operator=(CommandBuffer&& o) noexcept;
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        // ----------------------------
+        // 기록 API
+        // ----------------------------
+
+        /// @brief entity 생성 예약
+        Pending create() {
+            Pending p{m_pending_count++};
+            push_(Kind::Create, entt::null, p.index, nullptr, nullptr, nullptr);
+            return p;
+        }
+
+        /// @brief entity 파괴 예약 (재생 시점에 이미 무효면 무시)
+        void destroy(entt::entity e) {
+            push_(Kind::Destroy, e, 0, nullptr, nullptr, nullptr);
+        }
+
+        /// @brief 컴포넌트 추가/교체 예약 (emplace_or_replace)
+        template <class T>
+        void emplace(entt::entity e, T value) {
+            push_(Kind::Emplace, e, 0, &apply_emplace_<T>, store_(std::move(value)), destroy_fn_<T>());
+        }
+
+        /// @brief 이 버퍼에서 create()한 entity에 컴포넌트 추가 예약
+        template <class T>
+        void emplace(Pending p, T value) {
+            push_(Kind::EmplacePending, entt::null, p.index, &apply_emplace_<T>, store_(std::move(value)), destroy_fn_<T>());
+        }
+
+        /// @brief 컴포넌트 제거 예약
+        template <class T>
+        void remove(entt::entity e) {
+            push_(Kind::Remove, e, 0, &apply_remove_<T>, nullptr, nullptr);
+        }
+
+        /// @brief 하위 버퍼 n개 (시스템 내부 병렬 분할용). 이전 프레임의 하위 버퍼를 재사용한다.
+        /// @note 시스템 스레드에서 병렬 구간에 들어가기 전에 호출할 것
+        /// @warning n이 지금까지 만든 하위 버퍼 수보다 크면 배열이 재할당되어, 앞서 fork()가 돌려준
+        ///          span과 하위 버퍼 참조가 모두 무효가 된다(기록된 내용은 옮겨져 보존된다).
+        ///          한 프레임에서는 필요한 최대 개수로 한 번 fork하고, 병렬 구간 중에는 다시 부르지 말 것.
+        std::span<CommandBuffer> fork(std::size_t n);
+
+        // ----------------------------
+        // 재생
+        // ----------------------------
+
+        /// @brief 기록 순서대로 registry에 적용 (하위 버퍼 포함)
+        void playback(Registry& reg);
+
+        /// @brief 재생 후 Pending -> 실제 entity (reset 전까지 유효)
+        entt::entity resolve(Pending p) const noexcept {
+            return (p.index < m_created.size()) ? m_created[p.index] : entt::entity{entt::null};
+        }
+
+        /// @brief 기록/arena 되감기 (용량 유지)
+        void reset() noexcept;
+
+        /// @brief 기록된 커맨드 수 (하위 버퍼 포함)
+        std::size_t size() const noexcept;
+        bool empty() const noexcept { return size() == 0; }
+
+    private:
+        enum class Kind : std::uint8_t {
+            Create = 0,
+            Destroy,
+            Emplace,
+            EmplacePending,
+            Remove,
+        };
+
+        using ApplyFn   = void (*)(Registry&, entt::entity, void*);
+        using DestroyFn = void (*)(void*) noexcept;
+
+        struct Record {
+            Kind kind{};
+            std::uint32_t pending{0};
+            entt::entity target{entt::null};
+            ApplyFn apply{nullptr};
+            void* payload{nullptr};
+            DestroyFn destroy{nullptr};
+        };
+
+        void push_(Kind k, entt::entity e, std::uint32_t pending, ApplyFn fn, void* payload, DestroyFn dtor) {
+            Record r{};
+            r.kind = k;
+            r.pending = pending;
+            r.target = e;
+            r.apply = fn;
+            r.payload = payload;
+            r.destroy = dtor;
+            m_records.push_back(r);
+        }
+
+        template <class T>
+        void* store_(T&& value) {
+            using U = std::decay_t<T>;
+            void* mem = m_arena.allocate(sizeof(U), alignof(U));
+            return ::new (mem) U(std::forward<T>(value));
+        }
+
+        template <class T>
+        static void apply_emplace_(Registry& reg, entt::entity e, void* payload) {
+            reg.emplace_or_replace<T>(e, std::move(*static_cast<T*>(payload)));
+        }
+
+        template <class T>
+        static void apply_remove_(Registry& reg, entt::entity e, void*) {
+            reg.remove<T>(e);
+        }
+
+        template <class T>
+        static DestroyFn destroy_fn_() noexcept {
+            if constexpr (std::is_trivially_destructible_v<T>) {
+                return nullptr;
+            } else {
+                return [](void* p) noexcept { static_cast<T*>(p)->~T(); };
+            }
+        }
+
+        std::vector<Record> m_records;
+        framedot::core::FrameArena m_arena{16 * 1024};
+
+        std::uint32_t m_pending_count{0};
+        std::vector<entt::entity> m_created;
+
+        // 하위 버퍼 (fork). 크기는 줄이지 않고 재사용, 활성 개수는 m_child_count
+        std::vector<CommandBuffer> m_children;
+        std::size_t m_child_count{0};
+    };
+
+} // namespace framedot::ecs
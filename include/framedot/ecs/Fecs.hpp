@@ -12,12 +12,17 @@
 
 // core ECS
 #include <framedot/ecs/World.hpp>
+#include <framedot/ecs/Snapshot.hpp>
+#include <framedot/ecs/Rollback.hpp>
 
 // components
 #include <framedot/ecs/components/Basic2D.hpp>
+#include <framedot/ecs/components/Hierarchy2D.hpp>
 
 // systems
 #include <framedot/ecs/systems/RenderPrep2D.hpp>
+#include <framedot/ecs/systems/Movement2D.hpp>
+#include <framedot/ecs/systems/TransformHierarchy2D.hpp>
 
 namespace framedot::fecs {
 
@@ -25,6 +30,7 @@ namespace framedot::fecs {
     using Phase = framedot::ecs::Phase;
     using World = framedot::ecs::World;
     using Registry = framedot::ecs::World::Registry;
+    using CommandBuffer = framedot::ecs::CommandBuffer;
 
     // ---- Entity 타입도 여기서 통일해서 쓰게 만든다(현재는 EnTT) ----
     using Entity = entt::entity;
@@ -32,15 +38,36 @@ namespace framedot::fecs {
 
     // ---- 기본 컴포넌트 re-export ----
     using Transform2D = framedot::ecs::Transform2D;
+    using WorldTransform2D = framedot::ecs::WorldTransform2D;
+    using Parent2D    = framedot::ecs::Parent2D;
+    using Children2D  = framedot::ecs::Children2D;
     using Rect2D      = framedot::ecs::Rect2D;
+    using Velocity2D  = framedot::ecs::Velocity2D;
+    using Acceleration2D = framedot::ecs::Acceleration2D;
+    using Damping2D   = framedot::ecs::Damping2D;
     using RenderOrder2D = framedot::ecs::RenderOrder2D;
 
     using Sprite2D = framedot::ecs::Sprite2D;
     using Text2D   = framedot::ecs::Text2D;
 
+    // ---- 스냅샷 ----
+    using SnapshotView = framedot::ecs::SnapshotView;
+    using BasicSnapshot2D = framedot::ecs::BasicSnapshot2D;
+    template <class... Ts>
+    using SnapshotComponents = framedot::ecs::SnapshotComponents<Ts...>;
+    using framedot::ecs::write_snapshot;
+    using framedot::ecs::restore_snapshot;
+    using framedot::ecs::write_snapshot_delta;
+    using framedot::ecs::apply_snapshot_delta;
+    using RollbackBuffer = framedot::ecs::RollbackBuffer;
+
     // ---- 시스템 네임스페이스도 fecs::systems 로 제공 ----
     namespace systems {
         using framedot::ecs::systems::install_render_prep_2d;
+        using framedot::ecs::systems::install_transform_hierarchy_2d;
+        using framedot::ecs::systems::install_movement_2d;
+        using framedot::ecs::systems::attach_child;
+        using framedot::ecs::systems::detach_from_parent;
     }
 
 } // namespace framedot::fecs
\ No newline at end of file
@@ -0,0 +1,121 @@
+// include/framedot/ecs/Rollback.hpp
+/**
+ * @file Rollback.hpp
+ * @brief 최근 N프레임의 registry 상태를 보관하는 롤백 링 버퍼.
+ *
+ * 설계 포인트:
+ * - 슬롯 = frame % N. capture(frame)는 "frame을 시작하기 직전" 상태를 저장한다.
+ * - pool 단위 copy-on-write: 직렬화하기 전에 registry pool을 직전 프레임 데이터와 바로 비교해
+ *   같으면 쓰지 않고 원본 슬롯을 참조한다. 원본 슬롯이 덮어써질 때는 참조하던 슬롯으로
+ *   버퍼 소유권을 넘긴다(swap).
+ * - 한계: 바뀌지 않은 pool도 비교를 위해 한 번은 읽는다(O(pool 크기)). EnTT의 on_update는
+ *   get()/view로 직접 쓰는 변경을 알리지 않으므로 signal 기반 dirty 플래그로 건너뛰지 않는다.
+ * - pool 버퍼는 슬롯 사이에서 swap으로 순환하므로, 크기가 안정되면 할당이 없다.
+ * - 직렬화 형식은 Snapshot.hpp의 섹션과 같다(entity 테이블 + pool별 packed 배열).
+ * - restore()는 registry 전체를 비운 뒤 재구성한다. 컴포넌트 세트에 없는 pool은 복원 후 비어 있다.
+ */
+#pragma once
+#include <framedot/ecs/Snapshot.hpp>
+#include <framedot/ecs/World.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace framedot::ecs {
+
+    /// @brief 최근 N프레임 상태 링 버퍼
+    /// @warning restore()는 registry를 통째로 비운다(reg.clear()). 세트에 없는 컴포넌트는 사라지므로
+    ///          롤백 대상 registry의 모든 상태 컴포넌트를 세트에 넣을 것 (기본 세트: BasicSnapshot2D)
+    class RollbackBuffer {
+    public:
+        using Registry = World::Registry;
+
+        /// @brief 기본 2D 컴포넌트 세트(BasicSnapshot2D)로 구성
+        RollbackBuffer(Registry& reg, std::size_t frames)
+            : RollbackBuffer(reg, frames, BasicSnapshot2D{}) {}
+
+        /// @param reg 저장/복원 대상 registry (버퍼보다 오래 살아야 함)
+        /// @param frames 보관할 프레임 수 (최소 1)
+        template <class... Ts>
+        RollbackBuffer(Registry& reg, std::size_t frames, SnapshotComponents<Ts...>)
+            : m_reg(&reg)
+        {
+            using namespace snapshot_detail;
+            m_ops.reserve(1 + sizeof...(Ts));
+            m_ops.push_back(PoolOps{
+                &entity_plan,
+                &write_entities,
+                &same_entities,
+                +[](Registry& r, const std::byte* src, std::uint64_t count, std::uint32_t aux) {
+                    restore_entities(r, reinterpret_cast<const entt::entity*>(src), count, aux);
+                }});
+            (m_ops.push_back(PoolOps{
+                &pool_plan<Ts>,
+                &write_pool<Ts>,
+                &same_pool<Ts>,
+                +[](Registry& r, const std::byte* src, std::uint64_t count, std::uint32_t) {
+                    restore_pool<Ts>(r, src, count);
+                }}), ...);
+
+            init_(frames);
+        }
+
+        /// @brief 현재 registry 상태를 frame 슬롯에 저장 (같은 frame이 있으면 덮어쓴다)
+        void capture(std::uint64_t frame);
+
+        /// @brief frame 슬롯의 상태로 registry 복원 (registry는 비워진 뒤 재구성, 세트 밖 컴포넌트는 제거됨)
+        /// @return 보관 중이 아니면 false (registry 변경 없음)
+        bool restore(std::uint64_t frame);
+
+        /// @brief frame 상태를 보관 중인지
+        bool contains(std::uint64_t frame) const noexcept;
+
+        /// @brief 보관 중인 가장 오래된 프레임 (없으면 false)
+        bool oldest_frame(std::uint64_t& out) const noexcept;
+
+        std::size_t capacity() const noexcept { return m_slots.size(); }
+
+        /// @brief 모든 슬롯 무효화 (버퍼 용량 유지)
+        void clear() noexcept;
+
+        /// @brief 공유를 반영한 실제 보관 바이트 (pool별 소유 데이터 합)
+        std::size_t resident_bytes() const noexcept;
+
+    private:
+        using Plan = snapshot_detail::Plan;
+
+        struct PoolOps {
+            Plan (*plan)(const Registry&) noexcept;
+            void (*write)(const Registry&, std::byte*, std::uint64_t) noexcept;
+            bool (*same)(const Registry&, const std::byte*, std::uint64_t) noexcept;
+            void (*restore)(Registry&, const std::byte*, std::uint64_t, std::uint32_t);
+        };
+
+        struct Blob {
+            std::vector<std::byte> bytes;
+            std::uint64_t count{0};
+            std::uint32_t aux{0};
+        };
+
+        struct Slot {
+            std::uint64_t frame{0};
+            bool valid{false};
+            std::vector<Blob> own;              // pool별 버퍼 (ref가 자기 자신일 때만 유효)
+            std::vector<std::uint32_t> ref;     // pool별 데이터를 가진 슬롯 인덱스
+        };
+
+        void init_(std::size_t frames);
+        void release_(std::size_t slot) noexcept;
+
+        const Blob& blob_(const Slot& s, std::size_t pool) const noexcept {
+            return m_slots[s.ref[pool]].own[pool];
+        }
+
+        Registry* m_reg{nullptr};
+        std::vector<PoolOps> m_ops;
+        std::vector<Slot> m_slots;
+    };
+
+} // namespace framedot::ecs
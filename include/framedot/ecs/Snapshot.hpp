@@ -0,0 +1,320 @@
+// include/framedot/ecs/Snapshot.hpp
+/**
+ * @file Snapshot.hpp
+ * @brief World(registry) 바이너리 스냅샷/복원. 롤백/체크포인트용 고속 경로.
+ *
+ * 설계 포인트:
+ * - trivially copyable 컴포넌트만 대상. pool 하나 = 섹션 하나(entity 배열 + 컴포넌트 배열을 packed로 복사).
+ *   EnTT archive처럼 컴포넌트마다 콜백을 거치지 않는다.
+ * - 파일 레이아웃은 오프셋 기반 + 섹션 16바이트 정렬 -> mmap한 바이트를 그대로 SnapshotView로 읽는다.
+ * - delta: 이전 스냅샷(base) 대비 섹션 단위 비교. 크기가 같으면 블록 패치, 같으면 생략, 다르면 전체.
+ *   apply_snapshot_delta()로 full 스냅샷을 재구성한 뒤 복원한다.
+ * - 바이트 순서/entity 표현은 호스트 기준(같은 빌드 간 교환을 가정).
+ *
+ * 사용:
+ *   std::vector<std::byte> buf;
+ *   write_snapshot(reg, buf, frame, BasicSnapshot2D{});
+ *   SnapshotView v;
+ *   if (SnapshotView::parse(buf, v)) restore_snapshot(reg, v, BasicSnapshot2D{});
+ */
+#pragma once
+#include <entt/entt.hpp>
+
+#include <framedot/ecs/World.hpp>
+#include <framedot/ecs/components/Basic2D.hpp>
+#include <framedot/ecs/components/Hierarchy2D.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+namespace framedot::ecs {
+
+    /// @brief 스냅샷 대상 컴포넌트 목록 (태그 타입)
+    template <class... Ts>
+    struct SnapshotComponents {};
+
+    /// @brief 기본 2D 컴포넌트 세트 (Basic2D/Hierarchy2D의 모든 컴포넌트)
+    /// - Sprite2D::pixels는 주소 그대로 저장된다. 같은 프로세스 안(롤백/체크포인트)에서만 유효하다.
+    using BasicSnapshot2D = SnapshotComponents<
+        Transform2D, Velocity2D, Acceleration2D, Damping2D,
+        Rect2D, Sprite2D, Text2D, RenderOrder2D,
+        Parent2D, Children2D, WorldTransform2D>;
+
+    inline constexpr std::uint32_t kSnapshotMagic   = 0x4E534446u; // 'FDSN'
+    inline constexpr std::uint16_t kSnapshotVersion = 1;
+    inline constexpr std::uint16_t kSnapshotDelta   = 1u << 0;
+
+    /// @brief 섹션 type_id 0은 entity 테이블
+    inline constexpr std::uint32_t kSnapshotEntitySection = 0;
+
+    struct SnapshotHeader {
+        std::uint32_t magic{kSnapshotMagic};
+        std::uint16_t version{kSnapshotVersion};
+        std::uint16_t flags{0};
+        std::uint32_t section_count{0};
+        std::uint32_t reserved{0};
+        std::uint64_t frame{0};
+        std::uint64_t base_frame{0};      // delta 전용
+        std::uint64_t base_checksum{0};   // delta 전용: base 전체 바이트 checksum
+        std::uint64_t total_bytes{0};
+    };
+
+    enum class SnapshotSectionKind : std::uint32_t {
+        Full  = 0,  // [entity ids][pad16][components]
+        Patch = 1,  // delta: base 섹션 대비 변경 블록만
+        Same  = 2,  // delta: base 섹션과 동일 (데이터 없음)
+    };
+
+    struct SnapshotSection {
+        std::uint32_t type_id{0};
+        std::uint32_t elem_size{0};
+        SnapshotSectionKind kind{SnapshotSectionKind::Full};
+        std::uint32_t aux{0};       // entity 섹션: free_list(사용 중 개수)
+        std::uint64_t count{0};
+        std::uint64_t offset{0};    // 파일 시작 기준, 16바이트 정렬
+        std::uint64_t bytes{0};
+    };
+
+    static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+    static_assert(std::is_trivially_copyable_v<SnapshotSection>);
+
+    constexpr std::size_t snapshot_align16(std::size_t n) noexcept { return (n + 15u) & ~std::size_t(15u); }
+
+    /// @brief 바이트 버퍼(소유 버퍼/mmap 영역) 위의 읽기 전용 뷰
+    class SnapshotView {
+    public:
+        /// @brief 헤더/섹션 테이블 검증. 실패 시 false
+        /// - 모든 섹션: 크기 필드, kind별 bytes(Full은 full 크기, Same은 0), offset 정렬/범위
+        /// - entity 섹션: free_list(aux) <= count
+        static bool parse(std::span<const std::byte> bytes, SnapshotView& out) noexcept;
+
+        bool valid() const noexcept { return m_header != nullptr; }
+        bool is_delta() const noexcept { return valid() && (m_header->flags & kSnapshotDelta) != 0; }
+
+        const SnapshotHeader& header() const noexcept { return *m_header; }
+        std::uint64_t frame() const noexcept { return m_header ? m_header->frame : 0; }
+
+        std::span<const SnapshotSection> sections() const noexcept { return m_sections; }
+        const SnapshotSection* find(std::uint32_t type_id) const noexcept;
+
+        std::span<const std::byte> bytes() const noexcept { return m_bytes; }
+        const std::byte* section_data(const SnapshotSection& s) const noexcept { return m_bytes.data() + s.offset; }
+
+    private:
+        std::span<const std::byte> m_bytes;
+        const SnapshotHeader* m_header{nullptr};
+        std::span<const SnapshotSection> m_sections;
+    };
+
+    /// @brief 빠른 64bit checksum (delta의 base 검증용)
+    std::uint64_t snapshot_checksum(std::span<const std::byte> bytes) noexcept;
+
+    /// @brief cur를 base 대비 delta로 인코딩 (둘 다 full 스냅샷이어야 함)
+    bool write_snapshot_delta(const SnapshotView& base, const SnapshotView& cur, std::vector<std::byte>& out);
+
+    /// @brief base + delta -> full 스냅샷 (out은 용량 재사용, base/delta 버퍼와 겹치면 안 됨)
+    bool apply_snapshot_delta(const SnapshotView& base, const SnapshotView& delta, std::vector<std::byte>& out);
+
+    namespace snapshot_detail {
+
+        using Registry = World::Registry;
+
+        /// @brief 섹션 배치 계획 (layout이 offset/bytes를 채운다)
+        struct Plan {
+            std::uint32_t type_id;
+            std::uint32_t elem_size;
+            std::uint32_t aux;
+            std::uint64_t count;
+            std::uint64_t offset;
+            std::uint64_t bytes;
+        };
+
+        /// @brief 헤더/섹션 테이블 작성 + 데이터 영역 확보. 반환: out.data()
+        std::byte* layout(std::vector<std::byte>& out, std::uint64_t frame, Plan* plans, std::size_t n);
+
+        /// @brief full 섹션에서 컴포넌트 배열 시작 위치
+        constexpr std::size_t component_offset(std::uint64_t count) noexcept {
+            return snapshot_align16((std::size_t)count * sizeof(entt::entity));
+        }
+
+        template <class T>
+        constexpr std::uint32_t type_id() noexcept {
+            const std::uint32_t id = (std::uint32_t)entt::type_hash<T>::value();
+            return id == kSnapshotEntitySection ? 1u : id;
+        }
+
+        template <class T>
+        void check_type_() noexcept {
+            static_assert(std::is_trivially_copyable_v<T>, "snapshot components must be trivially copyable");
+            static_assert(!std::is_empty_v<T>, "empty (tag) components are not supported by snapshot");
+        }
+
+        inline Plan entity_plan(const Registry& reg) noexcept {
+            const auto* st = reg.storage<entt::entity>();
+            Plan p{};
+            p.type_id = kSnapshotEntitySection;
+            p.elem_size = (std::uint32_t)sizeof(entt::entity);
+            p.count = st ? (std::uint64_t)st->size() : 0u;
+            p.aux = st ? (std::uint32_t)st->free_list() : 0u;
+            p.bytes = p.count * sizeof(entt::entity);
+            return p;
+        }
+
+        template <class T>
+        Plan pool_plan(const Registry& reg) noexcept {
+            check_type_<T>();
+            const auto* st = reg.storage<T>();
+            Plan p{};
+            p.type_id = type_id<T>();
+            p.elem_size = (std::uint32_t)sizeof(T);
+            p.count = st ? (std::uint64_t)st->size() : 0u;
+            p.bytes = p.count ? (component_offset(p.count) + p.count * sizeof(T)) : 0u;
+            return p;
+        }
+
+        inline void write_entities(const Registry& reg, std::byte* dst, std::uint64_t count) noexcept {
+            const auto* st = reg.storage<entt::entity>();
+            if (!st || count == 0) return;
+            auto* ids = reinterpret_cast<entt::entity*>(dst);
+            const entt::entity* src = st->data();
+            for (std::uint64_t i = 0; i < count; ++i) ids[i] = src[i];
+        }
+
+        template <class T>
+        void write_pool(const Registry& reg, std::byte* dst, std::uint64_t count) noexcept {
+            const auto* st = reg.storage<T>();
+            if (!st || count == 0) return;
+            auto* ids   = reinterpret_cast<entt::entity*>(dst);
+            auto* comps = reinterpret_cast<T*>(dst + component_offset(count));
+
+            // storage 반복은 packed 역순 -> 뒤에서부터 채워 packed 순서를 유지
+            std::uint64_t i = count;
+            for (auto [e, c] : st->each()) {
+                if (i == 0) break;
+                --i;
+                ids[i] = e;
+                comps[i] = c;
+            }
+        }
+
+        /// @brief registry를 비우고 entity 테이블을 원래 식별자(버전 포함) 그대로 복원
+        inline void restore_entities(Registry& reg, const entt::entity* ids, std::uint64_t count, std::uint32_t in_use) {
+            reg.clear();
+            auto& st = reg.storage<entt::entity>();
+            st.clear();
+            st.reserve((std::size_t)count);
+            for (std::uint64_t i = 0; i < count; ++i) st.emplace(ids[i]);
+            st.free_list((std::size_t)in_use);
+        }
+
+        /// @brief entity 테이블이 직렬화된 데이터와 같은지 (count/free_list는 호출자가 비교)
+        inline bool same_entities(const Registry& reg, const std::byte* src, std::uint64_t count) noexcept {
+            const auto* st = reg.storage<entt::entity>();
+            if (!st || count == 0) return count == 0;
+            return std::memcmp(src, st->data(), (std::size_t)count * sizeof(entt::entity)) == 0;
+        }
+
+        /// @brief pool이 직렬화된 데이터(write_pool 형식)와 같은지. 쓰지 않고 비교만 한다.
+        /// - 바이트 비교라 패딩이 달라도 다르다고 본다(보수적)
+        template <class T>
+        bool same_pool(const Registry& reg, const std::byte* src, std::uint64_t count) noexcept {
+            const auto* st = reg.storage<T>();
+            if (!st || count == 0) return count == 0;
+            if ((std::uint64_t)st->size() != count) return false;
+
+            const auto* ids   = reinterpret_cast<const entt::entity*>(src);
+            const auto* comps = reinterpret_cast<const T*>(src + component_offset(count));
+            if (std::memcmp(ids, st->data(), (std::size_t)count * sizeof(entt::entity)) != 0) return false;
+
+            std::uint64_t i = count;
+            for (auto [e, c] : st->each()) {
+                (void)e;
+                if (i == 0) break;
+                --i;
+                if (std::memcmp(&comps[i], &c, sizeof(T)) != 0) return false;
+            }
+            return true;
+        }
+
+        /// @brief entity 테이블 식별자 검증 (restore 전, 손상된 파일이 EnTT까지 가지 않게)
+        /// - null이 아니고 인덱스가 겹치지 않아야 한다. slot[인덱스] = 테이블 위치 + 1 (0은 없음)
+        bool index_entities(const entt::entity* ids, std::uint64_t count, std::vector<std::uint32_t>& slot);
+
+        /// @brief pool 섹션 식별자 검증: 모두 테이블의 사용 중 구간 [0, in_use)에 (버전까지 같게) 있고 서로 겹치지 않는다
+        /// - slot은 index_entities가 채운 것. 검사 중 표시한 비트는 반환 전에 지운다
+        bool valid_pool_ids(const entt::entity* ids, std::uint64_t count,
+                            const entt::entity* table, std::uint32_t in_use, std::vector<std::uint32_t>& slot) noexcept;
+
+        template <class T>
+        void restore_pool(Registry& reg, const std::byte* src, std::uint64_t count) {
+            check_type_<T>();
+            if (count == 0) return;
+            const auto* ids   = reinterpret_cast<const entt::entity*>(src);
+            const auto* comps = reinterpret_cast<const T*>(src + component_offset(count));
+            reg.insert<T>(ids, ids + count, comps);
+        }
+
+    } // namespace snapshot_detail
+
+    /// @brief registry -> full 스냅샷 (out은 크기만 맞추고 용량 재사용)
+    /// @return 기록한 바이트 수
+    template <class... Ts>
+    std::size_t write_snapshot(const World::Registry& reg, std::vector<std::byte>& out,
+                               std::uint64_t frame, SnapshotComponents<Ts...> = {}) {
+        using namespace snapshot_detail;
+        std::array<Plan, 1 + sizeof...(Ts)> plans{ entity_plan(reg), pool_plan<Ts>(reg)... };
+
+        std::byte* base = layout(out, frame, plans.data(), plans.size());
+        write_entities(reg, base + plans[0].offset, plans[0].count);
+
+        std::size_t i = 1;
+        ((write_pool<Ts>(reg, base + plans[i].offset, plans[i].count), ++i), ...);
+        return out.size();
+    }
+
+    /// @brief full 스냅샷 -> registry
+    /// - registry는 비워진다(목록에 없는 컴포넌트도 제거됨). entity 식별자/버전은 그대로 복원.
+    /// @return 형식이 맞지 않거나 delta거나, entity id가 중복되거나 pool id가 사용 중인 entity가 아니면 false (registry 변경 없음)
+    template <class... Ts>
+    bool restore_snapshot(World::Registry& reg, const SnapshotView& snap, SnapshotComponents<Ts...> = {}) {
+        using namespace snapshot_detail;
+        if (!snap.valid() || snap.is_delta()) return false;
+
+        const SnapshotSection* es = snap.find(kSnapshotEntitySection);
+        if (!es || es->elem_size != sizeof(entt::entity) || es->aux > es->count) return false;
+
+        // 타입 크기 검증을 먼저 끝내고 registry를 건드린다.
+        const bool sizes_ok = (... && [&] {
+            const SnapshotSection* s = snap.find(type_id<Ts>());
+            return !s || s->elem_size == sizeof(Ts);
+        }());
+        if (!sizes_ok) return false;
+
+        // 식별자 검증: 중복/범위 밖 id는 EnTT assert(또는 UB)로 이어지므로 registry를 건드리기 전에 거부
+        const auto* table = reinterpret_cast<const entt::entity*>(snap.section_data(*es));
+        std::vector<std::uint32_t> slot;
+        if (!index_entities(table, es->count, slot)) return false;
+        const bool ids_ok = (... && [&] {
+            const SnapshotSection* s = snap.find(type_id<Ts>());
+            return !s || valid_pool_ids(reinterpret_cast<const entt::entity*>(snap.section_data(*s)), s->count,
+                                        table, es->aux, slot);
+        }());
+        if (!ids_ok) return false;
+
+        restore_entities(reg, table, es->count, es->aux);
+
+        ([&] {
+            if (const SnapshotSection* s = snap.find(type_id<Ts>())) {
+                restore_pool<Ts>(reg, snap.section_data(*s), s->count);
+            }
+        }(), ...);
+        return true;
+    }
+
+} // namespace framedot::ecs
@@ -9,7 +9,9 @@
 
 #include <framedot/core/FrameContext.hpp>
 #include <framedot/core/JobSystem.hpp>
+#include <framedot/ecs/CommandBuffer.hpp>
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <vector>
@@ -41,6 +43,11 @@ namespace framedot::ecs {
         /// @brief 읽기 전용 시스템(병렬 실행 가능)
         using ReadSystem  = std::function<void(const framedot::core::FrameContext&, const Registry&)>;
 
+        /// @brief 읽기 전용 + 지연 커맨드 시스템(병렬 실행 가능)
+        /// - 구조 변경(create/destroy/emplace/remove)은 CommandBuffer에 기록하고,
+        ///   Phase 끝(Write 시스템 이후)에 시스템 등록 순서대로 재생된다.
+        using ReadCmdSystem = std::function<void(const framedot::core::FrameContext&, const Registry&, CommandBuffer&)>;
+
         /// @brief registry 접근 (엔진 내부 entity 생성/삭제 등)
         Registry& registry() noexcept {  return m_reg;  }
 
@@ -51,13 +58,18 @@ namespace framedot::ecs {
         /// - 같은 Phase의 ReadOnly 시스템은 job system으로 병렬 실행된다(가능할 때).
         void add_read_system(Phase phase, ReadSystem fn);
 
+        /// @brief 지연 커맨드 버퍼를 받는 읽기 전용 시스템 등록
+        /// - 시스템마다 전용 CommandBuffer를 가진다(다른 시스템과 경합 없음).
+        void add_read_system(Phase phase, ReadCmdSystem fn);
+
         /// @brief 쓰기 시스템 등록
         /// - registry를 변경할 수 있으므로 기본적으로 직렬 실행된다.
         void add_write_system(Phase phase, WriteSystem fn);
 
         /// @brief 프레임 업데이트
         /// - Phase 순서대로 실행
-        /// - Phase 내부: (ReadOnly 병렬) -> (Write 직렬)
+        /// - Phase 내부: (ReadOnly 병렬) -> (Write 직렬) -> (지연 커맨드 재생)
+        /// - ctx.resimulating이면 RenderPrep Phase는 건너뛴다.
         void tick(const framedot::core::FrameContext& ctx);
 
     private:
@@ -68,10 +80,21 @@ namespace framedot::ecs {
             return static_cast<std::size_t>(p);
         }
 
+        /// @brief 읽기 전용 시스템 슬롯 (둘 중 하나만 설정)
+        struct ReadEntry {
+            ReadSystem    fn;
+            ReadCmdSystem fn_cmd;
+
+            /// @brief fn_cmd 전용 버퍼. 다음 실행 직전까지 resolve() 가능하도록 그때 reset
+            CommandBuffer cmds;
+        };
+
+        void run_read_(ReadEntry& r, const framedot::core::FrameContext& ctx);
+
         Registry m_reg;
 
         /// @brief Phase별 읽기 전용 시스템들(병렬 후보)
-        std::array<std::vector<ReadSystem>, kPhaseCount>  m_read{};
+        std::array<std::vector<ReadEntry>, kPhaseCount>  m_read{};
 
         /// @brief Phase별 쓰기 시스템들(직렬)
         std::array<std::vector<WriteSystem>, kPhaseCount> m_write{};
@@ -2,6 +2,8 @@
 #pragma once
 #include <framedot/math/Types.hpp>
 #include <framedot/gfx/Color.hpp>
+#include <framedot/gfx/SpriteAffine.hpp>
+#include <framedot/gfx/TextureCache.hpp>
 
 #include <cstdint>
 #include <array>
@@ -23,6 +25,16 @@ namespace framedot::ecs {
         framedot::math::Vec2f v {0.0f, 0.0f};
     };
 
+    /// @brief 가속도 (선택). Movement2D 시스템이 속도에 적분한다.
+    struct Acceleration2D {
+        framedot::math::Vec2f a {0.0f, 0.0f};
+    };
+
+    /// @brief 속도 감쇠 (선택). v *= 1 / (1 + damping * dt)
+    struct Damping2D {
+        float damping {0.0f};
+    };
+
     // 렌더링 정렬 키
     // - 값이 작을수록 먼저 그려짐 (뒤 배경 -> 앞 오브젝트)
     struct RenderOrder2D {
@@ -53,6 +65,12 @@ namespace framedot::ecs {
 
         // tint (곱) + alpha
         framedot::gfx::ColorRGBA8 tint{255, 255, 255, 255};
+
+        /// @brief 스케일/회전이 있을 때의 샘플링 (없으면 그대로 복사)
+        framedot::gfx::SampleFilter filter{framedot::gfx::SampleFilter::Nearest};
+
+        /// @brief 유효하면 pixels 대신 FrameContext::textures의 텍스처를 그린다 (크기도 텍스처 기준)
+        framedot::gfx::TextureHandle texture{};
     };
 
     /// @brief per-entity 고정 텍스트 (프레임마다 바뀌어도 할당 없음)
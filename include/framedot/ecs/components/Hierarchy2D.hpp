@@ -0,0 +1,48 @@
+// framedot/ecs/components/Hierarchy2D.hpp
+#pragma once
+#include <entt/entt.hpp>
+
+#include <framedot/math/Types.hpp>
+#include <framedot/ecs/components/Basic2D.hpp>
+
+#include <cstdint>
+
+
+namespace framedot::ecs {
+
+    /// @brief 부모 링크 + 형제 intrusive list
+    /// - 할당 없이 자식 목록을 유지하기 위해 형제 포인터를 자식 쪽에 둔다.
+    /// - 직접 수정하지 말고 systems::attach_child / detach_from_parent 사용
+    /// - child 파괴/Parent2D 제거 시 링크 복구는 install_transform_hierarchy_2d가 연결하는 훅이 맡는다.
+    struct Parent2D {
+        entt::entity parent       {entt::null};
+        entt::entity prev_sibling {entt::null};
+        entt::entity next_sibling {entt::null};
+    };
+
+    /// @brief 자식 목록 헤드 (첫 자식 + 개수)
+    struct Children2D {
+        entt::entity  first {entt::null};
+        std::uint32_t count {0};
+    };
+
+    /// @brief 캐시된 월드 트랜스폼 (부모 world * 로컬 Transform2D)
+    /// - 전파 시스템이 갱신한다. 유저는 읽기만 한다.
+    /// - local/revision은 dirty 판정용 캐시
+    struct WorldTransform2D {
+        framedot::math::Mat3f world{};
+
+        /// @brief 마지막으로 world를 계산할 때 쓴 로컬 트랜스폼
+        Transform2D local{};
+
+        /// @brief world가 다시 계산될 때마다 증가 (자식의 dirty 판정용)
+        std::uint32_t revision{0};
+
+        /// @brief 마지막 계산 시점의 부모 revision
+        std::uint32_t parent_revision{0};
+
+        /// @brief 1이면 다음 전파에서 강제로 재계산
+        std::uint8_t dirty{1};
+    };
+
+} // namespace framedot::ecs
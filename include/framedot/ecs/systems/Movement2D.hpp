@@ -0,0 +1,58 @@
+// include/framedot/ecs/systems/Movement2D.hpp
+/**
+ * @file Movement2D.hpp
+ * @brief Velocity2D(+Acceleration2D/Damping2D)를 Transform2D에 적분하는 내장 이동 시스템.
+ *
+ * 설계 포인트:
+ * - Velocity2D pool의 packed 배열을 워커 수만큼 구간으로 나눠 병렬 처리한다.
+ * - 각 구간은 블록 단위로 SoA 스크래치(x/y/vx/vy/ax/ay/damp)에 모은 뒤
+ *   SSE/AVX 커널로 적분하고 다시 컴포넌트에 쓴다. (EnTT pool은 AoS라 직접 벡터화 불가)
+ * - 커널은 런타임 CPU 감지로 선택되며, 모든 경로의 결과는 스칼라와 비트 단위로 같다.
+ *
+ * 적분(semi-implicit Euler):
+ *   v = (v + a*dt) * damp,  damp = 1 / (1 + damping*dt)
+ *   p = p + v*dt
+ */
+#pragma once
+#include <framedot/ecs/World.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace framedot::ecs::systems {
+
+    /// @brief 적분 커널 입력 (SoA). ax/ay/damp는 블록 전체에 대해 채워져 있어야 한다.
+    struct MovementSoA2D {
+        float* px{nullptr};
+        float* py{nullptr};
+        float* vx{nullptr};
+        float* vy{nullptr};
+        const float* ax{nullptr};
+        const float* ay{nullptr};
+        const float* damp{nullptr};
+        std::size_t count{0};
+    };
+
+    /// @brief SoA 적분 (CPU 기능에 따라 AVX/SSE/스칼라 자동 선택)
+    void integrate_soa_2d(const MovementSoA2D& soa, float dt) noexcept;
+
+    /// @brief SoA 적분 스칼라 기준 구현 (검증/벤치 비교용)
+    void integrate_soa_2d_scalar(const MovementSoA2D& soa, float dt) noexcept;
+
+    /// @brief 적분 커널 ISA
+    enum class MovementIsa : std::uint8_t { Scalar = 0, SSE, AVX };
+
+    using MovementKernel2D = void (*)(const MovementSoA2D&, float) noexcept;
+
+    /// @brief 지정 ISA 적분 커널 (CPU가 지원하지 않으면 nullptr). 검증/벤치용
+    MovementKernel2D integrate_soa_2d_for(MovementIsa isa) noexcept;
+
+    /// @brief 선택된 커널 이름 ("avx", "sse", "scalar")
+    const char* movement_2d_kernel_name() noexcept;
+
+    /// @brief 이동 시스템 설치 (기본: Update 단계의 write 시스템)
+    /// - 계층 전파(PostUpdate)보다 먼저 돌도록 Update에 둔다.
+    void install_movement_2d(World& world, Phase phase = Phase::Update);
+
+} // namespace framedot::ecs::systems
@@ -7,21 +7,26 @@
  * - 병렬 구간에서 EnTT registry 접근을 하지 않고,
  *   메인에서 snapshot(POD 배열)만 만든다.
  * - 워커는 RenderQueue push만 수행한다.
+ * - WorldTransform2D가 있으면(계층 전파 결과) 로컬 Transform2D 대신 월드 위치/스케일을 쓴다.
+ * - Sprite2D::texture가 FrameContext::textures에 있으면 blit_texture*로 기록한다 (원시 포인터 대신).
+ * - 스프라이트는 스케일/회전/반전이 있으면 blit_sprite_affine으로, 없으면 blit_sprite로 그린다.
+ * - snapshot 배열은 시스템이 소유한 vector로 프레임 간 재사용한다 (큐 용량만큼만 모은다).
  */
 #pragma once
 #include <framedot/core/Tasks.hpp>
 #include <framedot/ecs/World.hpp>
 #include <framedot/ecs/components/Basic2D.hpp>
+#include <framedot/ecs/components/Hierarchy2D.hpp>
 #include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/math/Types.hpp>
 
-#include <array>
+#include <cmath>
 #include <cstdint>
 #include <string_view>
+#include <vector>
 
 namespace framedot::ecs::systems {
 
-    static constexpr std::size_t kMaxItems = framedot::gfx::RenderQueue::kMax;
-
     struct RectItem {
         int x, y, w, h;
         framedot::gfx::ColorRGBA8 color;
@@ -37,6 +42,10 @@ namespace framedot::ecs::systems {
         std::uint16_t stride;
         framedot::gfx::ColorRGBA8 tint;
         std::uint32_t sort_key;
+        framedot::math::Mat3f m;   // affine일 때만 사용
+        framedot::gfx::SampleFilter filter;
+        framedot::gfx::TextureHandle texture;   // 유효하면 pixels 대신 사용
+        bool affine;
     };
 
     struct TextItem {
@@ -48,18 +57,58 @@ namespace framedot::ecs::systems {
         std::uint32_t sort_key;
     };
 
+    /// @brief 화면 배치 (정수 픽셀 위치 + 축 스케일)
+    struct Placement2D {
+        int x, y;
+        float sx, sy;
+    };
+
+    /// @brief WorldTransform2D가 있으면 월드 값, 없으면 로컬 Transform2D 기준
+    /// - 위치는 floor (음수 좌표에서 int 캐스트의 0 방향 절삭 방지)
+    /// - 회전은 반영하지 않는다 (스프라이트는 sprite_matrix_2d)
+    inline Placement2D placement_2d(const World::Registry& reg, entt::entity e,
+                                    const framedot::ecs::Transform2D& t) noexcept {
+        framedot::math::Vec2f pos = t.position;
+        framedot::math::Vec2f scl{std::fabs(t.scale.x), std::fabs(t.scale.y)};
+
+        if (const auto* w = reg.try_get<framedot::ecs::WorldTransform2D>(e)) {
+            pos = framedot::math::affine_translation(w->world);
+            scl = framedot::math::affine_scale(w->world);
+        }
+
+        return Placement2D{ (int)std::floor(pos.x), (int)std::floor(pos.y), scl.x, scl.y };
+    }
+
+    /// @brief 스프라이트 로컬 픽셀 좌표 -> 화면 행렬 (WorldTransform2D가 있으면 월드 행렬)
+    inline framedot::math::Mat3f sprite_matrix_2d(const World::Registry& reg, entt::entity e,
+                                                  const framedot::ecs::Transform2D& t) noexcept {
+        if (const auto* w = reg.try_get<framedot::ecs::WorldTransform2D>(e)) return w->world;
+        return framedot::math::make_affine_2d(t.position, t.rotation_rad, t.scale);
+    }
+
     inline void install_render_prep_2d(World& world) {
+        struct State {
+            std::vector<RectItem> rects;
+            std::vector<SpriteItem> sprites;
+            std::vector<TextItem> texts;
+        };
+
         world.add_read_system(Phase::RenderPrep,
-            [](const framedot::core::FrameContext& ctx, const World::Registry& reg) {
+            [st = State{}](const framedot::core::FrameContext& ctx, const World::Registry& reg) mutable {
                 auto* rq = ctx.render_queue;
                 if (!rq) return;
 
                 // ----------------------------
                 // 1) snapshot gather (single thread)
                 // ----------------------------
-                std::array<RectItem, kMaxItems> rects{};
-                std::array<SpriteItem, kMaxItems> sprites{};
-                std::array<TextItem, kMaxItems> texts{};
+                // 큐에 들어갈 수 없는 항목은 모으지 않는다 (종류별 상한 = 큐 용량)
+                const std::size_t max_items = rq->capacity();
+                auto& rects = st.rects;
+                auto& sprites = st.sprites;
+                auto& texts = st.texts;
+                rects.clear();
+                sprites.clear();
+                texts.clear();
 
                 std::size_t rc = 0, sc = 0, tc = 0;
 
@@ -68,7 +117,7 @@ namespace framedot::ecs::systems {
                     auto view = reg.view<const framedot::ecs::Transform2D,
                                         const framedot::ecs::Rect2D>();
                     for (auto e : view) {
-                        if (rc >= rects.size()) break;
+                        if (rc >= max_items) break;
 
                         const auto& t = view.get<const framedot::ecs::Transform2D>(e);
                         const auto& r = view.get<const framedot::ecs::Rect2D>(e);
@@ -78,16 +127,19 @@ namespace framedot::ecs::systems {
                             sort_key = ro->sort_key;
                         }
 
+                        const Placement2D pl = placement_2d(reg, e, t);
+
                         RectItem it{};
-                        it.x = (int)t.position.x;
-                        it.y = (int)t.position.y;
-                        it.w = (int)r.size.x;
-                        it.h = (int)r.size.y;
+                        it.x = pl.x;
+                        it.y = pl.y;
+                        it.w = (int)std::lround(r.size.x * pl.sx);
+                        it.h = (int)std::lround(r.size.y * pl.sy);
                         it.color = r.color;
                         it.sort_key = sort_key;
                         it.outline_px = r.outline_px;
                         it.outline = (r.outline_px > 0);
-                        rects[rc++] = it;
+                        rects.push_back(it);
+                        ++rc;
                     }
                 }
 
@@ -96,28 +148,36 @@ namespace framedot::ecs::systems {
                     auto view = reg.view<const framedot::ecs::Transform2D,
                                         const framedot::ecs::Sprite2D>();
                     for (auto e : view) {
-                        if (sc >= sprites.size()) break;
+                        if (sc >= max_items) break;
 
                         const auto& t = view.get<const framedot::ecs::Transform2D>(e);
                         const auto& s = view.get<const framedot::ecs::Sprite2D>(e);
 
-                        if (!s.pixels || s.width <= 0 || s.height <= 0) continue;
+                        const bool textured = s.texture && ctx.textures && ctx.textures->contains(s.texture);
+                        if (!textured && (!s.pixels || s.width <= 0 || s.height <= 0)) continue;
 
                         std::uint32_t sort_key = 0;
                         if (const auto* ro = reg.try_get<framedot::ecs::RenderOrder2D>(e)) {
                             sort_key = ro->sort_key;
                         }
 
+                        const framedot::math::Mat3f m = sprite_matrix_2d(reg, e, t);
+
                         SpriteItem it{};
-                        it.x = (int)t.position.x;
-                        it.y = (int)t.position.y;
+                        it.x = (int)std::floor(m.m[2]);
+                        it.y = (int)std::floor(m.m[5]);
+                        it.m = m;
+                        it.filter = s.filter;
+                        it.affine = !(m.m[0] == 1.0f && m.m[1] == 0.0f && m.m[3] == 0.0f && m.m[4] == 1.0f);
+                        it.texture = textured ? s.texture : framedot::gfx::TextureHandle{};
                         it.pixels = s.pixels;
                         it.w = s.width;
                         it.h = s.height;
                         it.stride = (s.stride_pixels != 0) ? s.stride_pixels : (std::uint16_t)s.width;
                         it.tint = s.tint;
                         it.sort_key = sort_key;
-                        sprites[sc++] = it;
+                        sprites.push_back(it);
+                        ++sc;
                     }
                 }
 
@@ -126,7 +186,7 @@ namespace framedot::ecs::systems {
                     auto view = reg.view<const framedot::ecs::Transform2D,
                                         const framedot::ecs::Text2D>();
                     for (auto e : view) {
-                        if (tc >= texts.size()) break;
+                        if (tc >= max_items) break;
 
                         const auto& t = view.get<const framedot::ecs::Transform2D>(e);
                         const auto& tx = view.get<const framedot::ecs::Text2D>(e);
@@ -138,15 +198,18 @@ namespace framedot::ecs::systems {
                             sort_key = ro->sort_key;
                         }
 
+                        const Placement2D pl = placement_2d(reg, e, t);
+
                         TextItem it{};
-                        it.x = (int)t.position.x;
-                        it.y = (int)t.position.y;
+                        it.x = pl.x;
+                        it.y = pl.y;
                         it.text = tx.text.data();
                         it.len = tx.len;
                         it.color = tx.color;
                         it.scale = (tx.scale == 0) ? 1 : tx.scale;
                         it.sort_key = sort_key;
-                        texts[tc++] = it;
+                        texts.push_back(it);
+                        ++tc;
                     }
                 }
 
@@ -189,7 +252,14 @@ namespace framedot::ecs::systems {
                 });
 
                 run_chunks(sprites, sc, [&](const SpriteItem& it) noexcept {
-                    rq->blit_sprite(it.x, it.y, it.pixels, it.w, it.h, it.stride, it.tint, it.sort_key);
+                    if (it.texture) {
+                        if (it.affine) rq->blit_texture_affine(it.m, *ctx.textures, it.texture, it.tint, it.filter, it.sort_key);
+                        else           rq->blit_texture(it.x, it.y, *ctx.textures, it.texture, it.tint, it.sort_key);
+                    } else if (it.affine) {
+                        rq->blit_sprite_affine(it.m, it.pixels, it.w, it.h, it.stride, it.tint, it.filter, it.sort_key);
+                    } else {
+                        rq->blit_sprite(it.x, it.y, it.pixels, it.w, it.h, it.stride, it.tint, it.sort_key);
+                    }
                 });
 
                 run_chunks(texts, tc, [&](const TextItem& it) noexcept {
@@ -0,0 +1,214 @@
+// include/framedot/ecs/systems/TransformHierarchy2D.hpp
+/**
+ * @file TransformHierarchy2D.hpp
+ * @brief Parent2D/Children2D 계층을 따라 WorldTransform2D를 갱신하는 전파 시스템.
+ *
+ * 설계 포인트:
+ * - 루트부터 깊이(level) 단위 BFS. 같은 level의 엔티티는 서로 독립이므로 워커로 병렬 처리한다.
+ * - 부모는 항상 이전 level에서 확정되므로 level 사이에만 배리어가 필요하다.
+ * - dirty 판정: 로컬 Transform2D가 캐시와 다르거나, 부모 revision이 바뀐 경우에만 재계산.
+ *   (변하지 않은 서브트리는 비교만 하고 행렬 곱을 건너뛴다)
+ * - 행렬은 glm mat4가 아니라 2D 아핀 Mat3f 경로를 사용한다.
+ * - 설치 시 on_destroy<Parent2D> 훅을 연결한다. child가 파괴되거나 Parent2D가 제거되면
+ *   형제 링크를 먼저 복구하므로, 자식 순회가 죽은 링크에서 끊기지 않는다.
+ */
+#pragma once
+#include <framedot/core/Tasks.hpp>
+#include <framedot/ecs/World.hpp>
+#include <framedot/ecs/components/Basic2D.hpp>
+#include <framedot/ecs/components/Hierarchy2D.hpp>
+#include <framedot/math/Types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace framedot::ecs::systems {
+
+    /// @brief 순환 링크 등 잘못된 계층에서 무한 루프를 막기 위한 최대 깊이
+    static constexpr std::size_t kMaxHierarchyDepth = 1024;
+
+    /// @brief level 하나를 병렬로 나눌 최소 엔티티 수 (이보다 작으면 메인에서 처리)
+    static constexpr std::size_t kHierarchyParallelMin = 512;
+
+    /// @brief Parent2D가 제거되기 직전 형제 링크/부모 헤드를 복구한다. (on_destroy<Parent2D> 훅)
+    /// - entity 파괴나 reg.remove<Parent2D>로 링크가 사라져도 형제 목록이 끊기지 않게 한다.
+    /// - 분리 후 링크를 비워 두므로 같은 child에 다시 호출돼도 무해하다.
+    inline void unlink_parent_2d(World::Registry& reg, entt::entity child) {
+        auto* link = reg.try_get<Parent2D>(child);
+        if (!link) return;
+
+        const entt::entity parent = link->parent;
+        Children2D* head = (parent != entt::null && reg.valid(parent)) ? reg.try_get<Children2D>(parent) : nullptr;
+
+        if (link->prev_sibling != entt::null && reg.valid(link->prev_sibling)) {
+            if (auto* prev = reg.try_get<Parent2D>(link->prev_sibling)) prev->next_sibling = link->next_sibling;
+        } else if (head && head->first == child) {
+            head->first = link->next_sibling;
+        }
+
+        if (link->next_sibling != entt::null && reg.valid(link->next_sibling)) {
+            if (auto* next = reg.try_get<Parent2D>(link->next_sibling)) next->prev_sibling = link->prev_sibling;
+        }
+
+        if (head && head->count > 0) --head->count;
+
+        *link = Parent2D{};
+    }
+
+    /// @brief child를 부모 목록에서 분리한다. (Parent2D 제거, 형제 링크 복구)
+    inline void detach_from_parent(World::Registry& reg, entt::entity child) {
+        if (!reg.valid(child) || !reg.try_get<Parent2D>(child)) return;
+
+        unlink_parent_2d(reg, child);
+        reg.remove<Parent2D>(child);
+        if (auto* wt = reg.try_get<WorldTransform2D>(child)) wt->dirty = 1;
+    }
+
+    /// @brief child를 parent 아래에 붙인다. (기존 부모에서는 분리)
+    /// @return parent가 child의 자손이라 순환이 생기는 경우 false
+    inline bool attach_child(World::Registry& reg, entt::entity parent, entt::entity child) {
+        if (parent == child || !reg.valid(parent) || !reg.valid(child)) return false;
+
+        // 순환 검사: parent의 조상 중에 child가 있으면 거부
+        std::size_t depth = 0;
+        for (entt::entity a = parent; a != entt::null && reg.valid(a) && depth < kMaxHierarchyDepth; ++depth) {
+            if (a == child) return false;
+            const auto* up = reg.try_get<Parent2D>(a);
+            a = up ? up->parent : entt::null;
+        }
+
+        detach_from_parent(reg, child);
+
+        auto& head = reg.get_or_emplace<Children2D>(parent);
+        Parent2D link{};
+        link.parent = parent;
+        link.next_sibling = head.first;
+        if (head.first != entt::null) {
+            reg.get<Parent2D>(head.first).prev_sibling = child;
+        }
+        head.first = child;
+        ++head.count;
+
+        reg.emplace_or_replace<Parent2D>(child, link);
+        reg.get_or_emplace<WorldTransform2D>(parent);
+        reg.get_or_emplace<WorldTransform2D>(child).dirty = 1;
+        return true;
+    }
+
+    inline bool same_local_2d_(const Transform2D& a, const Transform2D& b) noexcept {
+        return a.position.x == b.position.x && a.position.y == b.position.y
+            && a.scale.x == b.scale.x && a.scale.y == b.scale.y
+            && a.rotation_rad == b.rotation_rad;
+    }
+
+    /// @brief 계층 전파 시스템 설치 (기본: PostUpdate, 게임 로직 이후 RenderPrep 이전)
+    /// - Transform2D + WorldTransform2D를 가진 엔티티만 대상
+    /// - 부모가 없거나(또는 부모가 WorldTransform2D/Transform2D가 없으면) 루트로 취급
+    inline void install_transform_hierarchy_2d(World& world, Phase phase = Phase::PostUpdate) {
+        struct State {
+            std::vector<entt::entity> level;
+            std::vector<entt::entity> next;
+            std::vector<std::vector<entt::entity>> chunk_children;
+        };
+
+        // 파괴/제거된 child가 형제 목록을 끊지 않도록 (같은 훅은 중복 연결되지 않는다)
+        world.registry().on_destroy<Parent2D>().connect<&unlink_parent_2d>();
+
+        world.add_write_system(phase,
+            [st = State{}](const framedot::core::FrameContext& ctx, World::Registry& reg) mutable {
+                // 스토리지는 메인에서 미리 확보 (병렬 구간에서 pool 생성 금지)
+                auto& tr  = reg.storage<Transform2D>();
+                auto& wt  = reg.storage<WorldTransform2D>();
+                auto& par = reg.storage<Parent2D>();
+                auto& chl = reg.storage<Children2D>();
+
+                // ----------------------------
+                // 1) 루트 수집
+                // ----------------------------
+                st.level.clear();
+                for (auto e : reg.view<const Transform2D, WorldTransform2D>()) {
+                    if (par.contains(e)) {
+                        const entt::entity p = par.get(e).parent;
+                        if (reg.valid(p) && tr.contains(p) && wt.contains(p)) continue;
+                    }
+                    st.level.push_back(e);
+                }
+
+                const bool can_parallel = ctx.jobs && ctx.jobs->worker_count() > 0;
+                const std::size_t chunks = can_parallel ? (std::size_t)ctx.jobs->worker_count() : 1;
+                if (st.chunk_children.size() < chunks) st.chunk_children.resize(chunks);
+
+                // e 하나 갱신 + 자식 수집
+                auto visit = [&](entt::entity e, bool root, std::vector<entt::entity>& out) noexcept {
+                    auto& w = wt.get(e);
+                    const auto& t = tr.get(e);
+                    const WorldTransform2D* pw = root ? nullptr : &wt.get(par.get(e).parent);
+
+                    // 루트인데 parent_revision이 남아 있으면 부모가 파괴돼 루트가 된 경우
+                    const bool parent_changed = pw ? (pw->revision != w.parent_revision) : (w.parent_revision != 0u);
+                    if (w.dirty || parent_changed || !same_local_2d_(w.local, t)) {
+                        const framedot::math::Mat3f local =
+                            framedot::math::make_affine_2d(t.position, t.rotation_rad, t.scale);
+                        w.world = pw ? framedot::math::mul_affine(pw->world, local) : local;
+                        w.local = t;
+                        w.parent_revision = pw ? pw->revision : 0u;
+                        ++w.revision;
+                        w.dirty = 0;
+                    }
+
+                    if (!chl.contains(e)) return;
+                    entt::entity c = chl.get(e).first;
+                    // 링크는 on_destroy 훅이 유지한다. 여기서 끊기면 직접 수정된 링크이므로 나머지를 버린다
+                    for (std::size_t guard = 0; c != entt::null && guard < chl.get(e).count; ++guard) {
+                        if (!par.contains(c)) break;
+                        const auto& link = par.get(c);
+                        if (link.parent != e) break;
+                        if (tr.contains(c) && wt.contains(c)) out.push_back(c);
+                        c = link.next_sibling;
+                    }
+                };
+
+                // ----------------------------
+                // 2) level 단위 BFS (level 내부 병렬)
+                // ----------------------------
+                bool root = true;
+                for (std::size_t depth = 0; !st.level.empty() && depth < kMaxHierarchyDepth; ++depth) {
+                    const std::size_t n = st.level.size();
+                    st.next.clear();
+
+                    if (can_parallel && n >= kHierarchyParallelMin) {
+                        const std::size_t chunk_size = (n + chunks - 1) / chunks;
+                        {
+                            framedot::core::TaskGroup tg(ctx.jobs, framedot::core::JobLane::Engine);
+                            for (std::size_t ci = 0; ci < chunks; ++ci) {
+                                const std::size_t b = ci * chunk_size;
+                                const std::size_t e = (b + chunk_size < n) ? (b + chunk_size) : n;
+                                auto& out = st.chunk_children[ci];
+                                out.clear();
+                                if (b >= e) continue;
+
+                                tg.run([&, b, e, root]() noexcept {
+                                    for (std::size_t i = b; i < e; ++i) visit(st.level[i], root, out);
+                                });
+                            }
+                            tg.wait();
+                        }
+
+                        // chunk 순서대로 이어붙여 다음 level 순서를 결정적으로 유지
+                        for (std::size_t ci = 0; ci < chunks; ++ci) {
+                            const auto& out = st.chunk_children[ci];
+                            st.next.insert(st.next.end(), out.begin(), out.end());
+                        }
+                    } else {
+                        for (std::size_t i = 0; i < n; ++i) visit(st.level[i], root, st.next);
+                    }
+
+                    st.level.swap(st.next);
+                    root = false;
+                }
+            }
+        );
+    }
+
+} // namespace framedot::ecs::systems
@@ -5,6 +5,11 @@
 #include <framedot/gfx/Color.hpp>
 #include <framedot/gfx/PixelCanvas.hpp>
 #include <framedot/gfx/PixelFrame.hpp>
+#include <framedot/gfx/Rect.hpp>
+#include <framedot/gfx/SpriteAffine.hpp>
+#include <framedot/gfx/TextureCache.hpp>
+#include <framedot/gfx/CommandRecorder.hpp>
+#include <framedot/gfx/DisplayList.hpp>
 #include <framedot/gfx/RenderQueue.hpp>
 #include <framedot/gfx/SoftwareRenderer.hpp>
 #include <framedot/rhi/Surface.hpp>
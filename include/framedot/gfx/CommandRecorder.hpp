@@ -0,0 +1,464 @@
+// include/framedot/gfx/CommandRecorder.hpp
+/**
+ * @file CommandRecorder.hpp
+ * @brief 그리기 커맨드 형식(DrawOp/DrawCmd)과 RenderQueue/DisplayList가 공유하는 기록 API.
+ *
+ * 설계 포인트:
+ * - CommandRecorder<Derived>는 CRTP로 커맨드를 조립만 하고, 저장은 Derived가 맡는다.
+ *   Derived 요구 사항:
+ *     bool record_(const DrawCmd&, std::uintptr_t p0, std::uintptr_t p1) noexcept;
+ *     bool store_text_(std::string_view utf8, std::uint32_t& ofs) noexcept;  // '\0' 포함 복사
+ *     bool store_affine_(const SpriteAffine&, std::uint32_t& index) noexcept;
+ *     bool store_vertices_(std::span<const PointI>, std::uint32_t& ofs) noexcept;
+ *     std::uint16_t add_clip_(const RectI&) noexcept;    // clip 등록 -> id (실패 시 kClipEmpty)
+ *     std::uint16_t clip_() const noexcept;              // 현재 clip id
+ *     void set_clip_(std::uint16_t) noexcept;
+ *     RectI clip_rect(std::uint16_t id) const noexcept;
+ * - RenderQueue(프레임당, MPSC)와 DisplayList(한 번 기록, 재사용)가 같은 API로 기록한다.
+ * - blit_texture*()는 TextureCache handle을 기록 시 Texture*로 풀어 스프라이트 커맨드의 payload1에 둔다.
+ *   렌더러는 Texture의 분류/premultiplied 사본을 바로 쓴다 (스프라이트 캐시 조회 없음).
+ * - fill_polygon()/fill_triangle()은 꼭짓점을 vertex arena에 복사하고 커맨드는 (오프셋, 개수)만 가진다.
+ *   렌더러는 타일마다 그 타일 행에 걸친 변만 골라 edge table 스캔라인으로 채운다.
+ * - clip: push_clip()/pop_clip() 또는 ClipScope. 기록되는 커맨드는 현재 clip id를 u1에 가진다.
+ *   중첩 clip은 바깥 clip과의 교집합으로 등록된다. 렌더러는 binning 단계에서 커맨드 영역을 clip으로 자르므로
+ *   완전히 잘린 커맨드는 타일에 들어가지 않는다.
+ */
+#pragma once
+#include <framedot/gfx/Color.hpp>
+#include <framedot/gfx/Rect.hpp>
+#include <framedot/gfx/SpriteAffine.hpp>
+#include <framedot/gfx/TextureCache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+
+namespace framedot::gfx {
+
+    enum class DrawOp : std::uint8_t {
+        Clear = 0,
+        PutPixel,
+        FillRect,
+        RectOutline,
+        Line,
+        HLine,
+        VLine,
+        BlendRect,
+        FillCircle,
+        Circle,
+        BlitSprite,  // RGBA8888 블릿 (payload0 = pixels, payload1 = const Texture* 또는 0)
+        Text,        // debug text (ASCII/UTF-8 raw)
+        FillRectInstanced,    // payload0 = const Instance*
+        BlitSpriteInstanced,  // payload0 = const Instance*, payload1 = pixels
+        DrawList,             // payload0 = const DisplayList* (RenderQueue 전용)
+        BlitSpriteAffine,     // payload0 = pixels, payload1 = const Texture* 또는 0, x0 = SpriteAffine 인덱스
+        FillPolygon,          // 꼭짓점은 vertex arena (x0 = 오프셋, x1 = 개수)
+    };
+
+    /// @brief DrawOp 개수 (op별 배열 크기)
+    inline constexpr std::size_t kDrawOpCount = (std::size_t)DrawOp::FillPolygon + 1;
+
+    struct DrawCmd {
+        DrawOp op{};
+        std::uint8_t flags{0};   // kFlag* (기존 padding 자리)
+        ColorRGBA8 color{0, 0, 0, 255};
+        std::uint32_t sort_key{0};
+
+        // 공통 좌표:
+        // - rect: (x0,y0,w=x1,h=y1)
+        // - line: (x0,y0)-(x1,y1)
+        // - circle: center=(x0,y0), radius=x1
+        //
+        // - text: (x0,y0), x1=text_offset, y1=text_len
+        // - sprite: (x0,y0,w=x1,h=y1), u0=stride_pixels
+        // - instanced: x0=instance_count, (w=x1,h=y1), sprite면 u0=stride_pixels
+        // - draw list: offset=(x0,y0)
+        // - affine sprite: x0=affine index, (w=x1,h=y1), u0=stride_pixels
+        // - polygon: x0=vertex offset, x1=vertex count
+        std::int32_t x0{0}, y0{0};
+        std::int32_t x1{0}, y1{0};
+
+        // 옵션/플래그 확장
+        std::uint16_t u0{0};
+        std::uint16_t u1{0};   // clip id (0 = 없음)
+    };
+
+    /// @brief 인스턴스 op의 항목 하나 (위치 + 인스턴스별 색/tint)
+    struct Instance {
+        std::int32_t x{0}, y{0};
+        ColorRGBA8 color{255, 255, 255, 255};   // kFlagInstanceColor일 때만 사용
+    };
+
+    template <class Derived>
+    class CommandRecorder {
+    public:
+        using Op = DrawOp;
+        using Cmd = DrawCmd;
+
+        /// @brief Cmd::flags: 인스턴스별 color를 쓴다 (없으면 cmd.color 공통)
+        static constexpr std::uint8_t kFlagInstanceColor = 1u << 0;
+
+        /// @brief Cmd::flags: affine 스프라이트를 bilinear로 샘플링 (없으면 nearest)
+        static constexpr std::uint8_t kFlagBilinear = 1u << 1;
+
+        /// @brief clip id: 없음 / 전부 잘림(빈 교집합 또는 등록 실패)
+        static constexpr std::uint16_t kNoClip = 0;
+        static constexpr std::uint16_t kClipEmpty = 0xFFFFu;
+
+        /// @brief fill_polygon 꼭짓점 좌표 범위 (변 계산이 int64에 들어가도록)
+        static constexpr std::int32_t kPolygonCoordLimit = 1 << 28;
+
+        /// @brief 현재 clip id (이후 기록되는 커맨드에 붙는다)
+        std::uint16_t clip() const noexcept { return derived_().clip_(); }
+
+        /**
+         * @brief 현재 clip과 r의 교집합을 새 clip으로 설정. 교집합이 비면 이후 커맨드는 기록되지 않는다
+         * @return 이전 clip id (pop_clip에 넘긴다)
+         */
+        std::uint16_t push_clip(const RectI& r) noexcept {
+            const std::uint16_t prev = derived_().clip_();
+            const RectI cur = derived_().clip_rect(prev).intersect(r);
+            derived_().set_clip_(cur.empty() ? kClipEmpty : derived_().add_clip_(cur));
+            return prev;
+        }
+
+        void pop_clip(std::uint16_t prev) noexcept { derived_().set_clip_(prev); }
+
+        bool clear(ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::Clear;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            return push_(cmd);
+        }
+
+        bool put_pixel(std::int32_t x, std::int32_t y, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::PutPixel;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y;
+            return push_(cmd);
+        }
+
+        bool fill_rect(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h,
+                       ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::FillRect;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y; cmd.x1 = w; cmd.y1 = h;
+            return push_(cmd);
+        }
+
+        bool rect_outline(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h,
+                          std::uint16_t thickness_px,
+                          ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::RectOutline;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y; cmd.x1 = w; cmd.y1 = h;
+            cmd.u0 = thickness_px;
+            return push_(cmd);
+        }
+
+        bool line(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1,
+                  ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::Line;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x0; cmd.y0 = y0; cmd.x1 = x1; cmd.y1 = y1;
+            return push_(cmd);
+        }
+
+        bool blend_rect(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h,
+                        ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::BlendRect;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y; cmd.x1 = w; cmd.y1 = h;
+            return push_(cmd);
+        }
+
+        bool fill_circle(std::int32_t cx, std::int32_t cy, std::int32_t radius,
+                         ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::FillCircle;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = cx; cmd.y0 = cy; cmd.x1 = radius;
+            return push_(cmd);
+        }
+
+        bool circle(std::int32_t cx, std::int32_t cy, std::int32_t radius,
+                    ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::Circle;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = cx; cmd.y0 = cy; cmd.x1 = radius;
+            return push_(cmd);
+        }
+
+        bool hline(std::int32_t x0, std::int32_t x1, std::int32_t y, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::HLine;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x0; cmd.y0 = y; cmd.x1 = x1;
+            return push_(cmd);
+        }
+
+        bool vline(std::int32_t x, std::int32_t y0, std::int32_t y1, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            Cmd cmd{};
+            cmd.op = Op::VLine;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y0; cmd.y1 = y1;
+            return push_(cmd);
+        }
+
+        // ---- Sprite ----
+        // pixels: RGBA8888 (0xRRGGBBAA), stride_pixels >= w
+        // color: tint(곱) + alpha(추가) 용도로 사용(일단 간단히: src*color)
+        bool blit_sprite(std::int32_t x, std::int32_t y,
+                         const std::uint32_t* pixels,
+                         std::int32_t w, std::int32_t h,
+                         std::uint16_t stride_pixels,
+                         ColorRGBA8 tint,
+                         std::uint32_t sort_key = 0) noexcept {
+            if (!pixels || w <= 0 || h <= 0) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::BlitSprite;
+            cmd.color = tint;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y;
+            cmd.x1 = w; cmd.y1 = h;
+            cmd.u0 = stride_pixels;
+            return submit_(cmd, (std::uintptr_t)pixels, 0);
+        }
+
+        /**
+         * @brief 스프라이트를 affine 변환(스케일/회전/반전)해 블릿한다
+         * @param m 스프라이트 로컬 픽셀 좌표 -> 화면 좌표 (math::make_affine_2d, WorldTransform2D::world 등)
+         * @return 역행렬이 없거나 좌표 범위를 넘는 변환이면 false
+         */
+        bool blit_sprite_affine(const framedot::math::Mat3f& m,
+                                const std::uint32_t* pixels,
+                                std::int32_t w, std::int32_t h,
+                                std::uint16_t stride_pixels,
+                                ColorRGBA8 tint,
+                                SampleFilter filter = SampleFilter::Nearest,
+                                std::uint32_t sort_key = 0) noexcept {
+            if (!pixels || w <= 0 || h <= 0) return false;
+            return affine_(m, pixels, w, h, stride_pixels, tint, filter, sort_key, 0);
+        }
+
+        // ---- Texture (TextureCache handle) ----
+        // 텍스처는 렌더가 끝날 때까지 제거/갱신하면 안 된다. 없는 handle이면 false
+        bool blit_texture(std::int32_t x, std::int32_t y,
+                          const TextureCache& cache, TextureHandle tex,
+                          ColorRGBA8 tint,
+                          std::uint32_t sort_key = 0) noexcept {
+            const Texture* t = cache.get(tex);
+            if (!t) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::BlitSprite;
+            cmd.color = tint;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y;
+            cmd.x1 = t->w; cmd.y1 = t->h;
+            cmd.u0 = (std::uint16_t)t->stride;
+            return submit_(cmd, (std::uintptr_t)t->pixels, (std::uintptr_t)t);
+        }
+
+        bool blit_texture_affine(const framedot::math::Mat3f& m,
+                                 const TextureCache& cache, TextureHandle tex,
+                                 ColorRGBA8 tint,
+                                 SampleFilter filter = SampleFilter::Nearest,
+                                 std::uint32_t sort_key = 0) noexcept {
+            const Texture* t = cache.get(tex);
+            if (!t) return false;
+            return affine_(m, t->pixels, t->w, t->h, (std::uint16_t)t->stride, tint, filter, sort_key, (std::uintptr_t)t);
+        }
+
+        // ---- Polygon ----
+        /**
+         * @brief 다각형 채우기 (nonzero 규칙, 자기 교차/오목 허용). 픽셀 중심이 안쪽이면 칠한다
+         * @note 변을 공유하는 다각형끼리는 겹치거나 틈이 생기지 않는다. 알파 255면 채우기, 아니면 blend.
+         *       꼭짓점은 복사되며 좌표는 ±2^28 이내여야 한다
+         */
+        bool fill_polygon(std::span<const PointI> vertices, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            if (vertices.size() < 3 || vertices.size() > 0x7FFFFFFFu) return false;
+            for (const PointI& v : vertices) {
+                if (v.x < -kPolygonCoordLimit || v.x > kPolygonCoordLimit
+                    || v.y < -kPolygonCoordLimit || v.y > kPolygonCoordLimit) return false;
+            }
+            if (derived_().clip_() == kClipEmpty) return true;
+
+            std::uint32_t ofs = 0;
+            if (!derived_().store_vertices_(vertices, ofs)) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::FillPolygon;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = (std::int32_t)ofs;
+            cmd.x1 = (std::int32_t)vertices.size();
+            return submit_(cmd, 0, 0);
+        }
+
+        bool fill_triangle(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1,
+                           std::int32_t x2, std::int32_t y2,
+                           ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+            const PointI v[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+            return fill_polygon(v, c, sort_key);
+        }
+
+        // ---- Instanced ----
+        // instances: 호출자 소유(RenderQueue면 alloc_instances() 결과도 가능). 렌더가 끝날 때까지 유지되어야 한다.
+        // per_instance_color면 Instance::color를 색/tint로 쓰고, 아니면 c/tint를 공통으로 쓴다.
+        bool fill_rect_instanced(std::span<const Instance> instances,
+                                 std::int32_t w, std::int32_t h,
+                                 ColorRGBA8 c, bool per_instance_color = false,
+                                 std::uint32_t sort_key = 0) noexcept {
+            if (instances.empty() || instances.size() > 0x7FFFFFFFu || w <= 0 || h <= 0) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::FillRectInstanced;
+            cmd.flags = per_instance_color ? kFlagInstanceColor : 0;
+            cmd.color = c;
+            cmd.sort_key = sort_key;
+            cmd.x0 = (std::int32_t)instances.size();
+            cmd.x1 = w; cmd.y1 = h;
+            return submit_(cmd, (std::uintptr_t)instances.data(), 0);
+        }
+
+        bool blit_sprite_instanced(std::span<const Instance> instances,
+                                   const std::uint32_t* pixels,
+                                   std::int32_t w, std::int32_t h,
+                                   std::uint16_t stride_pixels,
+                                   ColorRGBA8 tint, bool per_instance_color = false,
+                                   std::uint32_t sort_key = 0) noexcept {
+            if (instances.empty() || instances.size() > 0x7FFFFFFFu || !pixels || w <= 0 || h <= 0) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::BlitSpriteInstanced;
+            cmd.flags = per_instance_color ? kFlagInstanceColor : 0;
+            cmd.color = tint;
+            cmd.sort_key = sort_key;
+            cmd.x0 = (std::int32_t)instances.size();
+            cmd.x1 = w; cmd.y1 = h;
+            cmd.u0 = stride_pixels;
+            return submit_(cmd, (std::uintptr_t)instances.data(), (std::uintptr_t)pixels);
+        }
+
+        // ---- Text ----
+        bool text(std::int32_t x, std::int32_t y,
+                std::string_view utf8,
+                ColorRGBA8 color,
+                std::uint32_t sort_key,
+                std::uint8_t scale) noexcept
+        {
+            if (utf8.empty()) return true;
+
+            std::uint32_t ofs = 0;
+            if (!derived_().store_text_(utf8, ofs)) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::Text;
+            cmd.color = color;
+            cmd.sort_key = sort_key;
+            cmd.x0 = x; cmd.y0 = y;
+            cmd.x1 = (std::int32_t)ofs;
+            cmd.y1 = (std::int32_t)utf8.size();
+            cmd.u0 = (std::uint16_t)((scale == 0) ? 1 : scale); // ★ scale 저장
+            return push_(cmd);
+        }
+
+        bool text(
+            std::int32_t x, std::int32_t y,
+            std::string_view utf8,
+            ColorRGBA8 color,
+            std::uint32_t sort_key = 0
+        ) noexcept {
+            return text(x, y, utf8, color, sort_key, 1);
+        }
+
+    protected:
+        CommandRecorder() = default;
+        ~CommandRecorder() = default;
+
+        bool push_(const Cmd& c) noexcept { return submit_(c, 0, 0); }
+
+        /// @brief 역변환 레코드를 저장하고 affine 커맨드 기록 (p1 = const Texture* 또는 0)
+        bool affine_(const framedot::math::Mat3f& m, const std::uint32_t* pixels,
+                     std::int32_t w, std::int32_t h, std::uint16_t stride_pixels,
+                     ColorRGBA8 tint, SampleFilter filter, std::uint32_t sort_key, std::uintptr_t p1) noexcept {
+            if (derived_().clip_() == kClipEmpty) return true;
+
+            SpriteAffine a{};
+            if (!make_sprite_affine(m, w, h, a)) return false;
+
+            std::uint32_t index = 0;
+            if (!derived_().store_affine_(a, index)) return false;
+
+            Cmd cmd{};
+            cmd.op = Op::BlitSpriteAffine;
+            cmd.flags = (filter == SampleFilter::Bilinear) ? kFlagBilinear : 0;
+            cmd.color = tint;
+            cmd.sort_key = sort_key;
+            cmd.x0 = (std::int32_t)index;
+            cmd.x1 = w; cmd.y1 = h;
+            cmd.u0 = stride_pixels;
+            return submit_(cmd, (std::uintptr_t)pixels, p1);
+        }
+
+        /// @brief 현재 clip id를 붙여 기록. 전부 잘린 커맨드는 기록 없이 성공
+        bool submit_(Cmd c, std::uintptr_t p0, std::uintptr_t p1) noexcept {
+            c.u1 = derived_().clip_();
+            if (c.u1 == kClipEmpty) return true;
+            return derived_().record_(c, p0, p1);
+        }
+
+    private:
+        Derived& derived_() noexcept { return static_cast<Derived&>(*this); }
+        const Derived& derived_() const noexcept { return static_cast<const Derived&>(*this); }
+    };
+
+    /// @brief RAII clip: 생성 시 push_clip, 소멸 시 이전 clip 복원
+    template <class Recorder>
+    class ClipScope {
+    public:
+        ClipScope(Recorder& r, const RectI& rect) noexcept : m_r(r), m_prev(r.push_clip(rect)) {}
+        ~ClipScope() { m_r.pop_clip(m_prev); }
+
+        ClipScope(const ClipScope&) = delete;
+        ClipScope& operator=(const ClipScope&) = delete;
+
+    private:
+        Recorder& m_r;
+        std::uint16_t m_prev;
+    };
+
+    // ---- sort_key helpers (z-index 대용) ----
+    constexpr std::uint32_t make_sort_key(std::uint8_t layer,
+                                         std::uint16_t order,
+                                         std::uint16_t tie = 0) noexcept {
+        return (std::uint32_t(layer) << 24)
+             | ((std::uint32_t(order) & 0x0FFFu) << 12)
+             | (std::uint32_t(tie) & 0x0FFFu);
+    }
+
+    constexpr std::uint8_t  sort_layer(std::uint32_t k) noexcept { return std::uint8_t((k >> 24) & 0xFFu); }
+    constexpr std::uint16_t sort_order(std::uint32_t k) noexcept { return std::uint16_t((k >> 12) & 0x0FFFu); }
+    constexpr std::uint16_t sort_tie  (std::uint32_t k) noexcept { return std::uint16_t((k >>  0) & 0x0FFFu); }
+
+} // namespace framedot::gfx
@@ -0,0 +1,168 @@
+// include/framedot/gfx/DisplayList.hpp
+/**
+ * @file DisplayList.hpp
+ * @brief 한 번 기록해 두고 매 프레임 RenderQueue::draw_list()로 재생하는 불변 커맨드 목록.
+ *
+ * 설계 포인트:
+ * - 기록 API는 RenderQueue와 같다 (CommandRecorder). 단일 스레드 기록, 용량 제한 없음.
+ * - clip은 리스트 로컬 좌표로 저장되고, 재생 시 오프셋만큼 옮겨진 뒤 draw_list 자체의 clip과 교차된다.
+ * - 텍스트, affine 역변환 레코드, 다각형 꼭짓점은 리스트가 복사해 소유한다. 스프라이트/인스턴스 배열은 외부 포인터 참조(수명은 유저가 보장).
+ * - 리스트 내부 순서는 커맨드 sort_key(안정) 기준이고, 리스트 전체는 draw_list()의 sort_key 위치에 그려진다.
+ * - SoftwareRenderer는 리스트별로 정렬 순서와 타일 인덱스를 캐시한다 (revision이 바뀌면 다시 만든다).
+ *   재생 비용은 커맨드 1개 + 타일별 bin 병합 정도다.
+ */
+#pragma once
+#include <framedot/gfx/CommandRecorder.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace framedot::gfx {
+
+    class DisplayList : public CommandRecorder<DisplayList> {
+    public:
+        DisplayList() noexcept : m_revision(next_revision_()) {}
+
+        DisplayList(const DisplayList&) = delete;
+        DisplayList& operator=(const DisplayList&) = delete;
+
+        /// @brief 이동 후 원본은 빈 리스트 (새 revision)
+        DisplayList(DisplayList&& o) noexcept
+            : m_cmds(std::move(o.m_cmds)), m_p0(std::move(o.m_p0)), m_p1(std::move(o.m_p1)),
+              m_text(std::move(o.m_text)), m_clips(std::move(o.m_clips)), m_clip(o.m_clip),
+              m_affines(std::move(o.m_affines)), m_vertices(std::move(o.m_vertices)),
+              m_revision(next_revision_()) {
+            o.reset();
+        }
+
+        DisplayList& operator=(DisplayList&& o) noexcept {
+            if (this != &o) {
+                m_cmds = std::move(o.m_cmds);
+                m_p0 = std::move(o.m_p0);
+                m_p1 = std::move(o.m_p1);
+                m_text = std::move(o.m_text);
+                m_clips = std::move(o.m_clips);
+                m_clip = o.m_clip;
+                m_affines = std::move(o.m_affines);
+                m_vertices = std::move(o.m_vertices);
+                m_revision = next_revision_();
+                o.reset();
+            }
+            return *this;
+        }
+
+        /// @brief 모든 커맨드 제거 (다시 기록할 때)
+        void reset() noexcept {
+            m_cmds.clear();
+            m_p0.clear();
+            m_p1.clear();
+            m_text.clear();
+            m_clips.clear();
+            m_clip = kNoClip;
+            m_affines.clear();
+            m_vertices.clear();
+            m_revision = next_revision_();
+        }
+
+        std::size_t size() const noexcept { return m_cmds.size(); }
+        bool empty() const noexcept { return m_cmds.empty(); }
+
+        /// @brief 내용이 바뀔 때마다 바뀌는 값 (프로세스 내 유일). 렌더러 캐시 무효화용
+        std::uint64_t revision() const noexcept { return m_revision; }
+
+        const Cmd* data() const noexcept { return m_cmds.data(); }
+        const Cmd& cmd(std::size_t i) const noexcept { return m_cmds[i]; }
+
+        std::uintptr_t payload0(std::size_t i) const noexcept { return m_p0[i]; }
+        std::uintptr_t payload1(std::size_t i) const noexcept { return m_p1[i]; }
+
+        /// @brief clip id -> 리스트 로컬 사각형 (kNoClip이면 무한)
+        RectI clip_rect(std::uint16_t id) const noexcept {
+            if (id == kNoClip) return RectI::unbounded();
+            if ((std::size_t)id > m_clips.size()) return RectI{};
+            return m_clips[id - 1u];
+        }
+
+        const char* text_data(std::uint32_t ofs) const noexcept {
+            if ((std::size_t)ofs >= m_text.size()) return "";
+            return &m_text[ofs];
+        }
+
+        /// @brief affine 인덱스 -> 리스트 로컬 좌표 역변환 레코드 (없으면 nullptr)
+        const SpriteAffine* affine_data(std::uint32_t index) const noexcept {
+            if ((std::size_t)index >= m_affines.size()) return nullptr;
+            return &m_affines[index];
+        }
+
+        /// @brief vertex 오프셋 -> 리스트 로컬 좌표 꼭짓점 n개 (범위 밖이면 nullptr)
+        const PointI* vertex_data(std::uint32_t ofs, std::uint32_t n) const noexcept {
+            if ((std::size_t)ofs + n > m_vertices.size()) return nullptr;
+            return m_vertices.data() + ofs;
+        }
+
+    private:
+        friend class CommandRecorder<DisplayList>;
+
+        bool record_(const Cmd& c, std::uintptr_t p0, std::uintptr_t p1) noexcept {
+            if (c.op == Op::DrawList || m_cmds.size() >= 0xFFFFFFFFu) return false;   // 중첩 리스트 미지원
+            m_cmds.push_back(c);
+            m_p0.push_back(p0);
+            m_p1.push_back(p1);
+            m_revision = next_revision_();
+            return true;
+        }
+
+        bool store_text_(std::string_view utf8, std::uint32_t& ofs) noexcept {
+            if (m_text.size() + utf8.size() + 1 > 0x7FFFFFFFu) return false;
+            ofs = (std::uint32_t)m_text.size();
+            m_text.insert(m_text.end(), utf8.begin(), utf8.end());
+            m_text.push_back('\0');
+            return true;
+        }
+
+        bool store_affine_(const SpriteAffine& a, std::uint32_t& index) noexcept {
+            if (m_affines.size() >= 0x7FFFFFFFu) return false;
+            index = (std::uint32_t)m_affines.size();
+            m_affines.push_back(a);
+            return true;
+        }
+
+        bool store_vertices_(std::span<const PointI> v, std::uint32_t& ofs) noexcept {
+            if (m_vertices.size() + v.size() > 0x7FFFFFFFu) return false;
+            ofs = (std::uint32_t)m_vertices.size();
+            m_vertices.insert(m_vertices.end(), v.begin(), v.end());
+            return true;
+        }
+
+        std::uint16_t add_clip_(const RectI& r) noexcept {
+            if (m_clips.size() >= (std::size_t)kClipEmpty - 1u) return kClipEmpty;
+            m_clips.push_back(r);
+            return (std::uint16_t)m_clips.size();
+        }
+
+        std::uint16_t clip_() const noexcept { return m_clip; }
+        void set_clip_(std::uint16_t id) noexcept { m_clip = id; }
+
+        static std::uint64_t next_revision_() noexcept {
+            static std::atomic<std::uint64_t> s_next{1};
+            return s_next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::vector<Cmd> m_cmds;
+        std::vector<std::uintptr_t> m_p0;
+        std::vector<std::uintptr_t> m_p1;
+        std::vector<char> m_text;
+        std::vector<RectI> m_clips;     // id - 1
+        std::uint16_t m_clip{kNoClip};
+        std::vector<SpriteAffine> m_affines;
+        std::vector<PointI> m_vertices;
+        std::uint64_t m_revision{0};
+    };
+
+} // namespace framedot::gfx
@@ -4,6 +4,10 @@
  * @brief 엔진 내부 소프트웨어 픽셀 버퍼(소유)와 기본 픽셀 연산 API를 제공한다.
  *
  * 출력 어댑터에는 PixelCanvas 자체를 넘기지 않고, PixelFrame(view)을 넘긴다.
+ *
+ * 픽셀 포맷은 기본 straight alpha(RGBA8888). set_format(RGBA8888Premul)로
+ * premultiplied 파이프라인을 켤 수 있다. API 입력 색(ColorRGBA8)은 항상 straight이며,
+ * 저장 시 포맷에 맞게 변환된다.
  */
 #pragma once
 #include <framedot/gfx/Color.hpp>
@@ -29,6 +33,12 @@ namespace framedot::gfx {
         std::uint32_t width()  const noexcept { return m_w; }
         std::uint32_t height() const noexcept { return m_h; }
 
+        PixelFormat format() const noexcept { return m_format; }
+        bool premultiplied() const noexcept { return m_format == PixelFormat::RGBA8888Premul; }
+
+        /// @brief 픽셀 포맷 변경. 기존 픽셀은 새 포맷으로 변환된다.
+        void set_format(PixelFormat f) noexcept;
+
         void clear(ColorRGBA8 c) noexcept;
         void put_pixel(std::int32_t x, std::int32_t y, ColorRGBA8 c) noexcept;
 
@@ -37,19 +47,23 @@ namespace framedot::gfx {
 
         static Pixel pack(ColorRGBA8 c) noexcept;
 
+        /// @brief 현재 포맷 기준 저장 값 (premultiplied면 RGB에 알파를 곱한다)
+        Pixel encode(ColorRGBA8 c) const noexcept;
+
         /// @brief 출력 어댑터용 불변 프레임 뷰 
         PixelFrame frame() const noexcept {
             PixelFrame f{};
             f.width = m_w;
             f.height = m_h;
             f.stride_pixels = m_w;
-            f.format = PixelFormat::RGBA8888;
+            f.format = m_format;
             f.pixels = std::span<const std::uint32_t>(m_pixels.data(), m_pixels.size());
             return f;
         }
 
     private:
         std::uint32_t m_w{0}, m_h{0};
+        PixelFormat m_format{PixelFormat::RGBA8888};
         std::vector<Pixel> m_pixels;
     };
 
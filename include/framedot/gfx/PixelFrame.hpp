@@ -15,7 +15,8 @@
 namespace framedot::gfx {
 
     enum class PixelFormat : std::uint8_t {
-        RGBA8888 = 0, // 0xRRGGBBAA (현재 PixelCanvas 규약)
+        RGBA8888 = 0,       // 0xRRGGBBAA (straight alpha, PixelCanvas 기본)
+        RGBA8888Premul = 1, // 0xRRGGBBAA, RGB에 알파가 미리 곱해짐 (PixelCanvas 옵션)
     };
 
     class PixelFrame {
@@ -37,8 +38,31 @@ namespace framedot::gfx {
         static constexpr std::uint8_t b(std::uint32_t p) noexcept { return (p >>  8) & 0xFF; }
         static constexpr std::uint8_t a(std::uint32_t p) noexcept { return (p >>  0) & 0xFF; }
 
+        bool premultiplied() const noexcept { return format == PixelFormat::RGBA8888Premul; }
+
+        /// @brief premultiplied 픽셀 -> straight (c * 255 / a, 반올림). a=0이면 0
+        static constexpr std::uint32_t unpremultiply(std::uint32_t p) noexcept {
+            const std::uint32_t al = a(p);
+            if (al == 255) return p;
+            if (al == 0) return 0;
+            auto div = [al](std::uint32_t c) -> std::uint32_t {
+                const std::uint32_t v = (c * 255 + al / 2) / al;
+                return v > 255 ? 255 : v;
+            };
+            return (div(r(p)) << 24) | (div(g(p)) << 16) | (div(b(p)) << 8) | al;
+        }
+
+        /**
+         * @brief 출력 어댑터용: format과 무관하게 straight alpha 픽셀을 돌려준다.
+         * @note straight 입력을 기대하는 어댑터만 호출. premultiplied 결과를 그대로
+         *       합성할 수 있는 어댑터는 pixels를 직접 쓰는 편이 싸다.
+         */
+        std::uint32_t straight(std::uint32_t p) const noexcept {
+            return premultiplied() ? unpremultiply(p) : p;
+        }
+
         /**
-         * @brief serialize (옵션): RGBA8888 raw bytes로 덤프한다.
+         * @brief serialize (옵션): RGBA8888 raw bytes로 덤프한다. (항상 straight alpha)
          * @note 기본 출력 경로는 serialize가 아니라 PixelFrame view를 사용하라.
          */
         std::vector<std::uint8_t> serialize_rgba8888() const {
@@ -52,7 +76,7 @@ namespace framedot::gfx {
             for (std::uint32_t y = 0; y < height; ++y) {
                 const std::size_t row = static_cast<std::size_t>(y) * stride_pixels;
                 for (std::uint32_t x = 0; x < width; ++x) {
-                    const std::uint32_t p = pixels[row + x];
+                    const std::uint32_t p = straight(pixels[row + x]);
                     out[di++] = r(p);
                     out[di++] = g(p);
                     out[di++] = b(p);
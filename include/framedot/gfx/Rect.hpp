@@ -0,0 +1,57 @@
+// include/framedot/gfx/Rect.hpp
+/**
+ * @file Rect.hpp
+ * @brief 정수 픽셀 사각형 [x0,x1) x [y0,y1)과 점. clip/damage 영역, 다각형 꼭짓점 표현용.
+ */
+#pragma once
+#include <cstdint>
+#include <limits>
+
+
+namespace framedot::gfx {
+
+    struct PointI {
+        std::int32_t x{0}, y{0};
+
+        constexpr bool operator==(const PointI&) const noexcept = default;
+    };
+
+    struct RectI {
+        std::int32_t x0{0}, y0{0};
+        std::int32_t x1{0}, y1{0};
+
+        static constexpr RectI from_xywh(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h) noexcept {
+            return RectI{x, y, x + w, y + h};
+        }
+
+        /// @brief 모든 좌표를 포함하는 사각형 (clip 없음)
+        static constexpr RectI unbounded() noexcept {
+            return RectI{std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::min(),
+                         std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::max()};
+        }
+
+        constexpr bool empty() const noexcept { return x0 >= x1 || y0 >= y1; }
+        constexpr std::int32_t width() const noexcept { return empty() ? 0 : x1 - x0; }
+        constexpr std::int32_t height() const noexcept { return empty() ? 0 : y1 - y0; }
+
+        constexpr bool contains(std::int32_t x, std::int32_t y) const noexcept {
+            return x >= x0 && x < x1 && y >= y0 && y < y1;
+        }
+
+        constexpr RectI intersect(const RectI& o) const noexcept {
+            return RectI{x0 > o.x0 ? x0 : o.x0, y0 > o.y0 ? y0 : o.y0,
+                         x1 < o.x1 ? x1 : o.x1, y1 < o.y1 ? y1 : o.y1};
+        }
+
+        /// @brief 두 사각형을 모두 포함하는 최소 사각형 (빈 쪽은 무시)
+        constexpr RectI unite(const RectI& o) const noexcept {
+            if (empty()) return o;
+            if (o.empty()) return *this;
+            return RectI{x0 < o.x0 ? x0 : o.x0, y0 < o.y0 ? y0 : o.y0,
+                         x1 > o.x1 ? x1 : o.x1, y1 > o.y1 ? y1 : o.y1};
+        }
+
+        constexpr bool operator==(const RectI&) const noexcept = default;
+    };
+
+} // namespace framedot::gfx
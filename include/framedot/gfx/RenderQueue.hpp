@@ -1,73 +1,146 @@
 // include/framedot/gfx/RenderQueue.hpp
 /**
  * @file RenderQueue.hpp
- * @brief RenderPrep 단계에서 무엇을 그릴지 기록하는 고정 용량 커맨드 큐.
+ * @brief RenderPrep 단계에서 무엇을 그릴지 기록하는 커맨드 큐.
  *
  * 설계 포인트:
  * - MPSC(멀티 프로듀서) push 안전
  * - 컨슈머(SoftwareRenderer)는 publish된 연속 구간만 읽는다.
- * - Text는 per-frame 고정 arena에 복사하여 수명 문제 제거
+ * - Text는 per-frame arena에 복사하여 수명 문제 제거
  * - Sprite는 외부 픽셀 포인터를 payload로 참조(수명은 유저가 보장)
+ * - 용량은 RenderQueueConfig로 정한다 (기본값은 CMake 캐시 변수 -> Config.hpp).
+ *   paged 모드면 슬롯을 2의 거듭제곱 크기 페이지로 나눠 필요할 때 할당한다.
+ *   페이지 할당은 CAS로 게시하므로 push는 락 없이 유지된다. 페이지는 프레임 간 재사용.
+ * - worker_segments 모드면 JobSystem 워커는 자기 세그먼트에만 기록한다(공유 atomic 없음).
+ *   세그먼트는 end_frame()에서 공유 저장소 뒤에 워커 순서로 이어 붙는다.
+ *   워커 번호는 잡 시스템마다 1부터라서, 세그먼트는 프레임마다 처음 기록한 잡 시스템(JobSystem::current_owner)이 갖는다.
+ *   다른 잡 시스템의 워커와 워커가 아닌 스레드(메인 등)는 기존 공유 경로를 쓴다. text arena는 항상 공유.
+ * - 인스턴스 op(FillRectInstanced/BlitSpriteInstanced)는 커맨드 1개로 N개의 rect/sprite를 그린다.
+ *   인스턴스 배열은 호출자 소유(수명은 유저가 보장)이거나 alloc_instances()로 받은 per-frame arena.
+ *   렌더러는 인스턴스 단위로 타일에 배분하므로 정렬/큐 비용은 커맨드 1개분이다.
+ * - 기록 API는 CommandRecorder(CRTP)로 DisplayList와 공유한다. draw_list()는 RenderQueue 전용.
+ * - clip 사각형은 per-frame 테이블(MPSC, atomic claim)에 등록되고 커맨드는 id(u1)만 가진다.
+ *   현재 clip은 (스레드, 큐)별 상태다(다른 스레드/잡이나 다른 큐의 push_clip과 섞이지 않는다). begin_frame()에서 초기화.
+ * - affine 스프라이트의 역변환 레코드(SpriteAffine)는 per-frame 테이블에 저장되고 커맨드는 인덱스만 가진다.
+ * - 다각형 꼭짓점은 per-frame vertex arena(MPSC, text arena와 같은 방식)에 복사된다.
  */
 #pragma once
+#include <framedot/core/Config.hpp>
+#include <framedot/core/JobSystem.hpp>
 #include <framedot/gfx/Color.hpp>
+#include <framedot/gfx/CommandRecorder.hpp>
 
-#include <array>
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 
 namespace framedot::gfx {
 
-    class RenderQueue {
+    class DisplayList;
+
+    /// @brief RenderQueue 용량 설정
+    struct RenderQueueConfig {
+        /// @brief 프레임당 최대 커맨드 수 (paged면 상한, 메모리는 쓴 만큼만)
+        std::size_t max_commands = framedot::core::config::render_queue_max_commands;
+
+        /// @brief 프레임당 text arena 바이트 (고정 할당)
+        std::size_t text_bytes = framedot::core::config::render_queue_text_bytes;
+
+        /// @brief true면 page_commands 단위로 필요할 때 확장
+        bool paged = false;
+
+        /// @brief 페이지당 커맨드 수 (2의 거듭제곱으로 올림)
+        std::size_t page_commands = framedot::core::config::render_queue_page_commands;
+
+        /// @brief true면 워커별 세그먼트에 기록하고 end_frame()에서 합친다
+        bool worker_segments = false;
+
+        /// @brief 프레임당 instance arena 항목 수 (alloc_instances, 고정 할당)
+        std::size_t instances = framedot::core::config::render_queue_instances;
+
+        /// @brief 프레임당 clip 사각형 수 (push_clip, 최대 0xFFFE). 넘치면 그 clip 안의 커맨드는 버려진다
+        std::size_t clips = 1024;
+
+        /// @brief 프레임당 affine 스프라이트 수 (blit_sprite_affine). 넘치면 dropped
+        std::size_t affine_sprites = 4096;
+
+        /// @brief 프레임당 vertex arena 꼭짓점 수 (fill_polygon/fill_triangle). 넘치면 dropped
+        std::size_t vertices = 16384;
+    };
+
+    class RenderQueue : public CommandRecorder<RenderQueue> {
     public:
-        enum class Op : std::uint8_t {
-            Clear = 0,
-            PutPixel,
-            FillRect,
-            RectOutline,
-            Line,
-            HLine,
-            VLine,
-            BlendRect,
-            FillCircle,
-            Circle,
-            BlitSprite,  // RGBA8888 블릿
-            Text,        // debug text (ASCII/UTF-8 raw)
-        };
+        /// @brief 기본 최대 커맨드 수 (RenderQueueConfig 기본값)
+        static constexpr std::size_t kMax = framedot::core::config::render_queue_max_commands;
+
+        /// @brief 기본 text arena 크기 (RenderQueueConfig 기본값)
+        static constexpr std::size_t kTextArenaBytes = framedot::core::config::render_queue_text_bytes;
+
+        RenderQueue() : RenderQueue(RenderQueueConfig{}) {}
+
+        explicit RenderQueue(const RenderQueueConfig& cfg) {
+            m_capacity = (cfg.max_commands > 0xFFFFFFFFu) ? 0xFFFFFFFFu : cfg.max_commands;
+            if (m_capacity == 0) m_capacity = 1;
+
+            if (cfg.paged) {
+                const std::size_t page = std::bit_ceil(cfg.page_commands < 64 ? std::size_t{64} : cfg.page_commands);
+                m_page_shift = (std::uint32_t)std::countr_zero(page);
+                m_page_size = (page < m_capacity) ? page : m_capacity;
+            } else {
+                // 단일 페이지: idx < capacity면 idx >> shift == 0
+                m_page_shift = (std::uint32_t)std::bit_width(m_capacity - 1);
+                m_page_size = m_capacity;
+            }
+            m_page_mask = ((std::size_t)1 << m_page_shift) - 1;
+            m_page_count = (m_capacity + ((std::size_t)1 << m_page_shift) - 1) >> m_page_shift;
 
-        struct Cmd {
-            Op op{};
-            ColorRGBA8 color{0, 0, 0, 255};
-            std::uint32_t sort_key{0};
-
-            // 공통 좌표:
-            // - rect: (x0,y0,w=x1,h=y1)
-            // - line: (x0,y0)-(x1,y1)
-            // - circle: center=(x0,y0), radius=x1
-            //
-            // - text: (x0,y0), x1=text_offset, y1=text_len
-            // - sprite: (x0,y0,w=x1,h=y1), u0=stride_pixels
-            std::int32_t x0{0}, y0{0};
-            std::int32_t x1{0}, y1{0};
-
-            // 옵션/플래그 확장
-            std::uint16_t u0{0};
-            std::uint16_t u1{0};
-        };
+            m_pages = std::make_unique<std::atomic<Page*>[]>(m_page_count);
+            m_pages[0].store(new Page(m_page_size), std::memory_order_relaxed);
 
-        static constexpr std::size_t kMax = 8192;
+            m_text.resize(cfg.text_bytes);
+            m_instances.resize(cfg.instances);
+            m_clips.resize(cfg.clips < (std::size_t)kClipEmpty - 1u ? cfg.clips : (std::size_t)kClipEmpty - 1u);
+            m_affines.resize(cfg.affine_sprites);
+            m_vertices.resize(cfg.vertices < 0x7FFFFFFFu ? cfg.vertices : 0x7FFFFFFFu);
 
-        // text arena (프레임당 고정)
-        static constexpr std::size_t kTextArenaBytes = 16 * 1024;
+            if (cfg.worker_segments) {
+                m_segments = std::make_unique<Segment[]>(framedot::core::config::max_worker_threads);
+                m_segment_count = framedot::core::config::max_worker_threads;
+            }
 
-        RenderQueue() {
-            // m_seq는 0으로 초기화되며, frame_id는 1부터 시작
+            // seq는 0으로 초기화되며, frame_id는 1부터 시작
             m_frame.store(1, std::memory_order_relaxed);
         }
 
+        ~RenderQueue() {
+            set_clip_(kNoClip);   // 이 스레드의 clip 항목 반환
+            for (std::size_t i = 0; i < m_page_count; ++i) delete m_pages[i].load(std::memory_order_relaxed);
+        }
+
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue& operator=(const RenderQueue&) = delete;
+
+        /// @brief 최대 커맨드 수
+        std::size_t capacity() const noexcept { return m_capacity; }
+
+        /// @brief text arena 크기
+        std::size_t text_capacity() const noexcept { return m_text.size(); }
+
+        /// @brief 할당된 페이지 수 (paged 모드 확장 확인용)
+        std::size_t pages_allocated() const noexcept {
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < m_page_count; ++i) n += (m_pages[i].load(std::memory_order_acquire) != nullptr);
+            return n;
+        }
+
         void begin_frame() noexcept {
             // frame_id 증가: 슬롯 clear 없이 이번 프레임에 준비되었는지를 seq 비교로 판별
             m_frame.fetch_add(1, std::memory_order_acq_rel);
@@ -76,223 +149,279 @@ namespace framedot::gfx {
             m_published.store(0, std::memory_order_release);
             m_dropped.store(0, std::memory_order_release);
             m_text_ofs.store(0, std::memory_order_release);
+            m_instance_ofs.store(0, std::memory_order_release);
+            m_clip_count.store(0, std::memory_order_release);
+            m_affine_count.store(0, std::memory_order_release);
+            m_vertex_ofs.store(0, std::memory_order_release);
+            m_clip_epoch.store(next_clip_epoch_(), std::memory_order_relaxed);   // 남은 스레드별 clip 무효화
+
+            for (std::size_t i = 0; i < m_segment_count; ++i) m_segments[i].clear();
+            m_segment_owner.store(nullptr, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 워커 세그먼트를 공유 저장소 뒤에 이어 붙인다 (worker_segments 모드).
+         * @note 모든 push가 끝난 뒤, 컨슈머가 읽기 전에 한 번 호출. 세그먼트가 없으면 no-op.
+         *       용량을 넘는 커맨드는 dropped()에 더해진다.
+         */
+        void end_frame() noexcept {
+            if (m_segment_count == 0) return;
+
+            std::size_t base = size();
+            std::uint32_t dropped = 0;
+
+            for (std::size_t si = 0; si < m_segment_count; ++si) {
+                Segment& sg = m_segments[si];
+                dropped += sg.dropped;
+
+                const std::size_t n = sg.cmds.size();
+                std::size_t k = 0;
+                while (k < n && base < m_capacity) {
+                    // 페이지 경계까지 한 번에 복사
+                    Page* pg = page_for_write_(base >> m_page_shift);
+                    const std::size_t j = base & m_page_mask;
+                    std::size_t run = m_page_size - j;
+                    if (run > n - k) run = n - k;
+                    if (run > m_capacity - base) run = m_capacity - base;
+
+                    std::copy_n(sg.cmds.data() + k, run, pg->cmds.data() + j);
+                    std::copy_n(sg.p0.data() + k, run, pg->p0.data() + j);
+                    std::copy_n(sg.p1.data() + k, run, pg->p1.data() + j);
+                    k += run;
+                    base += run;
+                }
+                dropped += (std::uint32_t)(n - k);
+                sg.clear();
+            }
+
+            m_claimed.store((std::uint32_t)base, std::memory_order_release);
+            m_published.store((std::uint32_t)base, std::memory_order_release);
+            if (dropped) m_dropped.fetch_add(dropped, std::memory_order_relaxed);
         }
 
         std::size_t size() const noexcept {
             const std::uint32_t p = m_published.load(std::memory_order_acquire);
-            return (p < (std::uint32_t)kMax) ? (std::size_t)p : kMax;
+            return ((std::size_t)p < m_capacity) ? (std::size_t)p : m_capacity;
         }
 
-        const Cmd* data() const noexcept { return m_cmds.data(); }
+        /// @brief 모든 커맨드가 한 페이지(연속 배열)에 있는지. true면 data()로 일괄 접근 가능
+        bool contiguous() const noexcept { return m_page_count == 1; }
+
+        /// @brief 첫 페이지 커맨드 배열. contiguous()일 때만 [0, size()) 전체가 유효
+        const Cmd* data() const noexcept { return page_(0)->cmds.data(); }
+
+        const Cmd& cmd(std::size_t i) const noexcept { return page_(i >> m_page_shift)->cmds[i & m_page_mask]; }
 
-        std::uintptr_t payload0(std::size_t i) const noexcept { return m_p0[i]; }
-        std::uintptr_t payload1(std::size_t i) const noexcept { return m_p1[i]; }
+        std::uintptr_t payload0(std::size_t i) const noexcept { return page_(i >> m_page_shift)->p0[i & m_page_mask]; }
+        std::uintptr_t payload1(std::size_t i) const noexcept { return page_(i >> m_page_shift)->p1[i & m_page_mask]; }
 
         std::uint32_t dropped() const noexcept {
             return m_dropped.load(std::memory_order_acquire);
         }
 
         const char* text_data(std::uint32_t ofs) const noexcept {
-            if (ofs >= (std::uint32_t)kTextArenaBytes) return "";
+            if ((std::size_t)ofs >= m_text.size()) return "";
             return &m_text[ofs];
         }
 
-        // ----------------------------
-        // API
-        // ----------------------------
-
-        bool clear(ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::Clear;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            return push_(cmd);
+        /// @brief clip id -> 화면 사각형 (kNoClip이면 무한). 이번 프레임에 등록된 id만 유효
+        RectI clip_rect(std::uint16_t id) const noexcept {
+            if (id == kNoClip) return RectI::unbounded();
+            if ((std::size_t)id > m_clips.size()) return RectI{};
+            return m_clips[id - 1u];
         }
 
-        bool put_pixel(std::int32_t x, std::int32_t y, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::PutPixel;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y;
-            return push_(cmd);
+        /// @brief affine 인덱스 -> 역변환 레코드. 이번 프레임에 기록된 인덱스만 유효 (아니면 nullptr)
+        const SpriteAffine* affine_data(std::uint32_t index) const noexcept {
+            if ((std::size_t)index >= m_affines.size()) return nullptr;
+            return &m_affines[index];
         }
 
-        bool fill_rect(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h,
-                       ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::FillRect;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y; cmd.x1 = w; cmd.y1 = h;
-            return push_(cmd);
+        /// @brief vertex arena 오프셋 -> 꼭짓점 n개. 이번 프레임에 기록된 구간만 유효 (아니면 nullptr)
+        const PointI* vertex_data(std::uint32_t ofs, std::uint32_t n) const noexcept {
+            if ((std::size_t)ofs + n > m_vertices.size()) return nullptr;
+            return m_vertices.data() + ofs;
         }
 
-        bool rect_outline(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h,
-                          std::uint16_t thickness_px,
-                          ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::RectOutline;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y; cmd.x1 = w; cmd.y1 = h;
-            cmd.u0 = thickness_px;
-            return push_(cmd);
-        }
+        /// @brief instance arena 크기
+        std::size_t instance_capacity() const noexcept { return m_instances.size(); }
 
-        bool line(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1,
-                  ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::Line;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x0; cmd.y0 = y0; cmd.x1 = x1; cmd.y1 = y1;
-            return push_(cmd);
-        }
-
-        bool blend_rect(std::int32_t x, std::int32_t y, std::int32_t w, std::int32_t h,
-                        ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::BlendRect;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y; cmd.x1 = w; cmd.y1 = h;
-            return push_(cmd);
+        /**
+         * @brief 이번 프레임 동안 유효한 인스턴스 배열 n개를 arena에서 받는다 (MPSC 안전)
+         * @return 부족하면 빈 span (dropped 증가)
+         */
+        std::span<Instance> alloc_instances(std::size_t n) noexcept {
+            if (n == 0) return {};
+            if (n > m_instances.size()) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            }
+            const std::uint32_t ofs = m_instance_ofs.fetch_add((std::uint32_t)n, std::memory_order_acq_rel);
+            if ((std::size_t)ofs + n > m_instances.size()) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            }
+            return std::span<Instance>(m_instances.data() + ofs, n);
         }
 
-        bool fill_circle(std::int32_t cx, std::int32_t cy, std::int32_t radius,
-                         ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
+        /**
+         * @brief DisplayList를 커맨드 1개로 제출한다. 리스트 전체가 sort_key 위치에서 리스트 내부 순서대로 그려진다.
+         * @param dx, dy 리스트 좌표에 더할 오프셋
+         * @note 리스트는 렌더가 끝날 때까지 살아 있어야 하고, 그동안 수정하면 안 된다.
+         */
+        bool draw_list(const DisplayList& list, std::int32_t dx, std::int32_t dy,
+                       std::uint32_t sort_key = 0) noexcept {
             Cmd cmd{};
-            cmd.op = Op::FillCircle;
-            cmd.color = c;
+            cmd.op = Op::DrawList;
             cmd.sort_key = sort_key;
-            cmd.x0 = cx; cmd.y0 = cy; cmd.x1 = radius;
-            return push_(cmd);
+            cmd.x0 = dx; cmd.y0 = dy;
+            return submit_(cmd, (std::uintptr_t)&list, 0);
         }
 
-        bool circle(std::int32_t cx, std::int32_t cy, std::int32_t radius,
-                    ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::Circle;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = cx; cmd.y0 = cy; cmd.x1 = radius;
-            return push_(cmd);
+        /// @brief draw_list + 화면 좌표 clip (현재 clip과 교차)
+        bool draw_list_clipped(const DisplayList& list, std::int32_t dx, std::int32_t dy, const RectI& clip,
+                               std::uint32_t sort_key = 0) noexcept {
+            const std::uint16_t prev = push_clip(clip);
+            const bool ok = draw_list(list, dx, dy, sort_key);
+            pop_clip(prev);
+            return ok;
         }
 
-        bool hline(std::int32_t x0, std::int32_t x1, std::int32_t y, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::HLine;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x0; cmd.y0 = y; cmd.x1 = x1;
-            return push_(cmd);
-        }
+    private:
+        friend class CommandRecorder<RenderQueue>;
 
-        bool vline(std::int32_t x, std::int32_t y0, std::int32_t y1, ColorRGBA8 c, std::uint32_t sort_key = 0) noexcept {
-            Cmd cmd{};
-            cmd.op = Op::VLine;
-            cmd.color = c;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y0; cmd.y1 = y1;
-            return push_(cmd);
+        bool record_(const Cmd& c, std::uintptr_t p0, std::uintptr_t p1) noexcept {
+            return push_payload_(c, p0, p1);
         }
 
-        // ---- Sprite ----
-        // pixels: RGBA8888 (0xRRGGBBAA), stride_pixels >= w
-        // color: tint(곱) + alpha(추가) 용도로 사용(일단 간단히: src*color)
-        bool blit_sprite(std::int32_t x, std::int32_t y,
-                         const std::uint32_t* pixels,
-                         std::int32_t w, std::int32_t h,
-                         std::uint16_t stride_pixels,
-                         ColorRGBA8 tint,
-                         std::uint32_t sort_key = 0) noexcept {
-            if (!pixels || w <= 0 || h <= 0) return false;
+        bool store_text_(std::string_view utf8, std::uint32_t& ofs) noexcept {
+            const std::uint32_t len = (std::uint32_t)utf8.size();
+            ofs = m_text_ofs.fetch_add(len + 1, std::memory_order_acq_rel);
+            if ((std::size_t)ofs + len + 1 > m_text.size()) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
 
-            Cmd cmd{};
-            cmd.op = Op::BlitSprite;
-            cmd.color = tint;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y;
-            cmd.x1 = w; cmd.y1 = h;
-            cmd.u0 = stride_pixels;
-            return push_payload_(cmd, (std::uintptr_t)pixels, 0);
+            std::memcpy(&m_text[ofs], utf8.data(), len);
+            m_text[ofs + len] = '\0';
+            return true;
         }
 
-        // ---- Text ----
-        bool text(std::int32_t x, std::int32_t y,
-                std::string_view utf8,
-                ColorRGBA8 color,
-                std::uint32_t sort_key,
-                std::uint8_t scale) noexcept
-        {
-            if (utf8.empty()) return true;
+        bool store_affine_(const SpriteAffine& a, std::uint32_t& index) noexcept {
+            index = m_affine_count.fetch_add(1, std::memory_order_acq_rel);
+            if ((std::size_t)index >= m_affines.size()) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            m_affines[index] = a;
+            return true;
+        }
 
-            const std::uint32_t len = (std::uint32_t)utf8.size();
-            const std::uint32_t ofs = m_text_ofs.fetch_add(len + 1, std::memory_order_acq_rel);
-            if (ofs + len + 1 > (std::uint32_t)kTextArenaBytes) {
+        bool store_vertices_(std::span<const PointI> v, std::uint32_t& ofs) noexcept {
+            const std::uint32_t n = (std::uint32_t)v.size();
+            ofs = m_vertex_ofs.fetch_add(n, std::memory_order_acq_rel);
+            if ((std::size_t)ofs + n > m_vertices.size()) {
                 m_dropped.fetch_add(1, std::memory_order_relaxed);
                 return false;
             }
+            std::copy(v.begin(), v.end(), m_vertices.begin() + ofs);
+            return true;
+        }
 
-            std::memcpy(&m_text[ofs], utf8.data(), len);
-            m_text[ofs + len] = '\0';
+        std::uint16_t add_clip_(const RectI& r) noexcept {
+            const std::uint32_t idx = m_clip_count.fetch_add(1, std::memory_order_acq_rel);
+            if ((std::size_t)idx >= m_clips.size()) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return kClipEmpty;
+            }
+            m_clips[idx] = r;
+            return (std::uint16_t)(idx + 1u);
+        }
 
-            Cmd cmd{};
-            cmd.op = Op::Text;
-            cmd.color = color;
-            cmd.sort_key = sort_key;
-            cmd.x0 = x; cmd.y0 = y;
-            cmd.x1 = (std::int32_t)ofs;
-            cmd.y1 = (std::int32_t)len;
-            cmd.u0 = (std::uint16_t)((scale == 0) ? 1 : scale); // ★ scale 저장
-            return push_(cmd);
+        /// @brief 스레드별 현재 clip (이 큐의 항목). 없거나 지난 프레임의 값이면 clip 없음
+        std::uint16_t clip_() const noexcept {
+            const std::uint64_t epoch = m_clip_epoch.load(std::memory_order_relaxed);
+            for (const ClipState& s : s_clips) {
+                if (s.queue == this) return (s.epoch == epoch) ? s.id : kNoClip;
+            }
+            return kNoClip;
         }
 
-        bool text(
-            std::int32_t x, std::int32_t y,
-            std::string_view utf8,
-            ColorRGBA8 color,
-            std::uint32_t sort_key = 0
-        ) noexcept {
-            return text(x, y, utf8, color, sort_key, 1);
+        void set_clip_(std::uint16_t id) noexcept {
+            const ClipState next{this, m_clip_epoch.load(std::memory_order_relaxed), id};
+
+            // 이 큐의 항목 -> 없으면 열린 clip이 없는 항목(어느 큐든 clip 없음과 같다)을 재사용
+            ClipState* free_slot = nullptr;
+            for (ClipState& s : s_clips) {
+                if (s.queue == this) {
+                    s = next;
+                    return;
+                }
+                if (!free_slot && s.id == kNoClip) free_slot = &s;
+            }
+            if (id == kNoClip) return;
+            if (free_slot) *free_slot = next;
+            else s_clips.push_back(next);
         }
 
-    private:
-        bool push_(const Cmd& c) noexcept {
-            return push_payload_(c, 0, 0);
+        /// @brief (큐, 프레임)마다 프로세스 내 유일한 값 (0은 쓰지 않음)
+        static std::uint64_t next_clip_epoch_() noexcept {
+            static std::atomic<std::uint64_t> s_next{1};
+            return s_next.fetch_add(1, std::memory_order_relaxed);
         }
 
         bool push_payload_(const Cmd& c, std::uintptr_t p0, std::uintptr_t p1) noexcept {
+            // 세그먼트를 가진 잡 시스템의 워커는 자기 세그먼트로 (경합 없음)
+            if (m_segment_count != 0) {
+                const std::uint32_t w = framedot::core::JobSystem::current_worker_index();
+                if (w != 0 && w <= m_segment_count && owns_segments_(framedot::core::JobSystem::current_owner())) {
+                    return m_segments[w - 1].push(c, p0, p1, m_capacity);
+                }
+            }
+
             const std::uint32_t frame = m_frame.load(std::memory_order_acquire);
 
             // 1) claim
             const std::uint32_t idx = m_claimed.fetch_add(1, std::memory_order_acq_rel);
-            if (idx >= (std::uint32_t)kMax) {
+            if ((std::size_t)idx >= m_capacity) {
                 m_dropped.fetch_add(1, std::memory_order_relaxed);
                 return false;
             }
 
-            // 2) write
-            m_cmds[idx] = c;
-            m_p0[idx] = p0;
-            m_p1[idx] = p1;
+            // 2) write (paged 모드에서 처음 닿는 페이지는 여기서 할당)
+            Page* pg = page_for_write_((std::size_t)idx >> m_page_shift);
+            const std::size_t j = (std::size_t)idx & m_page_mask;
+            pg->cmds[j] = c;
+            pg->p0[j] = p0;
+            pg->p1[j] = p1;
 
             // 3) mark-ready (release)
-            m_seq[idx].store(frame, std::memory_order_release);
+            pg->seq[j].store(frame, std::memory_order_release);
 
             // 4) publish contiguous frontier
             publish_(frame);
             return true;
         }
 
+        /// @brief js가 이번 프레임 세그먼트의 주인인지. 주인이 없으면 js가 차지한다 (알 수 없는 잡 시스템은 공유 경로)
+        bool owns_segments_(const framedot::core::JobSystem* js) noexcept {
+            if (!js) return false;
+            const framedot::core::JobSystem* cur = m_segment_owner.load(std::memory_order_acquire);
+            if (cur == nullptr &&
+                m_segment_owner.compare_exchange_strong(cur, js, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return true;
+            }
+            return cur == js;
+        }
+
         void publish_(std::uint32_t frame) noexcept {
             while (true) {
                 std::uint32_t p = m_published.load(std::memory_order_acquire);
-                if (p >= (std::uint32_t)kMax) return;
+                if ((std::size_t)p >= m_capacity) return;
 
-                // 다음 슬롯이 이번 frame에서 준비됐는지 확인
-                if (m_seq[p].load(std::memory_order_acquire) != frame) return;
+                // 다음 슬롯이 이번 frame에서 준비됐는지 확인 (페이지가 아직 없으면 미준비)
+                const Page* pg = m_pages[(std::size_t)p >> m_page_shift].load(std::memory_order_acquire);
+                if (!pg || pg->seq[(std::size_t)p & m_page_mask].load(std::memory_order_acquire) != frame) return;
 
                 // frontier를 1칸 전진
                 if (m_published.compare_exchange_weak(
@@ -304,34 +433,107 @@ namespace framedot::gfx {
             }
         }
 
-        // storage
-        std::array<Cmd, kMax> m_cmds{};
-        std::array<std::uintptr_t, kMax> m_p0{};
-        std::array<std::uintptr_t, kMax> m_p1{};
+        struct Page {
+            explicit Page(std::size_t n) : cmds(n), p0(n), p1(n), seq(n) {}
+
+            std::vector<Cmd> cmds;
+            std::vector<std::uintptr_t> p0;
+            std::vector<std::uintptr_t> p1;
+            std::vector<std::atomic<std::uint32_t>> seq; // slot readiness marker
+        };
+
+        const Page* page_(std::size_t k) const noexcept {
+            return m_pages[k].load(std::memory_order_acquire);
+        }
+
+        /// @brief 페이지 k 확보. 경쟁 시 CAS에 진 쪽은 자기 페이지를 버리고 이긴 쪽 것을 쓴다
+        Page* page_for_write_(std::size_t k) noexcept {
+            Page* pg = m_pages[k].load(std::memory_order_acquire);
+            if (pg) return pg;
+
+            Page* fresh = new Page(m_page_size);
+            if (m_pages[k].compare_exchange_strong(pg, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return fresh;
+            }
+            delete fresh;
+            return pg;
+        }
+
+        /// @brief 워커 전용 기록 버퍼 (소유 워커만 push, end_frame에서 소비)
+        struct alignas(64) Segment {
+            std::vector<Cmd> cmds;
+            std::vector<std::uintptr_t> p0;
+            std::vector<std::uintptr_t> p1;
+            std::uint32_t dropped{0};
+
+            bool push(const Cmd& c, std::uintptr_t a, std::uintptr_t b, std::size_t cap) noexcept {
+                if (cmds.size() >= cap) {
+                    ++dropped;
+                    return false;
+                }
+                cmds.push_back(c);
+                p0.push_back(a);
+                p1.push_back(b);
+                return true;
+            }
+
+            void clear() noexcept {
+                cmds.clear();
+                p0.clear();
+                p1.clear();
+                dropped = 0;
+            }
+        };
+
+        // storage (page table)
+        std::size_t m_capacity{0};
+        std::size_t m_page_size{0};     // 페이지당 슬롯 수
+        std::size_t m_page_mask{0};
+        std::uint32_t m_page_shift{0};
+        std::size_t m_page_count{0};
+        std::unique_ptr<std::atomic<Page*>[]> m_pages;
 
         // publish protocol
         std::atomic<std::uint32_t> m_frame{1};       // current frame id
         std::atomic<std::uint32_t> m_claimed{0};     // reserved slots
         std::atomic<std::uint32_t> m_published{0};   // contiguous published count
         std::atomic<std::uint32_t> m_dropped{0};
-        std::array<std::atomic<std::uint32_t>, kMax> m_seq{}; // slot readiness marker
+
+        // 워커 세그먼트 (worker_segments 모드, 워커 i -> [i-1])
+        std::unique_ptr<Segment[]> m_segments;
+        std::size_t m_segment_count{0};
+        std::atomic<const framedot::core::JobSystem*> m_segment_owner{nullptr};   // 이번 프레임 세그먼트를 쓰는 잡 시스템
 
         // text arena
-        std::array<char, kTextArenaBytes> m_text{};
+        std::vector<char> m_text;
         std::atomic<std::uint32_t> m_text_ofs{0};
-    };
 
-    // ---- sort_key helpers (z-index 대용) ----
-    constexpr std::uint32_t make_sort_key(std::uint8_t layer,
-                                         std::uint16_t order,
-                                         std::uint16_t tie = 0) noexcept {
-        return (std::uint32_t(layer) << 24)
-             | ((std::uint32_t(order) & 0x0FFFu) << 12)
-             | (std::uint32_t(tie) & 0x0FFFu);
-    }
-
-    constexpr std::uint8_t  sort_layer(std::uint32_t k) noexcept { return std::uint8_t((k >> 24) & 0xFFu); }
-    constexpr std::uint16_t sort_order(std::uint32_t k) noexcept { return std::uint16_t((k >> 12) & 0x0FFFu); }
-    constexpr std::uint16_t sort_tie  (std::uint32_t k) noexcept { return std::uint16_t((k >>  0) & 0x0FFFu); }
+        // instance arena
+        std::vector<Instance> m_instances;
+        std::atomic<std::uint32_t> m_instance_ofs{0};
+
+        // clip table (id - 1)
+        std::vector<RectI> m_clips;
+        std::atomic<std::uint32_t> m_clip_count{0};
+
+        // affine sprite table
+        std::vector<SpriteAffine> m_affines;
+        std::atomic<std::uint32_t> m_affine_count{0};
+
+        // vertex arena
+        std::vector<PointI> m_vertices;
+        std::atomic<std::uint32_t> m_vertex_ofs{0};
+
+        std::atomic<std::uint64_t> m_clip_epoch{next_clip_epoch_()};
+
+        // 스레드별 현재 clip: 큐마다 한 항목. 큐 여러 개의 clip이 한 스레드에서 섞여도 서로 덮지 않는다.
+        // 항목은 clip이 열려 있는 동안만 점유되고 pop으로 clip 없음이 되면 다른 큐가 재사용한다.
+        struct ClipState {
+            const RenderQueue* queue;
+            std::uint64_t epoch;
+            std::uint16_t id;
+        };
+        static inline thread_local std::vector<ClipState> s_clips;
+    };
 
 } // namespace framedot::gfx
\ No newline at end of file
@@ -9,14 +9,32 @@
  */
 #pragma once
 #include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/DisplayList.hpp>
 #include <framedot/gfx/PixelCanvas.hpp>
+#include <framedot/gfx/Rect.hpp>
 #include <framedot/core/FrameContext.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
 
 namespace framedot::gfx {
 
+    namespace internal { struct DisplayListIndex; }
+
     class SoftwareRenderer {
     public:
+        SoftwareRenderer();
+        ~SoftwareRenderer();
+
+        SoftwareRenderer(const SoftwareRenderer&) = delete;
+        SoftwareRenderer& operator=(const SoftwareRenderer&) = delete;
+
         /// @brief RenderQueue에 기록된 커맨드를 PixelCanvas로 래스터라이즈
         void execute(const RenderQueue& rq, PixelCanvas& out) noexcept;
 
@@ -25,6 +43,248 @@ namespace framedot::gfx {
             const framedot::core::FrameContext& ctx,
             const RenderQueue& rq,
             PixelCanvas& out) noexcept;
+
+        /// @brief 기본 타일 크기(px). DisplayList 로컬 격자 크기이기도 하다
+        static constexpr int kTile = 32;
+
+        /**
+         * @brief 화면 타일 크기 (기본 0 = 자동).
+         * 자동이면 캔버스 크기, 워커 수, 지난 프레임의 bin 밀도로 16/32/64 중에서 고른다
+         * (dirty 추적 중에는 캔버스가 같으면 크기를 유지한다). 양수면 그 크기로 고정 ([8, 256]으로 제한).
+         * 결과 픽셀은 타일 크기와 무관하다.
+         */
+        void set_tile_size(int px) noexcept { m_tile_size = (px <= 0) ? 0 : (px < 8 ? 8 : (px > 256 ? 256 : px)); }
+        int tile_size() const noexcept { return m_tile_size; }
+
+        /// @brief 스프라이트 알파 분류 (블릿 경로 선택용, TextureCache와 같은 분류)
+        using SpriteAlpha = TextureAlpha;
+
+        /// @brief 커맨드가 실제로 읽을 스프라이트 (원본 또는 premultiplied 사본)
+        struct SpriteRef {
+            const std::uint32_t* pixels{nullptr};
+            std::uint32_t stride{0};
+            SpriteAlpha alpha{SpriteAlpha::Unknown};
+        };
+
+        /// @brief 이 프레임 수 동안 쓰이지 않은 분류 캐시 항목은 제거된다
+        static constexpr std::uint64_t kSpriteCacheMaxAge = 120;
+
+        /// @brief 스프라이트 픽셀을 제자리에서 수정했으면 호출 (해당 포인터의 분류/premultiplied 사본 제거)
+        /// @note premultiplied 캔버스에서는 스프라이트를 처음 볼 때 premultiplied 사본을 만들어 캐시에 둔다.
+        ///       불투명 스프라이트는 사본 없이 원본을 쓴다. TextureCache 텍스처는 이 캐시를 거치지 않는다.
+        void invalidate_sprite(const void* pixels) noexcept;
+
+        /// @brief 분류 캐시 전체 제거
+        void clear_sprite_cache() noexcept { m_sprite_cache.clear(); }
+
+        std::size_t sprite_cache_size() const noexcept { return m_sprite_cache.size(); }
+
+        /// @brief DisplayList 캐시(정렬 순서 + 타일 인덱스) 전체 제거. 리스트는 revision으로 자동 갱신된다
+        void clear_list_cache() noexcept;
+
+        std::size_t list_cache_size() const noexcept { return m_list_cache.size(); }
+
+        /// @brief 커맨드 화면 영역 [x0,x1) x [y0,y1) (캔버스로 클립, 비면 x0>=x1)
+        struct CmdBounds {
+            int x0, y0, x1, y1;
+        };
+
+        /// @brief 마지막 execute() 통계
+        struct Stats {
+            std::uint32_t commands{0};         // 큐 커맨드 수
+            std::uint32_t tiles{0};            // 캔버스 타일 수
+            std::uint32_t bin_entries{0};      // 타일 bin 항목 합 (커맨드 x 겹친 타일)
+            std::uint32_t culled{0};           // 가려져서 실행하지 않은 bin 항목
+            std::uint32_t occluded_tiles{0};   // 불투명 커맨드가 타일을 덮어 그 앞을 건너뛴 타일 수
+            std::uint32_t dirty_tiles{0};      // 실행한 타일 (damage)
+            std::uint32_t clean_tiles{0};      // 지난 프레임과 signature가 같아 건너뛴 타일
+            std::uint32_t tile_size{0};        // 이번 프레임 타일 크기(px)
+            std::uint32_t jobs{0};             // 병렬 job 수 (싼 타일은 합치고 비싼 타일은 띠로 나눈 뒤, 순차면 0)
+            std::uint32_t split_tiles{0};      // 띠로 나눠 여러 job이 그린 타일
+        };
+
+        const Stats& stats() const noexcept { return m_stats; }
+
+        /**
+         * @brief 타일별 가림 제거 (기본 켜짐).
+         * 타일을 불투명하게 전부 덮는 마지막 커맨드(Clear, 불투명 FillRect/BlendRect, 무tint 불투명 스프라이트)
+         * 앞의 커맨드는 그 타일에서 실행하지 않는다. 결과 픽셀은 같다.
+         */
+        void set_occlusion_culling(bool on) noexcept { m_occlusion = on; }
+        bool occlusion_culling() const noexcept { return m_occlusion; }
+
+        /**
+         * @brief 타일 dirty 추적 (기본 꺼짐).
+         * 타일별 signature(실행할 커맨드 내용/clip/payload 포인터, 텍스트/인스턴스 내용, 리스트 revision)가
+         * 지난 프레임과 같으면 다시 그리지 않고 캔버스의 픽셀을 그대로 둔다.
+         * 결과가 이전 픽셀에 의존하지 않는 타일(실행 구간이 타일을 덮는 불투명 커맨드로 시작)만 건너뛴다.
+         * @note 캔버스는 프레임 간 유지되어야 한다. 캔버스(주소/크기/포맷)가 바뀌면 자동으로 전체를 다시 그린다.
+         *       캔버스를 직접 수정했거나 스프라이트 픽셀을 제자리에서 바꿨으면 invalidate_tiles()
+         *       (invalidate_sprite()도 전체를 무효화한다).
+         */
+        void set_dirty_tracking(bool on) noexcept { m_dirty_tracking = on; m_sig_valid = false; }
+        bool dirty_tracking() const noexcept { return m_dirty_tracking; }
+
+        /// @brief 다음 execute()에서 모든 타일을 다시 그린다
+        void invalidate_tiles() noexcept { m_sig_valid = false; }
+
+        /// @brief 계측 결과 (set_profiling(true)일 때 마지막 execute(), 꺼져 있으면 0)
+        struct Profile {
+            std::uint64_t execute_ns{0};        // execute() 전체 (정렬/binning/래스터, 벽시계)
+            std::uint64_t raster_ns{0};         // 타일 실행 시간 합 (워커 시간 합)
+            std::uint64_t max_tile_ns{0};       // 가장 느린 타일
+            std::uint32_t visited{0};           // 타일에서 읽은 커맨드 (bin 항목 + 리스트 안 커맨드, 가림 제거분은 stats().culled)
+            std::uint32_t drawn{0};             // 픽셀을 하나 이상 쓴 커맨드 (타일/띠마다 센다)
+            std::uint64_t pixels{0};            // 커널에 넘긴 픽셀 수 합
+
+            // op별 (RenderQueue::Op 값 인덱스). DrawList는 리스트 안 커맨드의 op로 센다
+            std::array<std::uint32_t, kDrawOpCount> op_drawn{};
+            std::array<std::uint64_t, kDrawOpCount> op_pixels{};
+        };
+
+        /**
+         * @brief 계측 (기본 꺼짐).
+         * 켜면 execute()마다 타일별 실행 시간, op별 그린 커맨드/픽셀 수, 읽은/그린 커맨드 수를 profile()에 남긴다.
+         * 픽셀 수는 커널에 넘긴 span 길이 합이다 (blend/마스크 복사로 값이 그대로인 픽셀도 센다).
+         */
+        void set_profiling(bool on) noexcept { m_profiling = on; }
+        bool profiling() const noexcept { return m_profiling; }
+
+        const Profile& profile() const noexcept { return m_profile; }
+
+        /// @brief 타일별 실행 시간(ns), row-major (stats().tile_size 격자, 실행하지 않은 타일은 0)
+        std::span<const std::uint64_t> tile_ns() const noexcept { return m_tile_ns; }
+
+        /**
+         * @brief 타일 시간 heatmap 오버레이 (계측이 켜져 있을 때만, 기본 꺼짐).
+         * 래스터가 끝난 뒤 실행한 타일마다 가장 느린 타일 대비 시간을 파랑 -> 빨강 반투명 색으로 덮는다.
+         * 캔버스 내용이 바뀌므로 dirty 추적 중이면 다음 프레임은 전체를 다시 그린다.
+         */
+        void set_heatmap(bool on) noexcept { m_heatmap = on; }
+        bool heatmap() const noexcept { return m_heatmap; }
+
+        /**
+         * @brief 마지막 execute()에서 픽셀이 바뀌었을 수 있는 영역 (실행한 타일, 인접 타일은 합침).
+         * 커맨드가 없는 타일은 그대로이므로 포함되지 않는다. 부분 present용
+         */
+        std::span<const RectI> damage() const noexcept { return m_damage; }
+
+    private:
+        /// @brief 커맨드 인덱스 버퍼. 프레임 커맨드 수가 65536 이하면 uint16, 넘으면 uint32
+        template <class Index>
+        struct IndexBuffers {
+            std::vector<Index> order;      // 정렬된 실행 순서
+            std::vector<Index> bin_cmds;   // 타일 bin (CSR, 정렬 순서 유지)
+        };
+
+        template <class Index>
+        void execute_(const framedot::core::FrameContext& ctx, const RenderQueue& rq, PixelCanvas& out,
+                      IndexBuffers<Index>& idx) noexcept;
+
+        /// @brief 분류 캐시 조회 (없으면 스캔 후 등록). premul이면 사본도 준비
+        SpriteRef sprite_ref_(const RenderQueue::Cmd& c, const std::uint32_t* pixels, bool premul) noexcept;
+
+        /// @brief 리스트 캐시 조회 (없거나 revision이 다르면 정렬/타일 인덱스 생성). 스프라이트 참조는 매번 갱신
+        const internal::DisplayListIndex* list_index_(const DisplayList& list, bool premul) noexcept;
+
+        struct SpriteKey {
+            const std::uint32_t* pixels;
+            std::int32_t w, h;
+            std::uint32_t stride;
+
+            bool operator==(const SpriteKey& o) const noexcept {
+                return pixels == o.pixels && w == o.w && h == o.h && stride == o.stride;
+            }
+        };
+
+        struct SpriteKeyHash {
+            std::size_t operator()(const SpriteKey& k) const noexcept {
+                std::size_t h = reinterpret_cast<std::uintptr_t>(k.pixels) >> 2;
+                h ^= ((std::size_t)(std::uint32_t)k.w * 0x9E3779B1u) + ((std::size_t)(std::uint32_t)k.h << 16) + k.stride;
+                return h;
+            }
+        };
+
+        struct SpriteEntry {
+            SpriteAlpha alpha{SpriteAlpha::Unknown};
+            std::uint64_t last_used{0};
+            std::vector<std::uint32_t> premul;   // premultiplied 사본 (w*h, 빈 경우 미생성)
+        };
+
+        std::unordered_map<SpriteKey, SpriteEntry, SpriteKeyHash> m_sprite_cache;
+        std::uint64_t m_frame{0};
+
+        // 정렬 버퍼 ((key << 32) | 인덱스). 프레임 간 재사용
+        std::vector<std::uint64_t> m_sort_a, m_sort_b;
+        std::vector<std::uint32_t> m_keys;        // paged 큐에서 key를 모아 둘 때만 사용
+
+        IndexBuffers<std::uint16_t> m_idx16;
+        IndexBuffers<std::uint32_t> m_idx32;
+
+        // 타일 binning 결과 (CSR). 프레임 간 재사용
+        std::vector<CmdBounds>     m_bounds;
+        std::vector<std::uint32_t> m_bin_start;   // tile_count + 1
+        std::vector<std::uint32_t> m_bin_fill;
+        std::vector<SpriteRef>     m_cmd_sprite;  // 커맨드 인덱스별 스프라이트 소스/분류
+
+        // DisplayList 캐시 (리스트 주소 -> 인덱스, revision으로 무효화, 스프라이트 캐시와 같이 aging)
+        std::unordered_map<const DisplayList*, std::unique_ptr<internal::DisplayListIndex>> m_list_cache;
+        std::vector<const internal::DisplayListIndex*> m_cmd_list;   // 커맨드 인덱스별 (DrawList만 유효)
+
+        // 인스턴스 op 타일 배분 (CSR). 프레임에 인스턴스 op가 있을 때만 채운다
+        std::vector<std::uint32_t> m_inst_start;  // 타일별 인스턴스 번호 시작 (tile_count + 1)
+        std::vector<std::uint32_t> m_inst_fill;
+        std::vector<std::uint32_t> m_inst_refs;   // 타일별 인스턴스 번호 (커맨드 순서 -> 인스턴스 순서)
+        std::vector<std::uint32_t> m_bin_inst_n;  // bin_cmds와 평행: 인스턴스 op면 이 타일의 인스턴스 수
+        std::vector<std::uint32_t> m_tile_stamp;  // 타일별 마지막으로 bin에 넣은 커맨드 (중복 제거)
+        std::vector<std::uint32_t> m_tile_entry;  // 타일별 그 커맨드의 bin_cmds 위치
+
+        // 타일 크기 (0 = 자동) / 자동 선택 입력
+        int m_tile_size{0};
+        int m_tile{kTile};                   // 마지막 프레임 타일 크기
+        std::uint32_t m_bin_density{0};      // 지난 프레임 bin 항목 수 / kTile x kTile 면적 (x16)
+
+        // 타일 비용 추정과 job 배치 (비용 내림차순으로 제출)
+        struct TileJob {
+            std::uint64_t cost{0};
+            std::uint32_t first{0}, count{0};   // m_job_tiles 구간 (row-major로 이어진 타일들)
+            std::int32_t y0{0}, y1{0};          // y0 < y1이면 타일 하나의 띠 [y0,y1)
+        };
+
+        std::vector<std::uint64_t> m_tile_cost;
+        std::vector<std::uint32_t> m_tile_begin;  // 타일별 실행 시작 bin 위치 (가림 제거 반영)
+        std::vector<std::uint32_t> m_tile_inst;   // 그 위치의 inst_refs 오프셋
+        std::vector<std::uint32_t> m_job_tiles;
+        std::vector<TileJob>       m_jobs;
+
+        // 계측 (job마다 자기 칸에 누적한 뒤 합친다)
+        bool m_profiling{false};
+        bool m_heatmap{false};
+        Profile m_profile{};
+        std::vector<Profile>       m_prof_slots;
+        std::vector<std::uint64_t> m_tile_ns;
+        std::vector<std::uint64_t> m_job_ns;     // 띠 job 시간 (끝난 뒤 타일에 더한다)
+
+        // 가림 제거 / 통계
+        bool m_occlusion{true};
+        std::vector<std::uint32_t> m_tile_culled;  // 타일별 건너뛴 bin 항목 수 (타일 job이 자기 칸만 쓴다)
+        Stats m_stats{};
+
+        // dirty 추적 (타일별 signature, 0 = 재사용 불가)
+        struct CanvasKey {
+            const void* pixels{nullptr};
+            std::uint32_t w{0}, h{0};
+            PixelFormat format{};
+
+            bool operator==(const CanvasKey&) const noexcept = default;
+        };
+
+        bool m_dirty_tracking{false};
+        bool m_sig_valid{false};
+        CanvasKey m_sig_canvas{};
+        std::vector<std::uint64_t> m_tile_sig;
+        std::vector<std::uint8_t>  m_tile_state;   // 0 = 비어 있음, 1 = 실행, 2 = 건너뜀(clean)
+        std::vector<RectI>         m_damage;
     };
 
 } // namespace framedot::gfx
\ No newline at end of file
@@ -0,0 +1,103 @@
+// include/framedot/gfx/SpriteAffine.hpp
+/**
+ * @file SpriteAffine.hpp
+ * @brief affine 스프라이트 블릿(스케일/회전)의 역변환 레코드와 샘플링 필터.
+ *
+ * 설계 포인트:
+ * - 기록 시 한 번 float 행렬을 역변환해 16.16 고정소수점으로 저장한다. 렌더러는 정수 연산만 한다.
+ * - 화면 픽셀 (x,y)의 중심이 닿는 텍셀 좌표: u = u0 + (x - x0)*du_dx + (y - y0)*du_dy (v도 같음).
+ *   텍셀 [0,w) x [0,h) 밖이면 그리지 않는다 (행마다 유효 구간을 먼저 구한다).
+ * - 축 정렬 + 정수 배율(1~255) + 정수 이동이면 up_x/up_y에 배율을 적어 두고, nearest일 때 텍셀 복제 경로를 쓴다.
+ */
+#pragma once
+#include <framedot/math/Types.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+
+namespace framedot::gfx {
+
+    enum class SampleFilter : std::uint8_t {
+        Nearest = 0,
+        Bilinear,   // 텍셀 중심 기준 2x2 보간, 가장자리는 clamp
+    };
+
+    struct SpriteAffine {
+        // 화면 픽셀 (x0,y0) 중심의 텍셀 좌표 (16.16)
+        std::int64_t u0{0}, v0{0};
+
+        // 화면 x/y로 한 픽셀 갈 때 텍셀 좌표 증분 (16.16)
+        std::int32_t du_dx{0}, dv_dx{0};
+        std::int32_t du_dy{0}, dv_dy{0};
+
+        // 변환된 사각형을 덮는 화면 영역 [x0,x1) x [y0,y1) (보수적)
+        std::int32_t x0{0}, y0{0}, x1{0}, y1{0};
+
+        // 정수 확대 배율 (0 = 해당 없음)
+        std::uint8_t up_x{0}, up_y{0};
+    };
+
+    /**
+     * @brief 스프라이트 로컬 픽셀 좌표 -> 화면 좌표 행렬 m으로 w x h 스프라이트의 역변환 레코드를 만든다
+     * @return 역행렬이 없거나(면적 0) 좌표가 범위(±2^28)를 넘으면 false
+     */
+    inline bool make_sprite_affine(const framedot::math::Mat3f& m, std::int32_t w, std::int32_t h,
+                                   SpriteAffine& out) noexcept {
+        constexpr double kCoordLimit = (double)(1 << 28);
+        constexpr double kStepLimit = (double)(1 << 30);
+        constexpr double kOne = 65536.0;
+
+        if (w <= 0 || h <= 0) return false;
+
+        const double a = m.m[0], b = m.m[1], tx = m.m[2];
+        const double c = m.m[3], d = m.m[4], ty = m.m[5];
+        const double det = a * d - b * c;
+        if (!std::isfinite(det) || !std::isfinite(tx) || !std::isfinite(ty) || std::fabs(det) < 1e-9) return false;
+
+        // 네 꼭짓점의 AABB
+        double minx = tx, maxx = tx, miny = ty, maxy = ty;
+        const double cx[3] = {(double)w, 0.0, (double)w};
+        const double cy[3] = {0.0, (double)h, (double)h};
+        for (int i = 0; i < 3; ++i) {
+            const double px = a * cx[i] + b * cy[i] + tx;
+            const double py = c * cx[i] + d * cy[i] + ty;
+            minx = std::fmin(minx, px); maxx = std::fmax(maxx, px);
+            miny = std::fmin(miny, py); maxy = std::fmax(maxy, py);
+        }
+        if (minx < -kCoordLimit || miny < -kCoordLimit || maxx > kCoordLimit || maxy > kCoordLimit) return false;
+
+        out.x0 = (std::int32_t)std::floor(minx);
+        out.y0 = (std::int32_t)std::floor(miny);
+        out.x1 = (std::int32_t)std::ceil(maxx);
+        out.y1 = (std::int32_t)std::ceil(maxy);
+
+        // 역행렬 (이동 제외)
+        const double ia = d / det, ib = -b / det;
+        const double ic = -c / det, id = a / det;
+        if (std::fabs(ia) * kOne >= kStepLimit || std::fabs(ib) * kOne >= kStepLimit
+            || std::fabs(ic) * kOne >= kStepLimit || std::fabs(id) * kOne >= kStepLimit) return false;
+
+        out.du_dx = (std::int32_t)std::lround(ia * kOne);
+        out.du_dy = (std::int32_t)std::lround(ib * kOne);
+        out.dv_dx = (std::int32_t)std::lround(ic * kOne);
+        out.dv_dy = (std::int32_t)std::lround(id * kOne);
+
+        const double px = (double)out.x0 + 0.5 - tx;
+        const double py = (double)out.y0 + 0.5 - ty;
+        out.u0 = std::llround((ia * px + ib * py) * kOne);
+        out.v0 = std::llround((ic * px + id * py) * kOne);
+
+        // 정수 확대: 텍셀 하나가 정확히 up_x x up_y 블록
+        auto int_scale = [](double s) noexcept -> std::uint8_t {
+            return (s >= 1.0 && s <= 255.0 && s == std::floor(s)) ? (std::uint8_t)s : 0;
+        };
+        out.up_x = out.up_y = 0;
+        if (b == 0.0 && c == 0.0 && tx == std::floor(tx) && ty == std::floor(ty)) {
+            const std::uint8_t ux = int_scale(a), uy = int_scale(d);
+            if (ux && uy) { out.up_x = ux; out.up_y = uy; }
+        }
+        return true;
+    }
+
+} // namespace framedot::gfx
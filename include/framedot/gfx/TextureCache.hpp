@@ -0,0 +1,140 @@
+// include/framedot/gfx/TextureCache.hpp
+/**
+ * @file TextureCache.hpp
+ * @brief 이미지를 등록해 handle로 참조하는 텍스처 저장소 (아틀라스 페이지 + 미리 계산한 분류/premultiplied 사본).
+ *
+ * 설계 포인트:
+ * - add()는 픽셀을 복사해 소유한다. 호출자 버퍼의 수명과 무관하다.
+ * - 작은 이미지는 아틀라스 페이지(page_size 정사각형)에 shelf 방식으로 모아 담는다 (지역성).
+ *   한 변이 max_packed보다 큰 이미지는 전용 페이지를 쓴다.
+ * - 등록 시 알파 분류와 premultiplied 사본을 만든다. 렌더러는 스프라이트 캐시 조회/스캔 없이 바로 쓴다.
+ * - handle은 (슬롯, 세대)라서 remove() 뒤의 오래된 handle은 get()에서 nullptr가 된다.
+ * - add/update/remove는 렌더 중이 아닐 때 한 스레드에서. get()은 동시에 불러도 된다.
+ *   커맨드가 가리키는 텍스처는 렌더가 끝날 때까지 제거/갱신하면 안 된다 (DisplayList는 기록해 둔 동안 계속).
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+
+namespace framedot::gfx {
+
+    /// @brief 알파 분류 (블릿 경로 선택용)
+    enum class TextureAlpha : std::uint8_t {
+        Unknown = 0,
+        Opaque,       // 모두 255 -> 무tint면 행 memcpy
+        Binary,       // 0 또는 255 -> 무tint면 마스크 복사
+        Translucent,  // 그 외 -> blend
+    };
+
+    /// @brief 전체 스캔으로 알파 분류 (반투명 픽셀을 만나면 종료)
+    TextureAlpha classify_alpha(const std::uint32_t* pixels, std::int32_t w, std::int32_t h,
+                                std::uint32_t stride) noexcept;
+
+    struct TextureHandle {
+        std::uint32_t index{0};        // 슬롯 + 1 (0 = 없음)
+        std::uint32_t generation{0};
+
+        explicit operator bool() const noexcept { return index != 0; }
+        bool operator==(const TextureHandle&) const noexcept = default;
+    };
+
+    /// @brief 등록된 텍스처 (읽기 전용, 주소는 제거될 때까지 유지)
+    struct Texture {
+        const std::uint32_t* pixels{nullptr};   // straight RGBA8888 (페이지 안 위치)
+        const std::uint32_t* premul{nullptr};   // premultiplied 사본 (불투명이면 pixels)
+        std::uint32_t stride{0};                // 페이지 행 간격 (px)
+        std::int32_t w{0}, h{0};
+        TextureAlpha alpha{TextureAlpha::Unknown};
+        std::uint32_t page{0};
+        std::int32_t x{0}, y{0};                // 페이지 안 위치
+        std::uint64_t revision{0};              // update()마다 바뀐다 (렌더러 dirty 추적용)
+    };
+
+    struct TextureCacheConfig {
+        /// @brief 아틀라스 페이지 한 변 (px, 64~4096으로 제한)
+        std::int32_t page_size = 512;
+
+        /// @brief 이보다 큰 변을 가진 이미지는 전용 페이지
+        std::int32_t max_packed = 128;
+    };
+
+    class TextureCache {
+    public:
+        TextureCache() : TextureCache(TextureCacheConfig{}) {}
+        explicit TextureCache(const TextureCacheConfig& cfg);
+        ~TextureCache();
+
+        TextureCache(const TextureCache&) = delete;
+        TextureCache& operator=(const TextureCache&) = delete;
+
+        /**
+         * @brief 이미지 w x h (행 간격 stride_pixels)를 복사해 등록
+         * @return 실패(빈 이미지, stride < w, 한 변이 65535 초과)면 빈 handle
+         */
+        TextureHandle add(const std::uint32_t* pixels, std::int32_t w, std::int32_t h,
+                          std::uint32_t stride_pixels);
+
+        /// @brief 같은 크기의 새 내용으로 교체 (분류/사본 다시 계산, revision 증가)
+        bool update(TextureHandle t, const std::uint32_t* pixels, std::uint32_t stride_pixels);
+
+        /// @brief 제거. 빈 페이지는 재사용된다 (전용 페이지는 해제)
+        void remove(TextureHandle t) noexcept;
+
+        /// @brief handle -> 텍스처 (없거나 제거됐으면 nullptr)
+        const Texture* get(TextureHandle t) const noexcept;
+
+        bool contains(TextureHandle t) const noexcept { return get(t) != nullptr; }
+
+        /// @brief 등록된 텍스처 수
+        std::size_t size() const noexcept { return m_live; }
+
+        /// @brief 페이지 수 (해제된 전용 페이지 제외)
+        std::size_t page_count() const noexcept;
+
+        /// @brief 모든 텍스처 제거 (기존 handle은 모두 무효)
+        void clear() noexcept;
+
+    private:
+        struct Shelf {
+            std::int32_t y, h, x;   // 시작 행, 높이, 다음 빈 x
+        };
+
+        struct Page {
+            std::int32_t w{0}, h{0};
+            bool dedicated{false};
+            std::vector<std::uint32_t> pixels;
+            std::vector<std::uint32_t> premul;   // 불투명이 아닌 텍스처가 처음 들어올 때 할당
+            std::vector<Shelf> shelves;
+            std::int32_t y_used{0};
+            std::uint32_t live{0};
+        };
+
+        struct Slot {
+            Texture tex{};
+            std::uint32_t generation{1};
+            bool used{false};
+        };
+
+        /// @brief w x h 자리 확보 -> (페이지, x, y)
+        bool place_(std::int32_t w, std::int32_t h, std::uint32_t& page, std::int32_t& x, std::int32_t& y);
+
+        /// @brief 픽셀 복사 + 분류 + 사본
+        void upload_(Texture& t, const std::uint32_t* pixels, std::uint32_t stride);
+
+        Slot* slot_(TextureHandle t) noexcept;
+
+        std::int32_t m_page_size{512};
+        std::int32_t m_max_packed{128};
+
+        std::vector<std::unique_ptr<Page>> m_pages;   // 해제된 전용 페이지는 nullptr
+        std::deque<Slot> m_slots;                     // 주소 고정 (Texture*를 커맨드가 가리킨다)
+        std::vector<std::uint32_t> m_free;            // 빈 슬롯
+        std::size_t m_live{0};
+        std::uint64_t m_revision{0};
+    };
+
+} // namespace framedot::gfx
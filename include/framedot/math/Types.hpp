@@ -111,4 +111,47 @@ namespace framedot::math {
         };
     }
 
+    // ----------------------------
+    // 2D 아핀 변환 (Mat3f)
+    // - row-major: [m0 m1 m2 / m3 m4 m5 / 0 0 1], 이동은 (m2, m5)
+    // - 마지막 행은 항상 (0,0,1)로 가정하고 계산에서 생략한다.
+    // ----------------------------
+
+    /// @brief T * R * S 순서의 2D 아핀 행렬 (fml::make_trs_2d와 같은 규약, glm mat4 없이)
+    inline Mat3f make_affine_2d(Vec2f pos, float rot_rad, Vec2f scale) noexcept {
+        const float c = std::cos(rot_rad);
+        const float s = std::sin(rot_rad);
+        Mat3f r;
+        r.m[0] = c * scale.x;  r.m[1] = -s * scale.y;  r.m[2] = pos.x;
+        r.m[3] = s * scale.x;  r.m[4] =  c * scale.y;  r.m[5] = pos.y;
+        return r;
+    }
+
+    /// @brief 아핀 행렬 곱 (a * b): b를 먼저 적용한 뒤 a를 적용
+    constexpr Mat3f mul_affine(const Mat3f& a, const Mat3f& b) noexcept {
+        Mat3f r;
+        r.m[0] = a.m[0]*b.m[0] + a.m[1]*b.m[3];
+        r.m[1] = a.m[0]*b.m[1] + a.m[1]*b.m[4];
+        r.m[2] = a.m[0]*b.m[2] + a.m[1]*b.m[5] + a.m[2];
+        r.m[3] = a.m[3]*b.m[0] + a.m[4]*b.m[3];
+        r.m[4] = a.m[3]*b.m[1] + a.m[4]*b.m[4];
+        r.m[5] = a.m[3]*b.m[2] + a.m[4]*b.m[5] + a.m[5];
+        return r;
+    }
+
+    /// @brief 점 변환 (이동 포함)
+    constexpr Vec2f transform_point(const Mat3f& m, Vec2f p) noexcept {
+        return { m.m[0]*p.x + m.m[1]*p.y + m.m[2],
+                 m.m[3]*p.x + m.m[4]*p.y + m.m[5] };
+    }
+
+    /// @brief 이동 성분
+    constexpr Vec2f affine_translation(const Mat3f& m) noexcept { return { m.m[2], m.m[5] }; }
+
+    /// @brief 축별 스케일 크기 (회전 제거, 부호 없음)
+    inline Vec2f affine_scale(const Mat3f& m) noexcept {
+        return { std::sqrt(m.m[0]*m.m[0] + m.m[3]*m.m[3]),
+                 std::sqrt(m.m[1]*m.m[1] + m.m[4]*m.m[4]) };
+    }
+
 } // namespace framedot::math
\ No newline at end of file
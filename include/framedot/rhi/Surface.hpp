@@ -5,9 +5,13 @@
  *
  * 엔진 내부의 픽셀 버퍼(PixelCanvas)를 직접 받지 않고,
  * 불변 뷰(PixelFrame)를 받아서 플랫폼별 변환/출력을 수행한다.
+ * damage를 받는 present는 바뀐 영역만 변환할 수 있는 어댑터가 재정의한다.
  */
 #pragma once
 #include <framedot/gfx/PixelFrame.hpp>
+#include <framedot/gfx/Rect.hpp>
+
+#include <span>
 
 
 namespace framedot::rhi {
@@ -16,6 +20,16 @@ namespace framedot::rhi {
     public:
         virtual ~Surface() = default;
         virtual void present(const framedot::gfx::PixelFrame& canvas) = 0;
+
+        /**
+         * @brief 지난 present 이후 바뀐 영역(frame 좌표, 겹칠 수 있음)만 알려 주는 present.
+         * 비어 있으면 픽셀이 바뀌지 않았다. 기본 구현은 전체 present.
+         */
+        virtual void present(const framedot::gfx::PixelFrame& canvas,
+                             std::span<const framedot::gfx::RectI> damage) {
+            (void)damage;
+            present(canvas);
+        }
     };
 
-} // namespace framedot::rhi
\ No newline at end of file
+} // namespace framedot::rhi
@@ -0,0 +1,18 @@
+// internal/framedot_internal/core/Simd.hpp
+#pragma once
+
+/// @brief SIMD 커널 공용 매크로
+/// - FRAMEDOT_SIMD_X86: x86/x64 intrinsics 사용 가능
+/// - FRAMEDOT_TARGET("avx2"): 해당 함수만 지정 ISA로 컴파일 (전역 -m 플래그 없이 런타임 디스패치)
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  #include <immintrin.h>
+  #define FRAMEDOT_SIMD_X86 1
+#else
+  #define FRAMEDOT_SIMD_X86 0
+#endif
+
+#if FRAMEDOT_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+  #define FRAMEDOT_TARGET(isa) __attribute__((target(isa)))
+#else
+  #define FRAMEDOT_TARGET(isa)
+#endif
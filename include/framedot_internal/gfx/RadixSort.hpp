@@ -0,0 +1,43 @@
+// internal/framedot_internal/gfx/RadixSort.hpp
+/**
+ * @file RadixSort.hpp
+ * @brief 커맨드 실행 순서 정렬: 32bit sort_key 기준 안정 LSD radix sort.
+ *
+ * 설계 포인트:
+ * - 항목 = (key << 32) | 제출 인덱스. key 바이트만 LSD로 정렬한다.
+ *   입력이 인덱스 오름차순이고 패스마다 안정적이므로 같은 key는 제출 순서를 유지한다.
+ * - 프레임 내 모든 key에서 값이 같은 바이트는 패스를 건너뛴다
+ *   (예: layer 바이트만 다르면 1패스, key가 전부 같으면 0패스 = 제출 순서 그대로).
+ * - n >= kRadixParallelMin이고 워커가 있으면 청크별 히스토그램/scatter를 병렬로 돌린다.
+ *   버킷 오프셋을 (버킷, 청크) 순서로 배정하므로 결과는 순차 경로와 같다.
+ */
+#pragma once
+#include <framedot/core/JobSystem.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace framedot::gfx::internal {
+
+    /// @brief 이 개수 이상이면 병렬 경로 (워커가 있을 때)
+    inline constexpr std::size_t kRadixParallelMin = 4096;
+
+    /**
+     * @brief order[0..n) = (key, 제출 인덱스) 오름차순 인덱스
+     * @param keys i번째 key 주소 = (const std::byte*)keys + i * key_stride
+     * @param buf_a, buf_b 재사용 버퍼 (필요 시 n으로 확장)
+     * @return 실행한 패스 수 (0~4)
+     */
+    int radix_sort_order(const std::uint32_t* keys, std::size_t key_stride, std::size_t n,
+                         std::uint16_t* order,
+                         std::vector<std::uint64_t>& buf_a, std::vector<std::uint64_t>& buf_b,
+                         framedot::core::JobSystem* jobs = nullptr) noexcept;
+
+    int radix_sort_order(const std::uint32_t* keys, std::size_t key_stride, std::size_t n,
+                         std::uint32_t* order,
+                         std::vector<std::uint64_t>& buf_a, std::vector<std::uint64_t>& buf_b,
+                         framedot::core::JobSystem* jobs = nullptr) noexcept;
+
+} // namespace framedot::gfx::internal
@@ -0,0 +1,191 @@
+// internal/framedot_internal/gfx/RasterKernels.hpp
+/**
+ * @file RasterKernels.hpp
+ * @brief SoftwareRenderer 내부 span 커널과 픽셀 헬퍼.
+ *
+ * 설계 포인트:
+ * - 래스터는 "클립된 가로 span" 단위로 커널을 호출한다. 클립은 커맨드당/행당 한 번.
+ * - 커널은 범위 검사를 하지 않는다. 호출자가 [dst, dst+n)이 타일 안임을 보장.
+ * - 픽셀 포맷: 0xRRGGBBAA. 기본 straight alpha, TileTarget::premul이면 premultiplied.
+ *   premultiplied 경로는 채널 곱을 mul8 = ((x*a + 128) * 257) >> 16 (x*a/255 반올림)으로 하고
+ *   blend는 out = s + mul8(d, 255 - sa) 한 번으로 끝난다 (나눗셈 없음).
+ * - fill/blend/blit은 시작 시 CPU 기능(AVX2/SSE2/스칼라)에 맞춰 한 번 선택된다.
+ *   SIMD 경로는 스칼라 기준 구현과 비트 단위로 같은 결과를 낸다.
+ */
+#pragma once
+#include <framedot/gfx/Color.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace framedot::gfx::internal {
+
+    constexpr std::uint8_t pr(std::uint32_t p) noexcept { return (std::uint8_t)((p >> 24) & 0xFF); }
+    constexpr std::uint8_t pg(std::uint32_t p) noexcept { return (std::uint8_t)((p >> 16) & 0xFF); }
+    constexpr std::uint8_t pb(std::uint32_t p) noexcept { return (std::uint8_t)((p >>  8) & 0xFF); }
+    constexpr std::uint8_t pa(std::uint32_t p) noexcept { return (std::uint8_t)((p >>  0) & 0xFF); }
+
+    constexpr std::uint32_t pack_rgba(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a) noexcept {
+        return (std::uint32_t(r) << 24) | (std::uint32_t(g) << 16) | (std::uint32_t(b) << 8) | std::uint32_t(a);
+    }
+
+    constexpr std::uint32_t pack_rgba(ColorRGBA8 c) noexcept { return pack_rgba(c.r, c.g, c.b, c.a); }
+
+    constexpr ColorRGBA8 unpack_rgba(std::uint32_t p) noexcept { return ColorRGBA8{pr(p), pg(p), pb(p), pa(p)}; }
+
+    /// @brief straight alpha source-over (스칼라 기준 구현)
+    inline std::uint32_t blend_over(std::uint32_t dst, ColorRGBA8 src) noexcept {
+        const std::uint32_t sa = src.a;
+        if (sa == 255) return pack_rgba(src);
+        if (sa == 0)   return dst;
+
+        const std::uint32_t inv = 255 - sa;
+
+        const std::uint32_t or_ = (src.r * sa + pr(dst) * inv) / 255;
+        const std::uint32_t og_ = (src.g * sa + pg(dst) * inv) / 255;
+        const std::uint32_t ob_ = (src.b * sa + pb(dst) * inv) / 255;
+        const std::uint32_t oa_ = (sa + (pa(dst) * inv) / 255);
+
+        return pack_rgba((std::uint8_t)or_, (std::uint8_t)og_, (std::uint8_t)ob_, (std::uint8_t)oa_);
+    }
+
+    // ----------------------------
+    // premultiplied alpha
+    // ----------------------------
+
+    /// @brief x*a/255 반올림 (x, a <= 255)
+    constexpr std::uint32_t mul8(std::uint32_t x, std::uint32_t a) noexcept {
+        return ((x * a + 128) * 257) >> 16;
+    }
+
+    /// @brief straight 픽셀 -> premultiplied 픽셀
+    constexpr std::uint32_t premultiply(std::uint32_t p) noexcept {
+        const std::uint32_t a = pa(p);
+        if (a == 255) return p;
+        return (mul8(pr(p), a) << 24) | (mul8(pg(p), a) << 16) | (mul8(pb(p), a) << 8) | a;
+    }
+
+    /// @brief straight 색 -> premultiplied 픽셀
+    constexpr std::uint32_t pack_premul(ColorRGBA8 c) noexcept { return premultiply(pack_rgba(c)); }
+
+    /// @brief premultiplied source-over (src, dst 모두 premultiplied)
+    /// @note 채널 합은 255로 포화 (RGB > A인 잘못된 입력에서도 SIMD 경로와 같은 결과)
+    constexpr std::uint32_t blend_over_premul(std::uint32_t dst, std::uint32_t src) noexcept {
+        const std::uint32_t inv = 255 - pa(src);
+        auto ch = [inv](std::uint32_t s, std::uint32_t d) -> std::uint32_t {
+            const std::uint32_t v = s + mul8(d, inv);
+            return v > 255 ? 255 : v;
+        };
+        return (ch(pr(src), pr(dst)) << 24) | (ch(pg(src), pg(dst)) << 16)
+             | (ch(pb(src), pb(dst)) << 8)  |  ch(pa(src), pa(dst));
+    }
+
+    /// @brief premultiplied 픽셀끼리 채널별 곱 (premultiplied tint 적용)
+    constexpr std::uint32_t modulate_premul(std::uint32_t p, std::uint32_t tint) noexcept {
+        return (mul8(pr(p), pr(tint)) << 24) | (mul8(pg(p), pg(tint)) << 16)
+             | (mul8(pb(p), pb(tint)) << 8)  |  mul8(pa(p), pa(tint));
+    }
+
+    /// @brief 채널별 곱 (tint)
+    inline ColorRGBA8 modulate(ColorRGBA8 src, ColorRGBA8 tint) noexcept {
+        auto mul = [](std::uint8_t a, std::uint8_t b) -> std::uint8_t {
+            return (std::uint8_t)((std::uint16_t(a) * std::uint16_t(b)) / 255);
+        };
+        return ColorRGBA8{ mul(src.r, tint.r), mul(src.g, tint.g), mul(src.b, tint.b), mul(src.a, tint.a) };
+    }
+
+    /// @brief 단일 픽셀 쓰기 (a=255 덮어쓰기, a=0 무시, 그 외 blend)
+    inline void write_pixel(std::uint32_t& dst, ColorRGBA8 c) noexcept {
+        if (c.a == 255) {
+            dst = pack_rgba(c);
+        } else if (c.a != 0) {
+            dst = blend_over(dst, c);
+        }
+    }
+
+    /// @brief premultiplied 캔버스에 단일 픽셀 쓰기 (c는 straight)
+    inline void write_pixel_premul(std::uint32_t& dst, ColorRGBA8 c) noexcept {
+        if (c.a == 255) {
+            dst = pack_rgba(c);
+        } else if (c.a != 0) {
+            dst = blend_over_premul(dst, pack_premul(c));
+        }
+    }
+
+    /// @brief 래스터 대상: 타일 사각형(캔버스 안으로 클립됨) + 캔버스 행 간격
+    struct TileTarget {
+        std::uint32_t* pixels{nullptr};  // 캔버스 (0,0)
+        std::size_t stride{0};           // 픽셀 단위
+        int x0{0}, y0{0}, x1{0}, y1{0};  // [x0,x1) x [y0,y1)
+        bool premul{false};              // 캔버스가 premultiplied 포맷인지
+        std::uint64_t* written{nullptr}; // 계측: 커널에 넘긴 픽셀 수 누적 (nullptr이면 세지 않음)
+
+        std::uint32_t* row(int y) const noexcept { return pixels + (std::size_t)y * stride; }
+        bool contains(int x, int y) const noexcept { return x >= x0 && x < x1 && y >= y0 && y < y1; }
+    };
+
+    // ----------------------------
+    // span 커널 (디스패치)
+    // ----------------------------
+
+    /// @brief dst[0..n) = p
+    void fill_span(std::uint32_t* dst, std::size_t n, std::uint32_t p) noexcept;
+
+    /// @brief dst[0..n) = blend_over(dst, c)  (균일 색)
+    void blend_span(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept;
+
+    /// @brief dst[0..n) = src[0..n)  (불투명/무tint 소스 전용)
+    void copy_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept;
+
+    /// @brief dst[i]에 modulate(src[i], tint)를 write_pixel 규칙으로 쓴다
+    void blit_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, ColorRGBA8 tint) noexcept;
+
+    /// @brief 알파가 255인 소스 픽셀만 복사 (0/255 이진 알파 + 무tint 스프라이트 전용)
+    void copy_masked_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept;
+
+    /// @brief dst[0..n) = blend_over_premul(dst, src)  (src: premultiplied 균일 색)
+    void blend_premul_span(std::uint32_t* dst, std::size_t n, std::uint32_t src) noexcept;
+
+    /// @brief dst[i] = blend_over_premul(dst[i], modulate_premul(src[i], tint))
+    /// @note src, tint 모두 premultiplied
+    void blit_premul_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, std::uint32_t tint) noexcept;
+
+    /// @brief 커널 한 벌 (ISA별)
+    struct RasterKernelSet {
+        void (*fill)(std::uint32_t*, std::size_t, std::uint32_t) noexcept;
+        void (*blend)(std::uint32_t*, std::size_t, ColorRGBA8) noexcept;
+        void (*blit)(std::uint32_t*, const std::uint32_t*, std::size_t, ColorRGBA8) noexcept;
+        void (*copy_masked)(std::uint32_t*, const std::uint32_t*, std::size_t) noexcept;
+        void (*blend_premul)(std::uint32_t*, std::size_t, std::uint32_t) noexcept;
+        void (*blit_premul)(std::uint32_t*, const std::uint32_t*, std::size_t, std::uint32_t) noexcept;
+        const char* name;
+    };
+
+    enum class RasterIsa : std::uint8_t { Scalar = 0, SSE2, AVX2 };
+
+    /// @brief 지정 ISA 커널 (CPU가 지원하지 않으면 nullptr). 검증/벤치용
+    const RasterKernelSet* raster_kernels_for(RasterIsa isa) noexcept;
+
+    /// @brief 현재 선택된 커널
+    const RasterKernelSet& raster_kernels() noexcept;
+
+    /// @brief 균일 색 span: 알파에 따라 fill/blend/생략 선택
+    inline void color_span(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept {
+        if (c.a == 255) {
+            fill_span(dst, n, pack_rgba(c));
+        } else if (c.a != 0) {
+            blend_span(dst, n, c);
+        }
+    }
+
+    /// @brief 균일 색 span (premultiplied 캔버스, c는 straight)
+    inline void color_span_premul(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept {
+        if (c.a == 255) {
+            fill_span(dst, n, pack_rgba(c));
+        } else if (c.a != 0) {
+            blend_premul_span(dst, n, pack_premul(c));
+        }
+    }
+
+} // namespace framedot::gfx::internal
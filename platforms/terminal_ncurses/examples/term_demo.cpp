@@ -22,6 +22,7 @@ int main() {
 
     gfx::RenderQueue rq;
     gfx::SoftwareRenderer sw;
+    sw.set_dirty_tracking(true);   // 움직이는 박스 주변 타일만 다시 그리고, 그 영역만 터미널로 변환
 
     int t = 0;
 
@@ -48,7 +49,7 @@ int main() {
         rq.hline(0, 119, 4, rgba(255, 0, 255));
 
         sw.execute(rq, canvas);
-        surface.present(canvas.frame());
+        surface.present(canvas.frame(), sw.damage());
 
         ++t;
         std::this_thread::sleep_for(std::chrono::milliseconds(16));
@@ -2,10 +2,14 @@
 /**
  * @file TerminalSurface.hpp
  * @brief ncurses 기반 출력 어댑터. PixelFrame(view)을 받아 터미널로 변환 출력
+ *
+ * damage를 받는 present는 그 사각형 안의 셀만 비교/변환한다.
+ * 초기화/터미널 크기 변경 직후에는 damage와 무관하게 전체를 한 번 그린다.
  */
 #pragma once
 #include <framedot/rhi/Surface.hpp>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 
@@ -22,6 +26,10 @@ namespace framedot::platform::terminal {
         // Canvas -> terminal present
         void present(const framedot::gfx::PixelFrame& frame) override;
 
+        // 바뀐 영역만 변환
+        void present(const framedot::gfx::PixelFrame& frame,
+                     std::span<const framedot::gfx::RectI> damage) override;
+
         // Non-blocking key poll. Returns -1 if no key.
         int poll_key() noexcept;
 
@@ -30,6 +38,12 @@ namespace framedot::platform::terminal {
         void ensure_backbuffer_(int rows, int cols);
         void full_redraw_() noexcept;
 
+        /// @brief 화면 크기 확인. 바뀌었으면 백버퍼/화면을 초기화한다
+        void sync_size_();
+
+        /// @brief [x0,x1) x [y0,y1) 셀 중 지난 present와 다른 것만 다시 그린다 (화면/frame으로 클립)
+        void draw_region_(const framedot::gfx::PixelFrame& frame, int x0, int y0, int x1, int y1) noexcept;
+
         bool m_inited{false};
         bool m_color_ok{false};
 
@@ -37,6 +51,7 @@ namespace framedot::platform::terminal {
         int m_cols{0};
 
         std::vector<std::uint32_t> m_prev;
+        bool m_need_full{true};   // 다음 present는 damage를 무시하고 전체
     };
 
 } // namespace framedot::platform::terminal
\ No newline at end of file
@@ -109,17 +109,10 @@ namespace framedot::platform::terminal {
     void TerminalSurface::full_redraw_() noexcept {
         // force next present to redraw all cells
         std::fill(m_prev.begin(), m_prev.end(), 0xFFFFFFFFu);
+        m_need_full = true;
     }
 
-    int TerminalSurface::poll_key() noexcept {
-        ensure_init_();
-        const int ch = getch();
-        return (ch == ERR) ? -1 : ch;
-    }
-
-    void TerminalSurface::present(const framedot::gfx::PixelFrame& frame) {
-        ensure_init_();
-
+    void TerminalSurface::sync_size_() {
         int rows = 0, cols = 0;
         getmaxyx(stdscr, rows, cols);
 
@@ -130,31 +123,69 @@ namespace framedot::platform::terminal {
             erase();
             full_redraw_();
         }
+    }
+
+    int TerminalSurface::poll_key() noexcept {
+        ensure_init_();
+        const int ch = getch();
+        return (ch == ERR) ? -1 : ch;
+    }
+
+    void TerminalSurface::present(const framedot::gfx::PixelFrame& frame) {
+        ensure_init_();
+        sync_size_();
+
+        if (frame.valid()) {
+            draw_region_(frame, 0, 0, static_cast<int>(frame.width), static_cast<int>(frame.height));
+            m_need_full = false;
+        }
+        refresh();
+    }
+
+    void TerminalSurface::present(const framedot::gfx::PixelFrame& frame,
+                                  std::span<const framedot::gfx::RectI> damage) {
+        ensure_init_();
+        sync_size_();
 
-        if (!frame.valid()) {
-            refresh();
+        if (m_need_full) {
+            present(frame);
             return;
         }
 
+        if (frame.valid()) {
+            for (const framedot::gfx::RectI& r : damage) draw_region_(frame, r.x0, r.y0, r.x1, r.y1);
+        }
+        refresh();
+    }
+
+    void TerminalSurface::draw_region_(const framedot::gfx::PixelFrame& frame,
+                                       int x0, int y0, int x1, int y1) noexcept {
         const int cw = static_cast<int>(frame.width);
         const int ch = static_cast<int>(frame.height);
 
-        const int draw_w = std::max(0, std::min(cols, cw));
-        const int draw_h = std::max(0, std::min(rows, ch));
+        x0 = std::max(x0, 0);
+        y0 = std::max(y0, 0);
+        x1 = std::min({x1, cw, m_cols});
+        y1 = std::min({y1, ch, m_rows});
+        if (x0 >= x1 || y0 >= y1) return;
 
         const std::uint32_t* src = frame.pixels.data();
         const int stride = static_cast<int>(frame.stride_pixels);
+        const int cols = m_cols;
 
-        for (int y = 0; y < draw_h; ++y) {
+        for (int y = y0; y < y1; ++y) {
             const int row_off_src = y * stride;
             const int row_off_dst = y * cols;
 
-            for (int x = 0; x < draw_w; ++x) {
-                const std::uint32_t p = src[row_off_src + x];
+            for (int x = x0; x < x1; ++x) {
+                const std::uint32_t raw = src[row_off_src + x];
 
                 const std::size_t di = static_cast<std::size_t>(row_off_dst + x);
-                if (m_prev[di] == p) continue;
-                m_prev[di] = p;
+                if (m_prev[di] == raw) continue;
+                m_prev[di] = raw;
+
+                // 변환은 실제로 바뀐 셀에서만 (premultiplied 캔버스 대응)
+                const std::uint32_t p = frame.straight(raw);
 
                 if (m_color_ok) {
                     const short bg = quantize_to_curses_bg(p);
@@ -189,8 +220,6 @@ namespace framedot::platform::terminal {
                 }
             }
         }
-
-        refresh();
     }
 
 } // namespace framedot::platform::terminal
\ No newline at end of file
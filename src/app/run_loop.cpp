@@ -8,10 +8,13 @@
  * - fixed_timestep=true는 "실시간"이 아니라 "결정론적 스텝퍼(테스트/헤드리스)"로 동작한다.
  *   => 매 tick마다 dt=fixed_dt로 update 1회 수행, max_frames는 tick 수 기준.
  * - fixed_timestep=false는 실시간 dt 기반 루프.
+ * - 롤백은 fixed_timestep에서만 동작한다. 되감기 요청이 오면 저장된 상태로 복원하고
+ *   update만 다시 돌린다(RenderPrep/픽셀화/present 생략).
  */
 #include <framedot/app/RunLoop.hpp>
 
 #include <framedot_internal/core/DefaultJobSystem.hpp>
+#include <framedot/ecs/Rollback.hpp>
 #include <framedot/gfx/SoftwareRenderer.hpp>
 #include <framedot/input/InputQueue.hpp>
 #include <framedot/input/InputState.hpp>
@@ -37,11 +40,15 @@ namespace framedot::app {
 
         framedot::core::JobSystem* jobs = framedot::core::internal::create_default_jobsystem(cfg.worker_threads);
 
-        framedot::gfx::RenderQueue rq;
+        framedot::gfx::RenderQueue rq(cfg.render_queue);
         framedot::gfx::SoftwareRenderer sw;
+        sw.set_dirty_tracking(cfg.dirty_tiles);
+        sw.set_profiling(cfg.render_profile);
+        sw.set_heatmap(cfg.render_heatmap);
 
         framedot::core::FrameContext ctx{};
         ctx.jobs = jobs;
+        ctx.textures = cfg.textures;
 
         std::uint64_t tick = 0;
         double time_sec = 0.0;
@@ -54,15 +61,25 @@ namespace framedot::app {
         // fixed timestep = deterministic stepper (test/headless)
         // ----------------------------
         if (cfg.fixed_timestep) {
+            framedot::ecs::RollbackBuffer* rollback = client.rollback();
+
+            // 재시뮬레이션 프레임에 넘길 빈 입력 (실제 입력은 클라이언트 기록을 사용)
+            framedot::input::InputState resim_state;
+            framedot::input::InputQueue resim_events;
+
             while (true) {
                 if (should_stop(tick)) break;
 
                 // ----------------------------
                 // [Stage 0] frame context
                 // ----------------------------
+                // 재시뮬레이션과 같은 값을 내도록 누적 대신 tick에서 계산
+                time_sec = (double)tick * cfg.fixed_dt;
+
                 ctx.frame_index = tick;
                 ctx.dt_seconds  = cfg.fixed_dt;
                 ctx.time_seconds = time_sec;
+                ctx.resimulating = false;
 
                 // ----------------------------
                 // [Stage 1] input
@@ -79,6 +96,36 @@ namespace framedot::app {
 
                 client.on_input(ctx);
 
+                // ----------------------------
+                // [Stage 1.5] rollback
+                // ----------------------------
+                if (rollback) {
+                    std::uint64_t target = 0;
+                    if (client.rollback_target(ctx, target) && target < tick && rollback->restore(target)) {
+                        framedot::core::FrameContext rctx = ctx;
+                        rctx.resimulating = true;
+                        rctx.input_state  = &resim_state;
+                        rctx.input_events = &resim_events;
+                        rctx.render_queue = nullptr;
+
+                        bool resim_ok = true;
+                        for (std::uint64_t f = target; f < tick; ++f) {
+                            // 수정된 과거 상태로 링을 갱신 (target은 방금 복원한 그대로)
+                            if (f != target) rollback->capture(f);
+
+                            rctx.frame_index  = f;
+                            rctx.time_seconds = (double)f * cfg.fixed_dt;
+                            resim_ok = client.update(rctx);
+                            jobs->wait_idle();
+                            if (!resim_ok) break;
+                        }
+                        if (!resim_ok) break;
+                    }
+
+                    // 이번 tick의 update 직전 상태
+                    rollback->capture(tick);
+                }
+
                 // ----------------------------
                 // [Stage 2] update
                 // ----------------------------
@@ -94,20 +141,21 @@ namespace framedot::app {
 
                 client.render_prep(ctx, rq);
                 jobs->wait_idle();
+                rq.end_frame();   // 워커 세그먼트 병합 (worker_segments 모드)
 
                 // ----------------------------
                 // [Stage 4] Raster
                 // ----------------------------
-                sw.execute(rq, canvas);
+                sw.execute(ctx, rq, canvas);   // ctx.jobs: 병렬 타일 실행/정렬, 워커 수 기반 타일 크기
+                if (cfg.render_profile) client.on_render_profile(ctx, sw);
 
                 // ----------------------------
                 // [Stage 5] Present
                 // ----------------------------
-                surface.present(canvas.frame());
+                surface.present(canvas.frame(), sw.damage());
 
                 // tick advance
                 ++tick;
-                time_sec += cfg.fixed_dt;
             }
 
             framedot::core::internal::destroy_default_jobsystem(jobs);
@@ -155,10 +203,12 @@ namespace framedot::app {
 
             client.render_prep(ctx, rq);
             jobs->wait_idle();
+            rq.end_frame();
 
             // raster + present
-            sw.execute(rq, canvas);
-            surface.present(canvas.frame());
+            sw.execute(ctx, rq, canvas);
+            if (cfg.render_profile) client.on_render_profile(ctx, sw);
+            surface.present(canvas.frame(), sw.damage());
 
             ++tick;
         }
@@ -0,0 +1,54 @@
+// src/core/cpu_features.cpp
+#include <framedot/core/CpuFeatures.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+  #define FRAMEDOT_CPUID_MSVC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define FRAMEDOT_CPUID_GNU 1
+#endif
+
+
+namespace framedot::core {
+
+    static CpuFeatures detect_() noexcept {
+        CpuFeatures f{};
+#if defined(FRAMEDOT_CPUID_GNU)
+        __builtin_cpu_init();
+        f.sse2  = __builtin_cpu_supports("sse2");
+        f.sse41 = __builtin_cpu_supports("sse4.1");
+        // __builtin_cpu_supports는 OSXSAVE/XCR0까지 확인한다.
+        f.avx   = __builtin_cpu_supports("avx");
+        f.avx2  = __builtin_cpu_supports("avx2");
+#elif defined(FRAMEDOT_CPUID_MSVC)
+        int r[4]{};
+        __cpuid(r, 0);
+        const int max_leaf = r[0];
+
+        __cpuid(r, 1);
+        f.sse2  = (r[3] & (1 << 26)) != 0;
+        f.sse41 = (r[2] & (1 << 19)) != 0;
+
+        const bool osxsave = (r[2] & (1 << 27)) != 0;
+        const bool avx_hw  = (r[2] & (1 << 28)) != 0;
+        bool ymm_ok = false;
+        if (osxsave) {
+            const unsigned long long xcr0 = _xgetbv(0);
+            ymm_ok = (xcr0 & 0x6u) == 0x6u;
+        }
+        f.avx = avx_hw && ymm_ok;
+
+        if (max_leaf >= 7) {
+            __cpuidex(r, 7, 0);
+            f.avx2 = f.avx && ((r[1] & (1 << 5)) != 0);
+        }
+#endif
+        return f;
+    }
+
+    const CpuFeatures& cpu_features() noexcept {
+        static const CpuFeatures f = detect_();
+        return f;
+    }
+
+} // namespace framedot::core
@@ -11,6 +11,26 @@
 #include <vector>
 
 
+namespace framedot::core {
+
+    static thread_local std::uint32_t t_worker_index = 0;
+    static thread_local const JobSystem* t_worker_owner = nullptr;
+
+    std::uint32_t JobSystem::current_worker_index() noexcept {
+        return t_worker_index;
+    }
+
+    const JobSystem* JobSystem::current_owner() noexcept {
+        return t_worker_owner;
+    }
+
+    void JobSystem::set_current_worker_index(std::uint32_t index, const JobSystem* owner) noexcept {
+        t_worker_index = index;
+        t_worker_owner = owner;
+    }
+
+} // namespace framedot::core
+
 namespace framedot::core::internal {
 
     /// @brief std 기반 간단한 ThreadPool
@@ -39,7 +59,10 @@ namespace framedot::core::internal {
 
             m_workers.reserve(worker_threads);
             for (std::uint32_t i = 0; i < worker_threads; ++i) {
-                m_workers.emplace_back([this]() { this->worker_loop_(); });
+                m_workers.emplace_back([this, i]() {
+                    set_current_worker_index(i + 1, this);
+                    this->worker_loop_();
+                });
             }
         }
 
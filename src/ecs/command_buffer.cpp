@@ -0,0 +1,95 @@
+// src/ecs/command_buffer.cpp
+/**
+ * @file command_buffer.cpp
+ * @brief CommandBuffer 재생/리셋 구현부
+ */
+#include <framedot/ecs/CommandBuffer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+
+namespace framedot::ecs {
+
+    std::span<CommandBuffer> CommandBuffer::fork(std::size_t n) {
+        // 늘어날 때만 재할당 (이전 span 무효화, 기록은 move로 보존). 줄이지는 않는다
+        if (m_children.size() < n) m_children.resize(n);
+        if (m_child_count < n) m_child_count = n;
+        return std::span<CommandBuffer>(m_children.data(), n);
+    }
+
+    void CommandBuffer::playback(Registry& reg) {
+        m_created.assign(m_pending_count, entt::entity{entt::null});
+
+        for (Record& r : m_records) {
+            switch (r.kind) {
+            case Kind::Create:
+                m_created[r.pending] = reg.create();
+                break;
+
+            case Kind::Destroy:
+                if (reg.valid(r.target)) reg.destroy(r.target);
+                break;
+
+            case Kind::Emplace:
+            case Kind::Remove:
+                if (reg.valid(r.target)) r.apply(reg, r.target, r.payload);
+                break;
+
+            case Kind::EmplacePending: {
+                const entt::entity e = (r.pending < m_created.size()) ? m_created[r.pending] : entt::entity{entt::null};
+                if (e != entt::null && reg.valid(e)) r.apply(reg, e, r.payload);
+                break;
+            }
+            }
+        }
+
+        const std::size_t nc = std::min(m_child_count, m_children.size());
+        for (std::size_t i = 0; i < nc; ++i) {
+            m_children[i].playback(reg);
+        }
+    }
+
+    CommandBuffer& CommandBuffer::operator=(CommandBuffer&& o) noexcept {
+        if (this == &o) return *this;
+
+        // 기본 대입은 기존 페이로드를 소멸자 없이 덮어쓴다
+        reset();
+
+        // 페이로드는 o의 arena에 있으므로 기록과 arena를 함께 옮기고, o는 빈 상태로 둔다
+        m_records = std::exchange(o.m_records, {});
+        m_arena = std::move(o.m_arena);
+        m_pending_count = std::exchange(o.m_pending_count, 0u);
+        m_created = std::exchange(o.m_created, {});
+        m_children = std::exchange(o.m_children, {});
+        m_child_count = std::exchange(o.m_child_count, 0u);
+        return *this;
+    }
+
+    void CommandBuffer::reset() noexcept {
+        for (Record& r : m_records) {
+            if (r.destroy && r.payload) r.destroy(r.payload);
+        }
+        m_records.clear();
+        m_arena.reset();
+        m_pending_count = 0;
+        m_created.clear();
+
+        // move된 버퍼는 m_children이 비어 있을 수 있으므로 실제 크기로 제한
+        const std::size_t nc = std::min(m_child_count, m_children.size());
+        for (std::size_t i = 0; i < nc; ++i) {
+            m_children[i].reset();
+        }
+        m_child_count = 0;
+    }
+
+    std::size_t CommandBuffer::size() const noexcept {
+        std::size_t n = m_records.size();
+        const std::size_t nc = std::min(m_child_count, m_children.size());
+        for (std::size_t i = 0; i < nc; ++i) {
+            n += m_children[i].size();
+        }
+        return n;
+    }
+
+} // namespace framedot::ecs
@@ -0,0 +1,227 @@
+// src/ecs/movement_2d.cpp
+/**
+ * @file movement_2d.cpp
+ * @brief Movement2D 시스템 구현부. SoA 블록 gather -> SIMD 적분 -> scatter
+ *
+ * 주의:
+ * - 병렬 구간에서는 pool 생성/구조 변경을 하지 않는다(스토리지는 메인에서 미리 확보).
+ * - 커널 연산 순서는 스칼라와 동일하게 유지한다(FMA 미사용) -> 경로와 무관하게 같은 결과.
+ */
+#include <framedot/ecs/systems/Movement2D.hpp>
+#include <framedot/ecs/components/Basic2D.hpp>
+#include <framedot/core/CpuFeatures.hpp>
+#include <framedot/core/Tasks.hpp>
+#include <framedot_internal/core/Simd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace framedot::ecs::systems {
+
+    // ----------------------------
+    // kernels
+    // ----------------------------
+
+    void integrate_soa_2d_scalar(const MovementSoA2D& s, float dt) noexcept {
+        for (std::size_t i = 0; i < s.count; ++i) {
+            const float vx = (s.vx[i] + s.ax[i] * dt) * s.damp[i];
+            const float vy = (s.vy[i] + s.ay[i] * dt) * s.damp[i];
+            s.vx[i] = vx;
+            s.vy[i] = vy;
+            s.px[i] = s.px[i] + vx * dt;
+            s.py[i] = s.py[i] + vy * dt;
+        }
+    }
+
+#if FRAMEDOT_SIMD_X86
+    FRAMEDOT_TARGET("sse2")
+    static void integrate_sse_(const MovementSoA2D& s, float dt) noexcept {
+        const __m128 vdt = _mm_set1_ps(dt);
+        std::size_t i = 0;
+        for (; i + 4 <= s.count; i += 4) {
+            const __m128 d  = _mm_loadu_ps(s.damp + i);
+            const __m128 vx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(s.vx + i), _mm_mul_ps(_mm_loadu_ps(s.ax + i), vdt)), d);
+            const __m128 vy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(s.vy + i), _mm_mul_ps(_mm_loadu_ps(s.ay + i), vdt)), d);
+            _mm_storeu_ps(s.vx + i, vx);
+            _mm_storeu_ps(s.vy + i, vy);
+            _mm_storeu_ps(s.px + i, _mm_add_ps(_mm_loadu_ps(s.px + i), _mm_mul_ps(vx, vdt)));
+            _mm_storeu_ps(s.py + i, _mm_add_ps(_mm_loadu_ps(s.py + i), _mm_mul_ps(vy, vdt)));
+        }
+
+        MovementSoA2D tail = s;
+        tail.px += i; tail.py += i; tail.vx += i; tail.vy += i;
+        tail.ax += i; tail.ay += i; tail.damp += i;
+        tail.count = s.count - i;
+        integrate_soa_2d_scalar(tail, dt);
+    }
+
+    FRAMEDOT_TARGET("avx")
+    static void integrate_avx_(const MovementSoA2D& s, float dt) noexcept {
+        const __m256 vdt = _mm256_set1_ps(dt);
+        std::size_t i = 0;
+        for (; i + 8 <= s.count; i += 8) {
+            const __m256 d  = _mm256_loadu_ps(s.damp + i);
+            const __m256 vx = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(s.vx + i), _mm256_mul_ps(_mm256_loadu_ps(s.ax + i), vdt)), d);
+            const __m256 vy = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(s.vy + i), _mm256_mul_ps(_mm256_loadu_ps(s.ay + i), vdt)), d);
+            _mm256_storeu_ps(s.vx + i, vx);
+            _mm256_storeu_ps(s.vy + i, vy);
+            _mm256_storeu_ps(s.px + i, _mm256_add_ps(_mm256_loadu_ps(s.px + i), _mm256_mul_ps(vx, vdt)));
+            _mm256_storeu_ps(s.py + i, _mm256_add_ps(_mm256_loadu_ps(s.py + i), _mm256_mul_ps(vy, vdt)));
+        }
+
+        MovementSoA2D tail = s;
+        tail.px += i; tail.py += i; tail.vx += i; tail.vy += i;
+        tail.ax += i; tail.ay += i; tail.damp += i;
+        tail.count = s.count - i;
+        integrate_sse_(tail, dt);
+    }
+#endif
+
+    MovementKernel2D integrate_soa_2d_for(MovementIsa isa) noexcept {
+        switch (isa) {
+        case MovementIsa::Scalar:
+            return &integrate_soa_2d_scalar;
+#if FRAMEDOT_SIMD_X86
+        case MovementIsa::SSE:
+            return framedot::core::cpu_features().sse2 ? &integrate_sse_ : nullptr;
+        case MovementIsa::AVX:
+            return framedot::core::cpu_features().avx ? &integrate_avx_ : nullptr;
+#endif
+        default:
+            return nullptr;
+        }
+    }
+
+    struct KernelChoice {
+        MovementKernel2D fn;
+        const char* name;
+    };
+
+    static KernelChoice select_kernel_() noexcept {
+        if (const auto fn = integrate_soa_2d_for(MovementIsa::AVX)) return {fn, "avx"};
+        if (const auto fn = integrate_soa_2d_for(MovementIsa::SSE)) return {fn, "sse"};
+        return {&integrate_soa_2d_scalar, "scalar"};
+    }
+
+    static const KernelChoice& kernel_() noexcept {
+        static const KernelChoice k = select_kernel_();
+        return k;
+    }
+
+    void integrate_soa_2d(const MovementSoA2D& soa, float dt) noexcept {
+        kernel_().fn(soa, dt);
+    }
+
+    const char* movement_2d_kernel_name() noexcept {
+        return kernel_().name;
+    }
+
+    // ----------------------------
+    // system
+    // ----------------------------
+
+    /// @brief gather 블록 크기 (L1에 들어가는 크기, AVX 폭의 배수)
+    static constexpr std::size_t kBlock = 512;
+
+    /// @brief 이 개수 미만이면 병렬 분할하지 않는다.
+    static constexpr std::size_t kParallelMin = 4096;
+
+    struct alignas(32) SoABlock {
+        float px[kBlock], py[kBlock];
+        float vx[kBlock], vy[kBlock];
+        float ax[kBlock], ay[kBlock];
+        float damp[kBlock];
+        Transform2D* t[kBlock];
+        Velocity2D*  v[kBlock];
+    };
+
+    void install_movement_2d(World& world, Phase phase) {
+        world.add_write_system(phase,
+            [](const framedot::core::FrameContext& ctx, World::Registry& reg) {
+                auto& vel = reg.storage<Velocity2D>();
+                auto& tr  = reg.storage<Transform2D>();
+                auto& acc = reg.storage<Acceleration2D>();
+                auto& dmp = reg.storage<Damping2D>();
+
+                const std::size_t n = vel.size();
+                if (n == 0) return;
+
+                const float dt = (float)ctx.dt_seconds;
+                const entt::entity* ents = vel.data();
+
+                auto run_range = [&](std::size_t b, std::size_t e) noexcept {
+                    SoABlock blk;
+
+                    for (std::size_t i = b; i < e; ) {
+                        // 1) gather (Transform2D가 없는 엔티티는 건너뜀)
+                        std::size_t m = 0;
+                        for (; i < e && m < kBlock; ++i) {
+                            const entt::entity ent = ents[i];
+                            if (!tr.contains(ent)) continue;
+
+                            Transform2D& t = tr.get(ent);
+                            Velocity2D&  v = vel.get(ent);
+                            blk.t[m] = &t;
+                            blk.v[m] = &v;
+                            blk.px[m] = t.position.x;
+                            blk.py[m] = t.position.y;
+                            blk.vx[m] = v.v.x;
+                            blk.vy[m] = v.v.y;
+
+                            if (acc.contains(ent)) {
+                                const auto& a = acc.get(ent);
+                                blk.ax[m] = a.a.x;
+                                blk.ay[m] = a.a.y;
+                            } else {
+                                blk.ax[m] = 0.0f;
+                                blk.ay[m] = 0.0f;
+                            }
+
+                            blk.damp[m] = dmp.contains(ent)
+                                ? 1.0f / (1.0f + dmp.get(ent).damping * dt)
+                                : 1.0f;
+                            ++m;
+                        }
+                        if (m == 0) continue;
+
+                        // 2) SIMD 적분
+                        MovementSoA2D soa{};
+                        soa.px = blk.px; soa.py = blk.py;
+                        soa.vx = blk.vx; soa.vy = blk.vy;
+                        soa.ax = blk.ax; soa.ay = blk.ay;
+                        soa.damp = blk.damp;
+                        soa.count = m;
+                        integrate_soa_2d(soa, dt);
+
+                        // 3) scatter
+                        for (std::size_t k = 0; k < m; ++k) {
+                            blk.t[k]->position.x = blk.px[k];
+                            blk.t[k]->position.y = blk.py[k];
+                            blk.v[k]->v.x = blk.vx[k];
+                            blk.v[k]->v.y = blk.vy[k];
+                        }
+                    }
+                };
+
+                if (ctx.jobs && ctx.jobs->worker_count() > 0 && n >= kParallelMin) {
+                    framedot::core::TaskGroup tg(ctx.jobs, framedot::core::JobLane::Engine);
+
+                    const std::size_t chunks = (std::size_t)ctx.jobs->worker_count();
+                    const std::size_t chunk_size = (n + chunks - 1) / chunks;
+
+                    for (std::size_t ci = 0; ci < chunks; ++ci) {
+                        const std::size_t b = ci * chunk_size;
+                        const std::size_t e = (b + chunk_size < n) ? (b + chunk_size) : n;
+                        if (b >= e) continue;
+                        tg.run([&, b, e]() noexcept { run_range(b, e); });
+                    }
+                    tg.wait();
+                } else {
+                    run_range(0, n);
+                }
+            }
+        );
+    }
+
+} // namespace framedot::ecs::systems
@@ -0,0 +1,135 @@
+// src/ecs/rollback.cpp
+/**
+ * @file rollback.cpp
+ * @brief RollbackBuffer 저장/복원/소유권 이전 구현부
+ */
+#include <framedot/ecs/Rollback.hpp>
+
+#include <utility>
+
+
+namespace framedot::ecs {
+
+    void RollbackBuffer::init_(std::size_t frames) {
+        const std::size_t n = frames ? frames : 1;
+        const std::size_t pools = m_ops.size();
+
+        m_slots.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            m_slots[i].own.resize(pools);
+            m_slots[i].ref.assign(pools, (std::uint32_t)i);
+        }
+    }
+
+    void RollbackBuffer::release_(std::size_t si) noexcept {
+        Slot& s = m_slots[si];
+        if (!s.valid) return;
+
+        for (std::size_t p = 0; p < m_ops.size(); ++p) {
+            if (s.ref[p] != si) continue;
+
+            // 이 슬롯의 버퍼를 참조하는 슬롯 중 가장 오래된 쪽이 새 소유자
+            std::size_t heir = si;
+            for (std::size_t j = 0; j < m_slots.size(); ++j) {
+                const Slot& o = m_slots[j];
+                if (j == si || !o.valid || o.ref[p] != si) continue;
+                if (heir == si || o.frame < m_slots[heir].frame) heir = j;
+            }
+            if (heir == si) continue;
+
+            std::swap(m_slots[heir].own[p], s.own[p]);
+            for (Slot& o : m_slots) {
+                if (o.valid && o.ref[p] == si) o.ref[p] = (std::uint32_t)heir;
+            }
+        }
+
+        s.valid = false;
+        for (std::size_t p = 0; p < s.ref.size(); ++p) s.ref[p] = (std::uint32_t)si;
+    }
+
+    void RollbackBuffer::capture(std::uint64_t frame) {
+        const std::size_t si = (std::size_t)(frame % m_slots.size());
+        release_(si);
+
+        // 직전 프레임 슬롯 (COW 비교 대상)
+        const Slot* prev = nullptr;
+        if (frame > 0) {
+            const Slot& c = m_slots[(std::size_t)((frame - 1) % m_slots.size())];
+            if (c.valid && c.frame == frame - 1 && &c != &m_slots[si]) prev = &c;
+        }
+
+        // release_ 이후 slot.own은 이 슬롯만 쓰는 버퍼다 (소유권은 이미 넘겼다)
+        Slot& slot = m_slots[si];
+        for (std::size_t p = 0; p < m_ops.size(); ++p) {
+            const Plan plan = m_ops[p].plan(*m_reg);
+
+            // 직렬화 전에 registry를 직전 프레임 데이터와 직접 비교 -> 같으면 쓰지 않고 참조
+            if (prev) {
+                const Blob& pb = blob_(*prev, p);
+                if (pb.count == plan.count && pb.aux == plan.aux && pb.bytes.size() == plan.bytes
+                    && m_ops[p].same(*m_reg, pb.bytes.data(), plan.count)) {
+                    slot.ref[p] = prev->ref[p];
+                    continue;
+                }
+            }
+
+            Blob& b = slot.own[p];
+            b.bytes.resize((std::size_t)plan.bytes);
+            b.count = plan.count;
+            b.aux = plan.aux;
+            m_ops[p].write(*m_reg, b.bytes.data(), plan.count);
+            slot.ref[p] = (std::uint32_t)si;
+        }
+
+        slot.frame = frame;
+        slot.valid = true;
+    }
+
+    bool RollbackBuffer::restore(std::uint64_t frame) {
+        const Slot& slot = m_slots[(std::size_t)(frame % m_slots.size())];
+        if (!slot.valid || slot.frame != frame) return false;
+
+        // p=0은 entity 테이블 (registry clear 포함) -> 먼저 복원
+        for (std::size_t p = 0; p < m_ops.size(); ++p) {
+            const Blob& b = blob_(slot, p);
+            m_ops[p].restore(*m_reg, b.bytes.data(), b.count, b.aux);
+        }
+        return true;
+    }
+
+    bool RollbackBuffer::contains(std::uint64_t frame) const noexcept {
+        const Slot& slot = m_slots[(std::size_t)(frame % m_slots.size())];
+        return slot.valid && slot.frame == frame;
+    }
+
+    bool RollbackBuffer::oldest_frame(std::uint64_t& out) const noexcept {
+        bool found = false;
+        for (const Slot& s : m_slots) {
+            if (!s.valid) continue;
+            if (!found || s.frame < out) out = s.frame;
+            found = true;
+        }
+        return found;
+    }
+
+    void RollbackBuffer::clear() noexcept {
+        for (std::size_t i = 0; i < m_slots.size(); ++i) {
+            Slot& s = m_slots[i];
+            s.valid = false;
+            for (std::size_t p = 0; p < s.ref.size(); ++p) s.ref[p] = (std::uint32_t)i;
+        }
+    }
+
+    std::size_t RollbackBuffer::resident_bytes() const noexcept {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < m_slots.size(); ++i) {
+            const Slot& s = m_slots[i];
+            if (!s.valid) continue;
+            for (std::size_t p = 0; p < s.ref.size(); ++p) {
+                if (s.ref[p] == i) n += s.own[p].bytes.size();
+            }
+        }
+        return n;
+    }
+
+} // namespace framedot::ecs
@@ -0,0 +1,382 @@
+// src/ecs/snapshot.cpp
+/**
+ * @file snapshot.cpp
+ * @brief 스냅샷 레이아웃/검증/delta 인코딩 구현부
+ */
+#include <framedot/ecs/Snapshot.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace framedot::ecs {
+
+    namespace {
+
+        /// @brief delta 비교 단위 (바이트)
+        constexpr std::uint32_t kDeltaBlockBytes = 256;
+
+        constexpr std::size_t table_end(std::size_t section_count) noexcept {
+            return snapshot_align16(sizeof(SnapshotHeader) + section_count * sizeof(SnapshotSection));
+        }
+
+        /// @brief 섹션 하나의 최대 바이트 (count * elem_size 오버플로 방지용 상한)
+        constexpr std::uint64_t kMaxSectionBytes = 1ull << 48;
+
+        /// @brief full 섹션으로 복원했을 때의 바이트 수
+        std::uint64_t full_bytes(const SnapshotSection& s) noexcept {
+            if (s.type_id == kSnapshotEntitySection) return s.count * s.elem_size;
+            if (s.count == 0) return 0;
+            return snapshot_detail::component_offset(s.count) + s.count * s.elem_size;
+        }
+
+        SnapshotSection* sections_of(std::vector<std::byte>& out) noexcept {
+            return reinterpret_cast<SnapshotSection*>(out.data() + sizeof(SnapshotHeader));
+        }
+
+        /// @brief out 끝을 16 정렬 후 bytes만큼 늘린다. 반환: 새 영역 오프셋
+        std::size_t append_(std::vector<std::byte>& out, std::size_t bytes) {
+            const std::size_t ofs = snapshot_align16(out.size());
+            out.resize(ofs + bytes);
+            return ofs;
+        }
+
+    } // namespace
+
+    // ----------------------------
+    // SnapshotView
+    // ----------------------------
+
+    bool SnapshotView::parse(std::span<const std::byte> bytes, SnapshotView& out) noexcept {
+        out = SnapshotView{};
+        if (bytes.size() < sizeof(SnapshotHeader)) return false;
+        if ((reinterpret_cast<std::uintptr_t>(bytes.data()) & 15u) != 0) return false;
+
+        const auto* h = reinterpret_cast<const SnapshotHeader*>(bytes.data());
+        if (h->magic != kSnapshotMagic || h->version != kSnapshotVersion) return false;
+        if (h->total_bytes != bytes.size()) return false;
+        if (h->section_count == 0 || table_end(h->section_count) > bytes.size()) return false;
+
+        const auto* secs = reinterpret_cast<const SnapshotSection*>(bytes.data() + sizeof(SnapshotHeader));
+        const bool delta = (h->flags & kSnapshotDelta) != 0;
+
+        for (std::uint32_t i = 0; i < h->section_count; ++i) {
+            const SnapshotSection& s = secs[i];
+
+            // 크기 필드: full_bytes()가 넘치지 않아야 종류별 검사가 의미 있다
+            if (s.elem_size == 0 || s.count > kMaxSectionBytes / s.elem_size) return false;
+            if (s.type_id == kSnapshotEntitySection && s.aux > s.count) return false;   // free_list <= 전체
+
+            const std::uint64_t full = full_bytes(s);
+            switch (s.kind) {
+            case SnapshotSectionKind::Full:
+                if (s.bytes != full) return false;
+                break;
+            case SnapshotSectionKind::Patch:
+                if (!delta || full == 0 || s.bytes < 8) return false;
+                break;
+            case SnapshotSectionKind::Same:
+                if (!delta || s.bytes != 0) return false;
+                break;
+            default:
+                return false;
+            }
+
+            // 데이터 없는 섹션은 offset 0, 있으면 16 정렬 + 테이블 뒤 + 버퍼 안
+            if (s.bytes == 0) {
+                if (s.offset != 0) return false;
+                continue;
+            }
+            if ((s.offset & 15u) != 0) return false;
+            if (s.offset < table_end(h->section_count) || s.offset > bytes.size()) return false;
+            if (s.bytes > bytes.size() - s.offset) return false;
+        }
+
+        out.m_bytes = bytes;
+        out.m_header = h;
+        out.m_sections = std::span<const SnapshotSection>(secs, h->section_count);
+        return true;
+    }
+
+    const SnapshotSection* SnapshotView::find(std::uint32_t type_id) const noexcept {
+        for (const SnapshotSection& s : m_sections) {
+            if (s.type_id == type_id) return &s;
+        }
+        return nullptr;
+    }
+
+    std::uint64_t snapshot_checksum(std::span<const std::byte> bytes) noexcept {
+        // 8바이트 단위 multiply-xor. 암호학적 용도 아님.
+        constexpr std::uint64_t kMul = 0x9E3779B97F4A7C15ull;
+        std::uint64_t h = 0xCBF29CE484222325ull ^ (std::uint64_t)bytes.size();
+
+        const std::byte* p = bytes.data();
+        std::size_t n = bytes.size();
+        for (; n >= 8; n -= 8, p += 8) {
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            h = (h ^ w) * kMul;
+            h ^= h >> 29;
+        }
+        if (n) {
+            std::uint64_t w = 0;
+            std::memcpy(&w, p, n);
+            h = (h ^ w) * kMul;
+            h ^= h >> 29;
+        }
+        return h;
+    }
+
+    // ----------------------------
+    // layout
+    // ----------------------------
+
+    std::byte* snapshot_detail::layout(std::vector<std::byte>& out, std::uint64_t frame, Plan* plans, std::size_t n) {
+        std::size_t ofs = table_end(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            plans[i].offset = ofs;
+            ofs = snapshot_align16(ofs + (std::size_t)plans[i].bytes);
+        }
+
+        // 패딩 바이트도 결정적으로 남도록 0으로 채운다 (delta 비교 안정성)
+        out.assign(ofs, std::byte{0});
+
+        SnapshotHeader h{};
+        h.section_count = (std::uint32_t)n;
+        h.frame = frame;
+        h.total_bytes = ofs;
+        std::memcpy(out.data(), &h, sizeof(h));
+
+        SnapshotSection* secs = sections_of(out);
+        for (std::size_t i = 0; i < n; ++i) {
+            SnapshotSection s{};
+            s.type_id = plans[i].type_id;
+            s.elem_size = plans[i].elem_size;
+            s.kind = SnapshotSectionKind::Full;
+            s.aux = plans[i].aux;
+            s.count = plans[i].count;
+            s.offset = plans[i].bytes ? plans[i].offset : 0;
+            s.bytes = plans[i].bytes;
+            secs[i] = s;
+        }
+        return out.data();
+    }
+
+    // ----------------------------
+    // delta
+    // ----------------------------
+
+    bool snapshot_detail::index_entities(const entt::entity* ids, std::uint64_t count, std::vector<std::uint32_t>& slot) {
+        // 인덱스 수보다 많으면 반드시 겹친다 (slot 크기 상한도 된다)
+        const std::uint32_t max_index = entt::to_entity(entt::null);
+        if (count > max_index) return false;
+
+        std::uint32_t top = 0;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            if (ids[i] == entt::null) return false;
+            top = std::max(top, (std::uint32_t)entt::to_entity(ids[i]));
+        }
+
+        slot.assign(count ? (std::size_t)top + 1 : 0u, 0u);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::uint32_t& s = slot[entt::to_entity(ids[i])];
+            if (s != 0) return false;
+            s = (std::uint32_t)i + 1u;
+        }
+        return true;
+    }
+
+    bool snapshot_detail::valid_pool_ids(const entt::entity* ids, std::uint64_t count,
+                                         const entt::entity* table, std::uint32_t in_use,
+                                         std::vector<std::uint32_t>& slot) noexcept {
+        constexpr std::uint32_t kSeen = 0x80000000u;   // 테이블 위치는 인덱스 수(< 2^31)보다 작다
+
+        std::uint64_t marked = 0;
+        bool ok = true;
+        for (; marked < count; ++marked) {
+            const entt::entity e = ids[marked];
+            const std::size_t idx = (std::size_t)entt::to_entity(e);
+            if (e == entt::null || idx >= slot.size()) { ok = false; break; }
+
+            const std::uint32_t s = slot[idx];
+            if (s == 0 || (s & kSeen) || s > in_use || table[s - 1u] != e) { ok = false; break; }
+            slot[idx] = s | kSeen;
+        }
+
+        for (std::uint64_t i = 0; i < marked; ++i) slot[(std::size_t)entt::to_entity(ids[i])] &= ~kSeen;
+        return ok;
+    }
+
+    bool write_snapshot_delta(const SnapshotView& base, const SnapshotView& cur, std::vector<std::byte>& out) {
+        if (!base.valid() || !cur.valid() || base.is_delta() || cur.is_delta()) return false;
+
+        const std::size_t n = cur.sections().size();
+        out.assign(table_end(n), std::byte{0});
+
+        std::vector<std::uint32_t> changed;
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const SnapshotSection& cs = cur.sections()[i];
+            const SnapshotSection* bs = base.find(cs.type_id);
+
+            SnapshotSection ds = cs;
+            ds.offset = 0;
+            ds.bytes = 0;
+
+            const bool same_shape = bs && bs->elem_size == cs.elem_size && bs->count == cs.count
+                                       && bs->aux == cs.aux && bs->bytes == cs.bytes;
+
+            if (!same_shape) {
+                // 모양이 다르면 전체 복사
+                ds.kind = SnapshotSectionKind::Full;
+                if (cs.bytes) {
+                    const std::size_t ofs = append_(out, (std::size_t)cs.bytes);
+                    std::memcpy(out.data() + ofs, cur.section_data(cs), (std::size_t)cs.bytes);
+                    ds.offset = ofs;
+                    ds.bytes = cs.bytes;
+                }
+                sections_of(out)[i] = ds;
+                continue;
+            }
+
+            // 블록 단위 비교
+            const std::byte* a = base.section_data(*bs);
+            const std::byte* b = cur.section_data(cs);
+            const std::size_t total = (std::size_t)cs.bytes;
+            const std::size_t blocks = (total + kDeltaBlockBytes - 1) / kDeltaBlockBytes;
+
+            changed.clear();
+            std::size_t payload = 0;
+            for (std::size_t k = 0; k < blocks; ++k) {
+                const std::size_t o = k * kDeltaBlockBytes;
+                const std::size_t len = std::min<std::size_t>(kDeltaBlockBytes, total - o);
+                if (std::memcmp(a + o, b + o, len) != 0) {
+                    changed.push_back((std::uint32_t)k);
+                    payload += len;
+                }
+            }
+
+            if (changed.empty()) {
+                ds.kind = SnapshotSectionKind::Same;
+                sections_of(out)[i] = ds;
+                continue;
+            }
+
+            // [block_bytes][block_count][indices...][pad16][blocks...]
+            const std::size_t index_bytes = snapshot_align16(8 + changed.size() * 4);
+            const std::size_t ofs = append_(out, index_bytes + payload);
+            std::byte* dst = out.data() + ofs;
+
+            const std::uint32_t hdr[2] = { kDeltaBlockBytes, (std::uint32_t)changed.size() };
+            std::memcpy(dst, hdr, sizeof(hdr));
+            std::memcpy(dst + 8, changed.data(), changed.size() * 4);
+
+            std::byte* blk = dst + index_bytes;
+            for (std::uint32_t k : changed) {
+                const std::size_t o = (std::size_t)k * kDeltaBlockBytes;
+                const std::size_t len = std::min<std::size_t>(kDeltaBlockBytes, total - o);
+                std::memcpy(blk, b + o, len);
+                blk += len;
+            }
+
+            ds.kind = SnapshotSectionKind::Patch;
+            ds.offset = ofs;
+            ds.bytes = index_bytes + payload;
+            sections_of(out)[i] = ds;
+        }
+
+        out.resize(snapshot_align16(out.size()));
+
+        SnapshotHeader h = cur.header();
+        h.flags = (std::uint16_t)(h.flags | kSnapshotDelta);
+        h.section_count = (std::uint32_t)n;
+        h.base_frame = base.frame();
+        h.base_checksum = snapshot_checksum(base.bytes());
+        h.total_bytes = out.size();
+        std::memcpy(out.data(), &h, sizeof(h));
+        return true;
+    }
+
+    bool apply_snapshot_delta(const SnapshotView& base, const SnapshotView& delta, std::vector<std::byte>& out) {
+        if (!base.valid() || !delta.valid() || base.is_delta() || !delta.is_delta()) return false;
+
+        const SnapshotHeader& dh = delta.header();
+        if (dh.base_frame != base.frame()) return false;
+        if (dh.base_checksum != snapshot_checksum(base.bytes())) return false;
+
+        // 1) base 호환 검증 + 결과 레이아웃 계산
+        const std::size_t n = delta.sections().size();
+        std::size_t total = table_end(n);
+        for (const SnapshotSection& ds : delta.sections()) {
+            if (ds.kind != SnapshotSectionKind::Full) {
+                const SnapshotSection* bs = base.find(ds.type_id);
+                if (!bs || bs->bytes != full_bytes(ds) || bs->elem_size != ds.elem_size) return false;
+            }
+            total = snapshot_align16(total + (std::size_t)full_bytes(ds));
+        }
+
+        out.assign(total, std::byte{0});
+
+        SnapshotHeader h = dh;
+        h.flags = (std::uint16_t)(h.flags & ~kSnapshotDelta);
+        h.base_frame = 0;
+        h.base_checksum = 0;
+        h.total_bytes = total;
+        std::memcpy(out.data(), &h, sizeof(h));
+
+        // 2) 섹션 재구성
+        std::size_t ofs = table_end(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const SnapshotSection& ds = delta.sections()[i];
+            const std::size_t bytes = (std::size_t)full_bytes(ds);
+
+            SnapshotSection s = ds;
+            s.kind = SnapshotSectionKind::Full;
+            s.offset = bytes ? ofs : 0;
+            s.bytes = bytes;
+            sections_of(out)[i] = s;
+
+            std::byte* dst = out.data() + ofs;
+            switch (ds.kind) {
+            case SnapshotSectionKind::Full:
+                if (bytes) std::memcpy(dst, delta.section_data(ds), bytes);
+                break;
+
+            case SnapshotSectionKind::Same:
+                if (bytes) std::memcpy(dst, base.section_data(*base.find(ds.type_id)), bytes);
+                break;
+
+            case SnapshotSectionKind::Patch: {
+                std::memcpy(dst, base.section_data(*base.find(ds.type_id)), bytes);
+
+                const std::byte* src = delta.section_data(ds);
+                std::uint32_t hdr[2];
+                if (ds.bytes < sizeof(hdr)) return false;
+                std::memcpy(hdr, src, sizeof(hdr));
+                const std::uint32_t block = hdr[0];
+                const std::uint32_t count = hdr[1];
+                const std::size_t index_bytes = snapshot_align16(8 + (std::size_t)count * 4);
+                if (block == 0 || index_bytes > ds.bytes) return false;
+
+                const std::byte* blk = src + index_bytes;
+                const std::byte* end = src + ds.bytes;
+                for (std::uint32_t j = 0; j < count; ++j) {
+                    std::uint32_t k;
+                    std::memcpy(&k, src + 8 + (std::size_t)j * 4, 4);
+                    const std::size_t o = (std::size_t)k * block;
+                    if (o >= bytes) return false;
+                    const std::size_t len = std::min<std::size_t>(block, bytes - o);
+                    if ((std::size_t)(end - blk) < len) return false;
+                    std::memcpy(dst + o, blk, len);
+                    blk += len;
+                }
+                break;
+            }
+            }
+
+            ofs = snapshot_align16(ofs + bytes);
+        }
+        return true;
+    }
+
+} // namespace framedot::ecs
@@ -5,6 +5,7 @@
  *
  * 주의:
  * - tick 내부 병렬 대기는 JobSystem 전체 idle이 아니라, 이번 phase에서 던진 일만 기다린다.
+ * - 지연 커맨드는 Phase 끝에서 시스템 등록 순서대로 재생한다(워커 스케줄과 무관하게 결정적).
  */
 #include <framedot/ecs/World.hpp>
 #include <framedot/core/Tasks.hpp>
@@ -15,7 +16,26 @@ namespace framedot::ecs {
     void World::add_read_system(Phase phase, ReadSystem fn) {
         // 빈 함수면 return
         if (!fn) return;
-        m_read[phase_index_(phase)].push_back(std::move(fn));
+        ReadEntry r{};
+        r.fn = std::move(fn);
+        m_read[phase_index_(phase)].push_back(std::move(r));
+    }
+
+    void World::add_read_system(Phase phase, ReadCmdSystem fn) {
+        if (!fn) return;
+        ReadEntry r{};
+        r.fn_cmd = std::move(fn);
+        m_read[phase_index_(phase)].push_back(std::move(r));
+    }
+
+    void World::run_read_(ReadEntry& r, const framedot::core::FrameContext& ctx) {
+        const Registry& reg = m_reg;
+        if (r.fn) {
+            r.fn(ctx, reg);
+        } else {
+            r.cmds.reset();
+            r.fn_cmd(ctx, reg, r.cmds);
+        }
     }
 
     void World::add_write_system(Phase phase, WriteSystem fn) {
@@ -30,6 +50,9 @@ namespace framedot::ecs {
         for (std::size_t pi = 0; pi < static_cast<std::size_t>(Phase::Count); ++pi) {
             const Phase p = static_cast<Phase>(pi);
 
+            // 재시뮬레이션 프레임은 그리지 않는다.
+            if (p == Phase::RenderPrep && ctx.resimulating) continue;
+
             // ----------------------------
             // 0) RenderPrep는 ECS가 begin_frame을 관리한다. (유저 편의)
             // ----------------------------
@@ -48,17 +71,18 @@ namespace framedot::ecs {
                 if (jobs && jobs->worker_count() > 0) {
                     framedot::core::TaskGroup tg(jobs, framedot::core::JobLane::Engine);
 
-                    for (auto& fn : reads) {
-                        tg.run([ctxp, this, f = fn]() mutable {
-                            f(*ctxp, static_cast<const Registry&>(this->m_reg));
+                    for (auto& r : reads) {
+                        ReadEntry* rp = &r;
+                        tg.run([ctxp, this, rp]() {
+                            this->run_read_(*rp, *ctxp);
                         });
                     }
 
                     // 이번 phase에서 던진 것만 기다림 (jobs 전체 idle 아님!)
                     tg.wait();
                 } else {
-                    for (auto& fn : reads) {
-                        fn(ctx, static_cast<const Registry&>(m_reg));
+                    for (auto& r : reads) {
+                        run_read_(r, ctx);
                     }
                 }
             }
@@ -70,6 +94,15 @@ namespace framedot::ecs {
             for (auto& fn : writes) {
                 fn(ctx, m_reg);
             }
+
+            // ----------------------------
+            // 3) 지연 커맨드 재생: 등록 순서대로 (결정적)
+            // ----------------------------
+            for (auto& r : reads) {
+                if (r.fn_cmd && !r.cmds.empty()) {
+                    r.cmds.playback(m_reg);
+                }
+            }
         }
     }
 
@@ -4,6 +4,7 @@
  * @brief PixelCanvas의 구현부.
  */
 #include <framedot/gfx/PixelCanvas.hpp>
+#include <framedot_internal/gfx/RasterKernels.hpp>
 
 
 namespace framedot::gfx {
@@ -25,16 +26,27 @@ namespace framedot::gfx {
         return (u8(c.r) << 24) | (u8(c.g) << 16) | (u8(c.b) << 8) | (u8(c.a));
     }
 
+    PixelCanvas::Pixel PixelCanvas::encode(ColorRGBA8 c) const noexcept {
+        return premultiplied() ? internal::pack_premul(c) : pack(c);
+    }
+
+    void PixelCanvas::set_format(PixelFormat f) noexcept {
+        if (f == m_format) return;
+        for (Pixel& p : m_pixels) {
+            p = (f == PixelFormat::RGBA8888Premul) ? internal::premultiply(p) : PixelFrame::unpremultiply(p);
+        }
+        m_format = f;
+    }
+
     void PixelCanvas::clear(ColorRGBA8 c) noexcept {
-        const Pixel p = pack(c);
-        for (auto& px : m_pixels) px = p;
+        internal::fill_span(m_pixels.data(), m_pixels.size(), encode(c));
     }
 
     void PixelCanvas::put_pixel(std::int32_t x, std::int32_t y, ColorRGBA8 c) noexcept {
         if (x < 0 || y < 0) return;
         if (static_cast<std::uint32_t>(x) >= m_w) return;
         if (static_cast<std::uint32_t>(y) >= m_h) return;
-        m_pixels[static_cast<std::size_t>(y) * m_w + static_cast<std::size_t>(x)] = pack(c);
+        m_pixels[static_cast<std::size_t>(y) * m_w + static_cast<std::size_t>(x)] = encode(c);
     }
 
 } // namespace framedot::gfx
\ No newline at end of file
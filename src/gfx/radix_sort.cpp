@@ -0,0 +1,205 @@
+// src/gfx/radix_sort.cpp
+/**
+ * @file radix_sort.cpp
+ * @brief 커맨드 순서용 안정 LSD radix sort 구현 (순차/청크 병렬)
+ */
+#include <framedot_internal/gfx/RadixSort.hpp>
+#include <framedot/core/Tasks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+
+namespace framedot::gfx::internal {
+
+    namespace {
+
+        constexpr std::size_t kMaxChunks = 16;
+        constexpr std::size_t kMinChunkItems = 2048;
+
+        using Hist = std::array<std::uint32_t, 256>;
+
+        inline std::uint32_t key_at_(const std::uint32_t* keys, std::size_t stride, std::size_t i) noexcept {
+            std::uint32_t k;
+            std::memcpy(&k, reinterpret_cast<const std::byte*>(keys) + i * stride, sizeof(k));
+            return k;
+        }
+
+        /// @brief 항목의 key 바이트 (byte 0 = 최하위)
+        inline std::uint32_t digit_(std::uint64_t item, int byte) noexcept {
+            return (std::uint32_t)(item >> (32 + 8 * byte)) & 0xFFu;
+        }
+
+        inline bool byte_varies_(std::uint32_t varying, int byte) noexcept {
+            return ((varying >> (8 * byte)) & 0xFFu) != 0;
+        }
+
+        /// @brief src[b,e)를 dst로 분배. ofs는 버킷별 다음 쓰기 위치 (진행하며 증가)
+        void scatter_(const std::uint64_t* src, std::size_t b, std::size_t e,
+                      std::uint64_t* dst, Hist& ofs, int byte) noexcept {
+            for (std::size_t i = b; i < e; ++i) {
+                const std::uint64_t v = src[i];
+                dst[ofs[digit_(v, byte)]++] = v;
+            }
+        }
+
+        /// @brief 순차 경로: 항목 생성 + 4바이트 히스토그램을 한 번에, 이후 필요한 패스만
+        int sort_serial_(const std::uint32_t* keys, std::size_t stride, std::size_t n,
+                         std::uint64_t*& src, std::uint64_t*& dst) noexcept {
+            std::array<Hist, 4> hist{};
+            std::uint32_t all_and = ~0u, all_or = 0u;
+
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::uint32_t k = key_at_(keys, stride, i);
+                all_and &= k;
+                all_or |= k;
+                src[i] = ((std::uint64_t)k << 32) | (std::uint64_t)i;
+                ++hist[0][k & 0xFFu];
+                ++hist[1][(k >> 8) & 0xFFu];
+                ++hist[2][(k >> 16) & 0xFFu];
+                ++hist[3][k >> 24];
+            }
+
+            const std::uint32_t varying = all_and ^ all_or;
+            int passes = 0;
+
+            for (int byte = 0; byte < 4; ++byte) {
+                if (!byte_varies_(varying, byte)) continue;
+
+                std::uint32_t sum = 0;
+                for (std::uint32_t& h : hist[(std::size_t)byte]) {
+                    const std::uint32_t c = h;
+                    h = sum;
+                    sum += c;
+                }
+
+                scatter_(src, 0, n, dst, hist[(std::size_t)byte], byte);
+                std::swap(src, dst);
+                ++passes;
+            }
+            return passes;
+        }
+
+        /// @brief 병렬 경로: 청크별 히스토그램 -> (버킷, 청크) 순 오프셋 -> 청크별 scatter
+        int sort_parallel_(const std::uint32_t* keys, std::size_t stride, std::size_t n, std::size_t chunks,
+                           std::uint64_t*& src, std::uint64_t*& dst,
+                           framedot::core::JobSystem* jobs) noexcept {
+            std::array<Hist, kMaxChunks> hist{};
+            std::array<std::uint32_t, kMaxChunks> c_and{}, c_or{};
+
+            auto begin_of = [n, chunks](std::size_t c) noexcept { return n * c / chunks; };
+
+            {
+                framedot::core::TaskGroup tg(jobs, framedot::core::JobLane::Engine);
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    tg.run([&, c]() noexcept {
+                        std::uint32_t a = ~0u, o = 0u;
+                        const std::size_t e = begin_of(c + 1);
+                        for (std::size_t i = begin_of(c); i < e; ++i) {
+                            const std::uint32_t k = key_at_(keys, stride, i);
+                            a &= k;
+                            o |= k;
+                            src[i] = ((std::uint64_t)k << 32) | (std::uint64_t)i;
+                        }
+                        c_and[c] = a;
+                        c_or[c] = o;
+                    });
+                }
+                tg.wait();
+            }
+
+            std::uint32_t all_and = ~0u, all_or = 0u;
+            for (std::size_t c = 0; c < chunks; ++c) {
+                all_and &= c_and[c];
+                all_or |= c_or[c];
+            }
+
+            const std::uint32_t varying = all_and ^ all_or;
+            int passes = 0;
+
+            for (int byte = 0; byte < 4; ++byte) {
+                if (!byte_varies_(varying, byte)) continue;
+
+                // 청크 내용은 패스마다 바뀌므로 히스토그램도 패스마다 다시 센다
+                {
+                    framedot::core::TaskGroup tg(jobs, framedot::core::JobLane::Engine);
+                    for (std::size_t c = 0; c < chunks; ++c) {
+                        tg.run([&, c]() noexcept {
+                            Hist& h = hist[c];
+                            h.fill(0);
+                            const std::size_t e = begin_of(c + 1);
+                            for (std::size_t i = begin_of(c); i < e; ++i) ++h[digit_(src[i], byte)];
+                        });
+                    }
+                    tg.wait();
+                }
+
+                std::uint32_t sum = 0;
+                for (std::size_t d = 0; d < 256; ++d) {
+                    for (std::size_t c = 0; c < chunks; ++c) {
+                        const std::uint32_t cnt = hist[c][d];
+                        hist[c][d] = sum;
+                        sum += cnt;
+                    }
+                }
+
+                {
+                    framedot::core::TaskGroup tg(jobs, framedot::core::JobLane::Engine);
+                    for (std::size_t c = 0; c < chunks; ++c) {
+                        tg.run([&, c]() noexcept {
+                            scatter_(src, begin_of(c), begin_of(c + 1), dst, hist[c], byte);
+                        });
+                    }
+                    tg.wait();
+                }
+
+                std::swap(src, dst);
+                ++passes;
+            }
+            return passes;
+        }
+
+        template <class Index>
+        int radix_sort_order_(const std::uint32_t* keys, std::size_t key_stride, std::size_t n,
+                              Index* order,
+                              std::vector<std::uint64_t>& buf_a, std::vector<std::uint64_t>& buf_b,
+                              framedot::core::JobSystem* jobs) noexcept {
+            if (n == 0) return 0;
+            if (buf_a.size() < n) buf_a.resize(n);
+            if (buf_b.size() < n) buf_b.resize(n);
+
+            std::uint64_t* src = buf_a.data();
+            std::uint64_t* dst = buf_b.data();
+
+            std::size_t chunks = 1;
+            if (jobs && jobs->worker_count() > 0 && n >= kRadixParallelMin) {
+                chunks = std::min<std::size_t>({(std::size_t)jobs->worker_count() + 1, n / kMinChunkItems, kMaxChunks});
+            }
+
+            const int passes = (chunks > 1)
+                ? sort_parallel_(keys, key_stride, n, chunks, src, dst, jobs)
+                : sort_serial_(keys, key_stride, n, src, dst);
+
+            for (std::size_t i = 0; i < n; ++i) order[i] = (Index)(src[i] & 0xFFFFFFFFu);
+            return passes;
+        }
+
+    } // namespace
+
+    int radix_sort_order(const std::uint32_t* keys, std::size_t key_stride, std::size_t n,
+                         std::uint16_t* order,
+                         std::vector<std::uint64_t>& buf_a, std::vector<std::uint64_t>& buf_b,
+                         framedot::core::JobSystem* jobs) noexcept {
+        return radix_sort_order_(keys, key_stride, n, order, buf_a, buf_b, jobs);
+    }
+
+    int radix_sort_order(const std::uint32_t* keys, std::size_t key_stride, std::size_t n,
+                         std::uint32_t* order,
+                         std::vector<std::uint64_t>& buf_a, std::vector<std::uint64_t>& buf_b,
+                         framedot::core::JobSystem* jobs) noexcept {
+        return radix_sort_order_(keys, key_stride, n, order, buf_a, buf_b, jobs);
+    }
+
+} // namespace framedot::gfx::internal
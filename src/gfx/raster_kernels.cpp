@@ -0,0 +1,390 @@
+// src/gfx/raster_kernels.cpp
+/**
+ * @file raster_kernels.cpp
+ * @brief SoftwareRenderer span 커널 (스칼라/SSE2/AVX2) + 런타임 디스패치
+ *
+ * SIMD blend는 분기 없이 한 식으로 계산한다 (채널당 16bit 레인):
+ *   x = s*sa + d*(255-sa)    (알파 레인은 s 대신 255)
+ *   out = x / 255            (x <= 65025 에서 (x + 1 + (x >> 8)) >> 8 과 동일)
+ * sa=255면 s, sa=0이면 d가 그대로 나오므로 스칼라의 분기 결과와 같다.
+ * tint(modulate)도 같은 /255 근사로 계산한다.
+ *
+ * premultiplied 커널은 mul8(x, a) = ((x*a + 128) * 257) >> 16 을
+ *   t = x*a + 128;  (t + (t >> 8)) >> 8
+ * 로 계산한다 (t <= 65153 에서 두 식은 같다). blend는 out = s + mul8(d, 255 - sa).
+ */
+#include <framedot_internal/gfx/RasterKernels.hpp>
+#include <framedot_internal/core/Simd.hpp>
+#include <framedot/core/CpuFeatures.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace framedot::gfx::internal {
+
+    // ----------------------------
+    // scalar (기준 구현)
+    // ----------------------------
+
+    static void fill_scalar_(std::uint32_t* dst, std::size_t n, std::uint32_t p) noexcept {
+        std::fill_n(dst, n, p);
+    }
+
+    static void blend_scalar_(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept {
+        for (std::size_t i = 0; i < n; ++i) dst[i] = blend_over(dst[i], c);
+    }
+
+    static void blit_scalar_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, ColorRGBA8 tint) noexcept {
+        for (std::size_t i = 0; i < n; ++i) {
+            write_pixel(dst[i], modulate(unpack_rgba(src[i]), tint));
+        }
+    }
+
+    static void copy_masked_scalar_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept {
+        for (std::size_t i = 0; i < n; ++i) {
+            if ((src[i] & 0xFFu) == 0xFFu) dst[i] = src[i];
+        }
+    }
+
+    static void blend_premul_scalar_(std::uint32_t* dst, std::size_t n, std::uint32_t src) noexcept {
+        if (pa(src) == 255) { std::fill_n(dst, n, src); return; }
+        if (src == 0) return;
+        for (std::size_t i = 0; i < n; ++i) dst[i] = blend_over_premul(dst[i], src);
+    }
+
+    static void blit_premul_scalar_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, std::uint32_t tint) noexcept {
+        for (std::size_t i = 0; i < n; ++i) dst[i] = blend_over_premul(dst[i], modulate_premul(src[i], tint));
+    }
+
+#if FRAMEDOT_SIMD_X86
+    // 픽셀 하나 = 16bit 레인 4개 [A, B, G, R] (0xRRGGBBAA의 little-endian 바이트 순서)
+
+    // ----------------------------
+    // SSE2
+    // ----------------------------
+
+    FRAMEDOT_TARGET("sse2")
+    static inline __m128i div255_sse_(__m128i x) noexcept {
+        const __m128i one = _mm_set1_epi16(1);
+        return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, one), _mm_srli_epi16(x, 8)), 8);
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static void fill_sse2_(std::uint32_t* dst, std::size_t n, std::uint32_t p) noexcept {
+        const __m128i v = _mm_set1_epi32((int)p);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) _mm_storeu_si128((__m128i*)(dst + i), v);
+        for (; i < n; ++i) dst[i] = p;
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static void blend_sse2_(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept {
+        if (c.a == 255) { fill_sse2_(dst, n, pack_rgba(c)); return; }
+        if (c.a == 0) return;
+
+        const short sa = (short)c.a;
+        const __m128i src = _mm_set_epi16((short)(c.r * sa), (short)(c.g * sa), (short)(c.b * sa), (short)(255 * sa),
+                                          (short)(c.r * sa), (short)(c.g * sa), (short)(c.b * sa), (short)(255 * sa));
+        const __m128i inv = _mm_set1_epi16((short)(255 - sa));
+        const __m128i zero = _mm_setzero_si128();
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i lo = div255_sse_(_mm_add_epi16(src, _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv)));
+            const __m128i hi = div255_sse_(_mm_add_epi16(src, _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv)));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+        }
+        blend_scalar_(dst + i, n - i, c);
+    }
+
+    /// @brief 픽셀 2개(16bit 레인 8개) tint + blend
+    FRAMEDOT_TARGET("sse2")
+    static inline __m128i blit2_sse_(__m128i s, __m128i d, __m128i tint, __m128i keep_rgb, __m128i a255) noexcept {
+        const __m128i m   = div255_sse_(_mm_mullo_epi16(s, tint));
+        const __m128i sa  = _mm_shufflehi_epi16(_mm_shufflelo_epi16(m, 0x00), 0x00);
+        const __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), sa);
+        const __m128i mc  = _mm_or_si128(_mm_and_si128(m, keep_rgb), a255);
+        return div255_sse_(_mm_add_epi16(_mm_mullo_epi16(mc, sa), _mm_mullo_epi16(d, inv)));
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static void blit_sse2_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, ColorRGBA8 t) noexcept {
+        const __m128i tint = _mm_set_epi16(t.r, t.g, t.b, t.a, t.r, t.g, t.b, t.a);
+        const __m128i keep_rgb = _mm_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+        const __m128i a255 = _mm_set_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+        const __m128i zero = _mm_setzero_si128();
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i lo = blit2_sse_(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), tint, keep_rgb, a255);
+            const __m128i hi = blit2_sse_(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), tint, keep_rgb, a255);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+        }
+        blit_scalar_(dst + i, src + i, n - i, t);
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static inline __m128i mul8_sse_(__m128i x, __m128i a) noexcept {
+        const __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, a), _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static void blend_premul_sse2_(std::uint32_t* dst, std::size_t n, std::uint32_t src) noexcept {
+        if (pa(src) == 255) { fill_sse2_(dst, n, src); return; }
+        if (src == 0) return;
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i s = _mm_unpacklo_epi8(_mm_set1_epi32((int)src), zero);
+        const __m128i inv = _mm_set1_epi16((short)(255 - pa(src)));
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i lo = _mm_add_epi16(s, mul8_sse_(_mm_unpacklo_epi8(d, zero), inv));
+            const __m128i hi = _mm_add_epi16(s, mul8_sse_(_mm_unpackhi_epi8(d, zero), inv));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+        }
+        for (; i < n; ++i) dst[i] = blend_over_premul(dst[i], src);
+    }
+
+    /// @brief 픽셀 2개 premultiplied tint + blend
+    FRAMEDOT_TARGET("sse2")
+    static inline __m128i blit2_premul_sse_(__m128i s, __m128i d, __m128i tint) noexcept {
+        const __m128i m   = mul8_sse_(s, tint);
+        const __m128i sa  = _mm_shufflehi_epi16(_mm_shufflelo_epi16(m, 0x00), 0x00);
+        const __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), sa);
+        return _mm_add_epi16(m, mul8_sse_(d, inv));
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static void blit_premul_sse2_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, std::uint32_t t) noexcept {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i tint = _mm_unpacklo_epi8(_mm_set1_epi32((int)t), zero);
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i lo = blit2_premul_sse_(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), tint);
+            const __m128i hi = blit2_premul_sse_(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), tint);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+        }
+        blit_premul_scalar_(dst + i, src + i, n - i, t);
+    }
+
+    FRAMEDOT_TARGET("sse2")
+    static void copy_masked_sse2_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept {
+        const __m128i amask = _mm_set1_epi32(0xFF);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+            const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+            const __m128i m = _mm_cmpeq_epi32(_mm_and_si128(s, amask), amask);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_and_si128(m, s), _mm_andnot_si128(m, d)));
+        }
+        copy_masked_scalar_(dst + i, src + i, n - i);
+    }
+
+    // ----------------------------
+    // AVX2 (unpack/pack/shuffle은 128bit 레인 안에서 동작 -> 순서 유지)
+    // ----------------------------
+
+    FRAMEDOT_TARGET("avx2")
+    static inline __m256i div255_avx2_(__m256i x) noexcept {
+        const __m256i one = _mm256_set1_epi16(1);
+        return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, one), _mm256_srli_epi16(x, 8)), 8);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static void fill_avx2_(std::uint32_t* dst, std::size_t n, std::uint32_t p) noexcept {
+        const __m256i v = _mm256_set1_epi32((int)p);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) _mm256_storeu_si256((__m256i*)(dst + i), v);
+        fill_sse2_(dst + i, n - i, p);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static void blend_avx2_(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept {
+        if (c.a == 255) { fill_avx2_(dst, n, pack_rgba(c)); return; }
+        if (c.a == 0) return;
+
+        const short sa = (short)c.a;
+        const short r = (short)(c.r * sa), g = (short)(c.g * sa), b = (short)(c.b * sa), a = (short)(255 * sa);
+        const __m256i src = _mm256_set_epi16(r, g, b, a, r, g, b, a, r, g, b, a, r, g, b, a);
+        const __m256i inv = _mm256_set1_epi16((short)(255 - sa));
+        const __m256i zero = _mm256_setzero_si256();
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i lo = div255_avx2_(_mm256_add_epi16(src, _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), inv)));
+            const __m256i hi = div255_avx2_(_mm256_add_epi16(src, _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), inv)));
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(lo, hi));
+        }
+        blend_sse2_(dst + i, n - i, c);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static inline __m256i blit4_avx2_(__m256i s, __m256i d, __m256i tint, __m256i keep_rgb, __m256i a255) noexcept {
+        const __m256i m   = div255_avx2_(_mm256_mullo_epi16(s, tint));
+        const __m256i sa  = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(m, 0x00), 0x00);
+        const __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), sa);
+        const __m256i mc  = _mm256_or_si256(_mm256_and_si256(m, keep_rgb), a255);
+        return div255_avx2_(_mm256_add_epi16(_mm256_mullo_epi16(mc, sa), _mm256_mullo_epi16(d, inv)));
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static void blit_avx2_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, ColorRGBA8 t) noexcept {
+        const __m256i tint = _mm256_set_epi16(t.r, t.g, t.b, t.a, t.r, t.g, t.b, t.a,
+                                              t.r, t.g, t.b, t.a, t.r, t.g, t.b, t.a);
+        const __m256i keep_rgb = _mm256_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0);
+        const __m256i a255 = _mm256_set_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+        const __m256i zero = _mm256_setzero_si256();
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i lo = blit4_avx2_(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), tint, keep_rgb, a255);
+            const __m256i hi = blit4_avx2_(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), tint, keep_rgb, a255);
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(lo, hi));
+        }
+        blit_sse2_(dst + i, src + i, n - i, t);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static inline __m256i mul8_avx2_(__m256i x, __m256i a) noexcept {
+        const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(x, a), _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static void blend_premul_avx2_(std::uint32_t* dst, std::size_t n, std::uint32_t src) noexcept {
+        if (pa(src) == 255) { fill_avx2_(dst, n, src); return; }
+        if (src == 0) return;
+
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i s = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)src), zero);
+        const __m256i inv = _mm256_set1_epi16((short)(255 - pa(src)));
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i lo = _mm256_add_epi16(s, mul8_avx2_(_mm256_unpacklo_epi8(d, zero), inv));
+            const __m256i hi = _mm256_add_epi16(s, mul8_avx2_(_mm256_unpackhi_epi8(d, zero), inv));
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(lo, hi));
+        }
+        blend_premul_sse2_(dst + i, n - i, src);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static inline __m256i blit4_premul_avx2_(__m256i s, __m256i d, __m256i tint) noexcept {
+        const __m256i m   = mul8_avx2_(s, tint);
+        const __m256i sa  = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(m, 0x00), 0x00);
+        const __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), sa);
+        return _mm256_add_epi16(m, mul8_avx2_(d, inv));
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static void blit_premul_avx2_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, std::uint32_t t) noexcept {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i tint = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)t), zero);
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i lo = blit4_premul_avx2_(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), tint);
+            const __m256i hi = blit4_premul_avx2_(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), tint);
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(lo, hi));
+        }
+        blit_premul_sse2_(dst + i, src + i, n - i, t);
+    }
+
+    FRAMEDOT_TARGET("avx2")
+    static void copy_masked_avx2_(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept {
+        const __m256i amask = _mm256_set1_epi32(0xFF);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+            const __m256i m = _mm256_cmpeq_epi32(_mm256_and_si256(s, amask), amask);
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_blendv_epi8(d, s, m));
+        }
+        copy_masked_sse2_(dst + i, src + i, n - i);
+    }
+#endif
+
+    // ----------------------------
+    // dispatch
+    // ----------------------------
+
+    static constexpr RasterKernelSet kScalar{&fill_scalar_, &blend_scalar_, &blit_scalar_, &copy_masked_scalar_,
+                                             &blend_premul_scalar_, &blit_premul_scalar_, "scalar"};
+#if FRAMEDOT_SIMD_X86
+    static constexpr RasterKernelSet kSse2{&fill_sse2_, &blend_sse2_, &blit_sse2_, &copy_masked_sse2_,
+                                           &blend_premul_sse2_, &blit_premul_sse2_, "sse2"};
+    static constexpr RasterKernelSet kAvx2{&fill_avx2_, &blend_avx2_, &blit_avx2_, &copy_masked_avx2_,
+                                           &blend_premul_avx2_, &blit_premul_avx2_, "avx2"};
+#endif
+
+    const RasterKernelSet* raster_kernels_for(RasterIsa isa) noexcept {
+        switch (isa) {
+        case RasterIsa::Scalar:
+            return &kScalar;
+#if FRAMEDOT_SIMD_X86
+        case RasterIsa::SSE2:
+            return framedot::core::cpu_features().sse2 ? &kSse2 : nullptr;
+        case RasterIsa::AVX2:
+            return framedot::core::cpu_features().avx2 ? &kAvx2 : nullptr;
+#endif
+        default:
+            return nullptr;
+        }
+    }
+
+    static const RasterKernelSet* select_kernels_() noexcept {
+        if (const auto* k = raster_kernels_for(RasterIsa::AVX2)) return k;
+        if (const auto* k = raster_kernels_for(RasterIsa::SSE2)) return k;
+        return &kScalar;
+    }
+
+    const RasterKernelSet& raster_kernels() noexcept {
+        static const RasterKernelSet* k = select_kernels_();
+        return *k;
+    }
+
+    void fill_span(std::uint32_t* dst, std::size_t n, std::uint32_t p) noexcept {
+        raster_kernels().fill(dst, n, p);
+    }
+
+    void blend_span(std::uint32_t* dst, std::size_t n, ColorRGBA8 c) noexcept {
+        raster_kernels().blend(dst, n, c);
+    }
+
+    void copy_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept {
+        std::memcpy(dst, src, n * sizeof(std::uint32_t));
+    }
+
+    void blit_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, ColorRGBA8 tint) noexcept {
+        raster_kernels().blit(dst, src, n, tint);
+    }
+
+    void copy_masked_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n) noexcept {
+        raster_kernels().copy_masked(dst, src, n);
+    }
+
+    void blend_premul_span(std::uint32_t* dst, std::size_t n, std::uint32_t src) noexcept {
+        raster_kernels().blend_premul(dst, n, src);
+    }
+
+    void blit_premul_span(std::uint32_t* dst, const std::uint32_t* src, std::size_t n, std::uint32_t tint) noexcept {
+        raster_kernels().blit_premul(dst, src, n, tint);
+    }
+
+} // namespace framedot::gfx::internal
@@ -4,83 +4,292 @@
  * @brief SoftwareRenderer 구현부
  * @brief sort_key를 반영해 커맨드 실행 순서 정렬
  * @brief 타일 기반 병렬 래스터 (write 병렬화 시작)
+ * @brief 커맨드 영역을 한 번 계산해 타일별 bin(CSR)에 배분, 타일은 자기 bin만 순회
+ * @brief 프리미티브는 타일로 클립된 가로 span 단위로 커널에 넘긴다 (픽셀 단위 검사 제거)
+ * @brief 스프라이트는 알파 분류(캐시)에 따라 memcpy/마스크 복사/blend 경로를 고른다
+ * @brief 실행 순서는 sort_key 기준 안정 radix sort (같은 key는 제출 순서)
+ * @brief 커맨드 인덱스는 프레임 커맨드 수에 따라 uint16/uint32 (큐 용량은 설정 가능)
+ * @brief premultiplied 캔버스면 premultiplied 커널 + 캐시된 premultiplied 스프라이트 사본을 쓴다
+ * @brief 인스턴스 op는 인스턴스 단위로 타일에 배분 (타일별 인스턴스 목록, 커맨드 순서 유지)
+ * @brief DisplayList는 로컬 좌표 타일 인덱스를 캐시해 두고, 화면 타일마다 겹치는 로컬 bin을 병합해 재생
+ * @brief TextureCache 텍스처는 등록 시 만든 분류/premultiplied 사본을 그대로 쓴다 (스프라이트 캐시 우회)
+ * @brief affine 스프라이트는 행마다 텍셀 안쪽 구간을 정수로 구해 그 구간만 고정소수점으로 샘플링
+ * @brief 선은 타일 안에 드는 Bresenham 구간을 정수로 구해 그 구간만 span 단위로, 원은 타일 행마다 span 한 번씩
+ * @brief 다각형은 타일 행에 걸친 변만 골라 edge table 스캔라인으로 채운다 (교점은 정수로 정확히 진행)
+ * @brief 타일 크기는 캔버스/워커 수/bin 밀도로 고르고, 병렬이면 타일 비용을 추정해 싼 타일은 합치고
+ *        비싼 타일은 띠로 나눈 job을 비용 내림차순으로 제출
+ * @brief 계측을 켜면 타일별 시간과 op별 픽셀/커맨드 수를 job별 칸에 모아 합치고, heatmap을 덮어 그릴 수 있다
  */
 #include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/gfx/DisplayList.hpp>
 #include <framedot/core/Tasks.hpp>
 
+#include <framedot_internal/gfx/RadixSort.hpp>
+#include <framedot_internal/gfx/RasterKernels.hpp>
+
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <utility>
+#include <vector>
+
+
+namespace framedot::gfx::internal {
+
+    /// @brief DisplayList별 캐시: 실행 순서 + 로컬 좌표 타일 인덱스(CSR)
+    struct DisplayListIndex {
+        std::uint64_t revision{0};
+        std::uint64_t last_used{0};
+
+        std::vector<std::uint32_t> order;       // rank -> 커맨드 인덱스 ((sort_key, 기록 순서) 오름차순)
+
+        // 로컬 격자: 원점 (gx0,gy0), 타일 크기 tile, gw x gh. bin에는 rank가 오름차순으로 들어 있다
+        int gx0{0}, gy0{0}, tile{32}, gw{0}, gh{0};
+        std::vector<std::uint32_t> bin_start;   // gw*gh + 1
+        std::vector<std::uint32_t> bin_ranks;
+        std::vector<std::uint32_t> full;        // 영역이 무한인 커맨드(Clear 등)의 rank. 모든 bin에도 들어 있다
+
+        // 리스트 좌표 영역 [x0,x1) x [y0,y1) (full이 있으면 무한)
+        std::int64_t x0{0}, y0{0}, x1{0}, y1{0};
+
+        std::vector<SoftwareRenderer::SpriteRef> sprites;   // 커맨드 인덱스별 (매 프레임 갱신)
+        std::vector<std::uint32_t> sprite_cmds;             // 스프라이트 커맨드 인덱스
+    };
+
+} // namespace framedot::gfx::internal
 
 
 namespace framedot::gfx {
 
-    constexpr std::uint8_t pr(std::uint32_t p) noexcept { return (p >> 24) & 0xFF; }
-    constexpr std::uint8_t pg(std::uint32_t p) noexcept { return (p >> 16) & 0xFF; }
-    constexpr std::uint8_t pb(std::uint32_t p) noexcept { return (p >>  8) & 0xFF; }
-    constexpr std::uint8_t pa(std::uint32_t p) noexcept { return (p >>  0) & 0xFF; }
+    using internal::DisplayListIndex;
 
-    constexpr std::uint32_t pack_rgba(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a) noexcept {
-        return (std::uint32_t(r) << 24) | (std::uint32_t(g) << 16) | (std::uint32_t(b) << 8) | std::uint32_t(a);
+    using internal::TileTarget;
+
+    static inline bool is_instanced_(RenderQueue::Op op) noexcept {
+        return op == RenderQueue::Op::FillRectInstanced || op == RenderQueue::Op::BlitSpriteInstanced;
     }
 
-    inline std::uint32_t blend_over(std::uint32_t dst, ColorRGBA8 src) noexcept {
-        const std::uint32_t sa = src.a;
-        if (sa == 255) return pack_rgba(src.r, src.g, src.b, src.a);
-        if (sa == 0)   return dst;
+    /// @brief b > 0
+    static inline std::int64_t floor_div_(std::int64_t a, std::int64_t b) noexcept {
+        return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+    }
 
-        const std::uint32_t da = pa(dst);
+    // ---- span 헬퍼 (타일 클립은 여기서 한 번) ----
 
-        const std::uint32_t sr = src.r;
-        const std::uint32_t sg = src.g;
-        const std::uint32_t sb = src.b;
+    /// @brief 가로 span [xa, xb) (y 한 행)
+    static inline void hspan_(const TileTarget& t, int y, int xa, int xb, ColorRGBA8 c) noexcept {
+        if (y < t.y0 || y >= t.y1) return;
+        if (xa < t.x0) xa = t.x0;
+        if (xb > t.x1) xb = t.x1;
+        if (xa >= xb) return;
+        if (t.written) *t.written += (std::uint64_t)(xb - xa);
+        if (t.premul) internal::color_span_premul(t.row(y) + xa, (std::size_t)(xb - xa), c);
+        else          internal::color_span(t.row(y) + xa, (std::size_t)(xb - xa), c);
+    }
 
-        const std::uint32_t dr = pr(dst);
-        const std::uint32_t dg = pg(dst);
-        const std::uint32_t db = pb(dst);
+    /// @brief 세로 span [ya, yb) (x 한 열)
+    static inline void vspan_(const TileTarget& t, int x, int ya, int yb, ColorRGBA8 c) noexcept {
+        if (x < t.x0 || x >= t.x1 || c.a == 0) return;
+        if (ya < t.y0) ya = t.y0;
+        if (yb > t.y1) yb = t.y1;
+        if (t.written && ya < yb) *t.written += (std::uint64_t)(yb - ya);
+        if (t.premul) {
+            for (int y = ya; y < yb; ++y) internal::write_pixel_premul(t.row(y)[x], c);
+        } else {
+            for (int y = ya; y < yb; ++y) internal::write_pixel(t.row(y)[x], c);
+        }
+    }
 
-        const std::uint32_t inv = 255 - sa;
+    /// @brief 사각형 [x0,x1) x [y0,y1)
+    static inline void rect_(const TileTarget& t, int x0, int y0, int x1, int y1, ColorRGBA8 c) noexcept {
+        if (x0 < t.x0) x0 = t.x0;
+        if (y0 < t.y0) y0 = t.y0;
+        if (x1 > t.x1) x1 = t.x1;
+        if (y1 > t.y1) y1 = t.y1;
+        if (x0 >= x1 || y0 >= y1 || c.a == 0) return;
 
-        const std::uint32_t or_ = (sr * sa + dr * inv) / 255;
-        const std::uint32_t og_ = (sg * sa + dg * inv) / 255;
-        const std::uint32_t ob_ = (sb * sa + db * inv) / 255;
+        const std::size_t n = (std::size_t)(x1 - x0);
+        if (t.written) *t.written += (std::uint64_t)n * (std::uint64_t)(y1 - y0);
+        if (t.premul) {
+            for (int y = y0; y < y1; ++y) internal::color_span_premul(t.row(y) + x0, n, c);
+        } else {
+            for (int y = y0; y < y1; ++y) internal::color_span(t.row(y) + x0, n, c);
+        }
+    }
 
-        const std::uint32_t oa_ = (sa + (da * inv) / 255);
-        return pack_rgba((std::uint8_t)or_, (std::uint8_t)og_, (std::uint8_t)ob_, (std::uint8_t)oa_);
+    static inline void point_(const TileTarget& t, int x, int y, ColorRGBA8 c) noexcept {
+        if (!t.contains(x, y)) return;
+        if (t.written) ++*t.written;
+        if (t.premul) internal::write_pixel_premul(t.row(y)[x], c);
+        else          internal::write_pixel(t.row(y)[x], c);
     }
 
-    inline bool in_bounds(int x, int y, int w, int h) noexcept {
-        return (x >= 0 && y >= 0 && x < w && y < h);
+    /// @brief 가로 span [xa, xb] (양끝 포함, 타일 밖 좌표 허용)
+    static inline void hspan64_(const TileTarget& t, std::int64_t y, std::int64_t xa, std::int64_t xb, ColorRGBA8 c) noexcept {
+        if (y < t.y0 || y >= t.y1) return;
+        xa = std::max<std::int64_t>(xa, t.x0);
+        xb = std::min<std::int64_t>(xb + 1, t.x1);
+        if (xa < xb) hspan_(t, (int)y, (int)xa, (int)xb, c);
     }
 
-    template <class Plot>
-    void raster_line(int x0, int y0, int x1, int y1, Plot&& plot) noexcept {
-        int dx = std::abs(x1 - x0);
-        int sx = (x0 < x1) ? 1 : -1;
-        int dy = -std::abs(y1 - y0);
-        int sy = (y0 < y1) ? 1 : -1;
-        int err = dx + dy;
+    // ---- 선 ----
 
-        while (true) {
-            plot(x0, y0);
-            if (x0 == x1 && y0 == y1) break;
-            int e2 = 2 * err;
-            if (e2 >= dy) { err += dy; x0 += sx; }
-            if (e2 <= dx) { err += dx; y0 += sy; }
-        }
+    /// @brief 장축 i번째 픽셀의 단축 오프셋 floor(i*n/m + 1/2) (m > 0, i/n/m < 2^32)
+    static inline std::uint64_t line_minor_(std::uint64_t i, std::uint64_t n, std::uint64_t m) noexcept {
+        const std::uint64_t p = i * n;
+        return p / m + (2 * (p % m) >= m ? 1u : 0u);
     }
 
-    static inline ColorRGBA8 modulate(ColorRGBA8 src, ColorRGBA8 tint) noexcept {
-        auto mul = [](std::uint8_t a, std::uint8_t b) -> std::uint8_t {
-            return (std::uint16_t(a) * std::uint16_t(b)) / 255;
+    /**
+     * @brief 선분 (x0,y0)-(x1,y1)을 타일로 클립해 그린다 (Bresenham과 같은 픽셀)
+     * @note 장축 i번째 픽셀의 단축 오프셋은 line_minor_(i)라서, 타일 안에 드는 i 구간을 정수로 바로 구해
+     *       (장축은 나눗셈 없이, 단축은 단조성으로 이분 탐색) 그 구간만 진행한다.
+     *       단축 값이 같은 픽셀은 span 하나로 쓰고, 축 정렬 선은 span 하나다.
+     */
+    static void line_(const TileTarget& t, int x0, int y0, int x1, int y1, ColorRGBA8 c) noexcept {
+        if (y0 == y1) { hspan64_(t, y0, std::min(x0, x1), std::max(x0, x1), c); return; }
+        if (x0 == x1) { vspan_(t, x0, std::min(y0, y1), std::max(y0, y1) + 1, c); return; }
+
+        const std::int64_t dx = (std::int64_t)x1 - x0, dy = (std::int64_t)y1 - y0;
+        const bool xmajor = std::abs(dx) >= std::abs(dy);
+
+        // 장축(ma)/단축(mi): 시작, 방향, 길이, 타일 구간
+        const std::int64_t ma0 = xmajor ? x0 : y0, mi0 = xmajor ? y0 : x0;
+        const std::int64_t ms = ((xmajor ? dx : dy) > 0) ? 1 : -1;
+        const std::int64_t ns = ((xmajor ? dy : dx) > 0) ? 1 : -1;
+        const std::uint64_t m = (std::uint64_t)std::abs(xmajor ? dx : dy);
+        const std::uint64_t n = (std::uint64_t)std::abs(xmajor ? dy : dx);
+
+        // 좌표 구간 [lo,hi) -> 진행 번호 구간 [a,b]
+        auto steps = [](std::int64_t s0, std::int64_t s, std::int64_t lo, std::int64_t hi,
+                        std::int64_t len, std::int64_t& a, std::int64_t& b) noexcept {
+            if (s > 0) { a = lo - s0; b = hi - 1 - s0; }
+            else       { a = s0 - (hi - 1); b = s0 - lo; }
+            a = std::max<std::int64_t>(a, 0);
+            b = std::min<std::int64_t>(b, len);
+        };
+        std::int64_t ia = 0, ib = 0, ja = 0, jb = 0;
+        steps(ma0, ms, xmajor ? t.x0 : t.y0, xmajor ? t.x1 : t.y1, (std::int64_t)m, ia, ib);
+        steps(mi0, ns, xmajor ? t.y0 : t.x0, xmajor ? t.y1 : t.x1, (std::int64_t)n, ja, jb);
+        if (ia > ib || ja > jb) return;
+
+        auto minor = [&](std::int64_t i) noexcept { return (std::int64_t)line_minor_((std::uint64_t)i, n, m); };
+        auto first = [&](std::int64_t lo, std::int64_t hi, auto&& pred) noexcept {   // [lo,hi)에서 pred가 처음 참인 i
+            while (lo < hi) {
+                const std::int64_t mid = lo + (hi - lo) / 2;
+                if (pred(mid)) hi = mid; else lo = mid + 1;
+            }
+            return lo;
         };
-        return ColorRGBA8{
-            mul(src.r, tint.r),
-            mul(src.g, tint.g),
-            mul(src.b, tint.b),
-            mul(src.a, tint.a),
+        if (minor(ia) < ja) ia = first(ia, ib + 1, [&](std::int64_t i) noexcept { return minor(i) >= ja; });
+        if (ia > ib) return;
+        if (minor(ib) > jb) ib = first(ia, ib + 1, [&](std::int64_t i) noexcept { return minor(i) > jb; }) - 1;
+        if (ia > ib) return;
+
+        // 단축 값이 같은 연속 구간 [i0,i1]을 span으로
+        auto emit = [&](std::int64_t i0, std::int64_t i1, std::int64_t j) noexcept {
+            const std::int64_t a = ma0 + ms * i0, b = ma0 + ms * i1;
+            const int lo = (int)std::min(a, b), hi = (int)std::max(a, b) + 1;
+            const int w = (int)(mi0 + ns * j);
+            if (xmajor) hspan_(t, w, lo, hi, c);
+            else        vspan_(t, w, lo, hi, c);
         };
+
+        // p = i*n = q*m + r 를 나눗셈 없이 진행 (n <= m)
+        std::uint64_t q = (std::uint64_t)ia * n / m, r = (std::uint64_t)ia * n % m;
+        std::int64_t run0 = ia, cur = (std::int64_t)(q + (2 * r >= m ? 1u : 0u));
+        for (std::int64_t i = ia + 1; i <= ib; ++i) {
+            r += n;
+            if (r >= m) { r -= m; ++q; }
+            const std::int64_t j = (std::int64_t)(q + (2 * r >= m ? 1u : 0u));
+            if (j != cur) {
+                emit(run0, i - 1, cur);
+                run0 = i;
+                cur = j;
+            }
+        }
+        emit(run0, ib, cur);
+    }
+
+    // ---- 원 ----
+
+    /// @brief floor(sqrt(v)), v >= 0
+    static inline std::int64_t isqrt_(std::int64_t v) noexcept {
+        std::int64_t s = (std::int64_t)std::sqrt((double)v);
+        while (s * s > v) --s;
+        while ((s + 1) * (s + 1) <= v) ++s;
+        return s;
+    }
+
+    /// @brief 원의 한 행에서 중심 기준 가로 오프셋 구간 [a0,a1], [b0,b1] (0 이상, 비면 lo > hi)
+    struct CircleRow {
+        std::int64_t a0, a1, b0, b1;
+    };
+
+    /**
+     * @brief 중점 원(반지름 r)의 행 오프셋 k (0..r)에 찍히는 픽셀. 기존 8분할 순회와 같은 픽셀 집합
+     * @note 1/8 경로 (x,y)는 err = x^2 + (y+1)^2 - r^2 - 1 이라서, 행 y에서 x = G(y) .. E(y)를 지난다.
+     *       G(j) = floor(sqrt(r^2 + 1 - (j+1)^2)), E(y) = max(G(y), G(y-1) - 1) (E(0) = r), x >= y 까지.
+     *       행 k의 픽셀은 경로의 y == k 부분(a)과, 대칭으로 x == k 부분(b: 경로가 열 k를 지나는 행들)이다.
+     */
+    static inline CircleRow circle_row_(std::int64_t r, std::int64_t k) noexcept {
+        auto g = [r](std::int64_t j) noexcept -> std::int64_t {
+            const std::int64_t v = r * r + 1 - (j + 1) * (j + 1);
+            return (v < 0) ? -1 : isqrt_(v);
+        };
+        const std::int64_t gk = g(k);
+        const std::int64_t gp = (k == 0) ? r : g(k - 1);
+
+        CircleRow row{};
+        row.a0 = std::max(gk, k);
+        row.a1 = (k == 0) ? r : std::max(gk, gp - 1);
+        row.b0 = std::max<std::int64_t>(gk, 0);
+        row.b1 = std::min(std::max<std::int64_t>({gp - 1, gk, 0}), k);
+        return row;
+    }
+
+    /**
+     * @brief 원 (fill이면 채움, 아니면 테두리). 타일에 걸친 행만 돌며 행마다 span으로 한 번씩 쓴다
+     * @note 채움은 행마다 가장 바깥 오프셋까지 span 하나, 테두리는 두 구간을 합쳐 좌우 span.
+     */
+    static void circle_(const TileTarget& t, int cx, int cy, int radius, bool fill, ColorRGBA8 c) noexcept {
+        const std::int64_t r = radius;
+        const std::int64_t ya = std::max<std::int64_t>(t.y0, (std::int64_t)cy - r);
+        const std::int64_t yb = std::min<std::int64_t>(t.y1, (std::int64_t)cy + r + 1);
+        if ((std::int64_t)cx + r < t.x0 || (std::int64_t)cx - r >= t.x1) return;
+
+        for (std::int64_t y = ya; y < yb; ++y) {
+            const CircleRow row = circle_row_(r, std::abs(y - cy));
+            const bool ha = row.a0 <= row.a1, hb = row.b0 <= row.b1;
+
+            if (fill) {
+                const std::int64_t hw = std::max(ha ? row.a1 : -1, hb ? row.b1 : -1);
+                if (hw >= 0) hspan64_(t, y, (std::int64_t)cx - hw, (std::int64_t)cx + hw, c);
+                continue;
+            }
+
+            // 두 구간을 오프셋 순으로 합친다 (겹치거나 붙어 있으면 하나)
+            std::int64_t iv[2][2];
+            int nv = 0;
+            if (ha) { iv[nv][0] = row.a0; iv[nv][1] = row.a1; ++nv; }
+            if (hb) { iv[nv][0] = row.b0; iv[nv][1] = row.b1; ++nv; }
+            if (nv == 2) {
+                if (iv[1][0] < iv[0][0]) { std::swap(iv[0][0], iv[1][0]); std::swap(iv[0][1], iv[1][1]); }
+                if (iv[1][0] <= iv[0][1] + 1) { iv[0][1] = std::max(iv[0][1], iv[1][1]); nv = 1; }
+            }
+            for (int i = 0; i < nv; ++i) {
+                const std::int64_t lo = iv[i][0], hi = iv[i][1];
+                if (lo == 0) {
+                    hspan64_(t, y, (std::int64_t)cx - hi, (std::int64_t)cx + hi, c);   // 가운데에서 이어진다
+                } else {
+                    hspan64_(t, y, (std::int64_t)cx - hi, (std::int64_t)cx - lo, c);
+                    hspan64_(t, y, (std::int64_t)cx + lo, (std::int64_t)cx + hi, c);
+                }
+            }
+        }
     }
 
     // ---- 실행(타일 단위) ----
@@ -88,186 +297,482 @@ namespace framedot::gfx {
         int x0, y0, x1, y1; // [x0,x1), [y0,y1)
     };
 
-    static void execute_tile_(const RenderQueue& rq,
-                              const RenderQueue::Cmd* cmds,
-                              const std::uint16_t* order,
-                              std::size_t n,
-                              PixelCanvas& out,
-                              const Tile& t) noexcept {
-        const int W = (int)out.width();
-        const int H = (int)out.height();
-        auto pix = out.pixels();
+    using SpriteAlpha = SoftwareRenderer::SpriteAlpha;
+    using SpriteRef = SoftwareRenderer::SpriteRef;
+
+    /// @brief 스프라이트 w x h를 (dx0,dy0)에 블릿 (타일 교집합만)
+    static inline void sprite_(const TileTarget& t, const SpriteRef& sp, const std::uint32_t* src, int stride,
+                               int dx0, int dy0, int w, int h, ColorRGBA8 tint) noexcept {
+        if (!src || w <= 0 || h <= 0 || stride <= 0 || tint.a == 0) return;
+
+        // 타일과 교집합만
+        const int sx0 = (dx0 > t.x0) ? dx0 : t.x0;
+        const int sy0 = (dy0 > t.y0) ? dy0 : t.y0;
+        const int sx1 = ((dx0 + w) < t.x1) ? (dx0 + w) : t.x1;
+        const int sy1 = ((dy0 + h) < t.y1) ? (dy0 + h) : t.y1;
+        if (sx0 >= sx1 || sy0 >= sy1) return;
+
+        // tint가 흰색(255,255,255,255)이면 modulate는 항등 -> 분류에 따라 복사로 대체
+        const bool untinted = (internal::pack_rgba(tint) == 0xFFFFFFFFu);
+        const SpriteAlpha alpha = untinted ? sp.alpha : SpriteAlpha::Unknown;
+        const std::uint32_t tint_p = internal::pack_premul(tint);
+
+        const std::size_t span = (std::size_t)(sx1 - sx0);
+        if (t.written) *t.written += (std::uint64_t)span * (std::uint64_t)(sy1 - sy0);
+        for (int y = sy0; y < sy1; ++y) {
+            const std::uint32_t* srow = src + (std::size_t)(y - dy0) * (std::size_t)stride + (std::size_t)(sx0 - dx0);
+            std::uint32_t* drow = t.row(y) + sx0;
+
+            switch (alpha) {
+            case SpriteAlpha::Opaque: internal::copy_span(drow, srow, span); break;
+            case SpriteAlpha::Binary: internal::copy_masked_span(drow, srow, span); break;
+            default:
+                if (t.premul) internal::blit_premul_span(drow, srow, span, tint_p);
+                else          internal::blit_span(drow, srow, span, tint);
+                break;
+            }
+        }
+    }
+
+    /// @brief f + k*s가 [0, lim) 안에 드는 k로 [k0,k1)을 좁힌다
+    static inline void affine_span_(std::int64_t f, std::int64_t s, std::int64_t lim,
+                                    std::int64_t& k0, std::int64_t& k1) noexcept {
+        if (s == 0) {
+            if (f < 0 || f >= lim) k1 = k0;
+        } else if (s > 0) {
+            k0 = std::max(k0, -floor_div_(f, s));
+            k1 = std::min(k1, floor_div_(lim - 1 - f, s) + 1);
+        } else {
+            k0 = std::max(k0, -floor_div_(lim - 1 - f, -s));
+            k1 = std::min(k1, floor_div_(f, -s) + 1);
+        }
+    }
+
+    /// @brief 텍셀 중심 기준 bilinear (u, v: 16.16, 가장자리 clamp). 가중치 8비트, 합 65536
+    static inline std::uint32_t bilerp_(const std::uint32_t* src, int stride, int w, int h,
+                                        std::int64_t u, std::int64_t v) noexcept {
+        const std::int64_t fu = u - 0x8000, fv = v - 0x8000;
+        const std::uint32_t wx = (std::uint32_t)(fu >> 8) & 0xFFu;
+        const std::uint32_t wy = (std::uint32_t)(fv >> 8) & 0xFFu;
+        const int xa = (int)std::clamp<std::int64_t>(fu >> 16, 0, w - 1);
+        const int ya = (int)std::clamp<std::int64_t>(fv >> 16, 0, h - 1);
+        const int xb = (int)std::clamp<std::int64_t>((fu >> 16) + 1, 0, w - 1);
+        const int yb = (int)std::clamp<std::int64_t>((fv >> 16) + 1, 0, h - 1);
+
+        const std::uint32_t* ra = src + (std::size_t)ya * (std::size_t)stride;
+        const std::uint32_t* rb = src + (std::size_t)yb * (std::size_t)stride;
+        const std::uint32_t p00 = ra[xa], p10 = ra[xb], p01 = rb[xa], p11 = rb[xb];
+        const std::uint32_t w00 = (256u - wx) * (256u - wy), w10 = wx * (256u - wy);
+        const std::uint32_t w01 = (256u - wx) * wy, w11 = wx * wy;
+
+        std::uint32_t out = 0;
+        for (int sh = 0; sh < 32; sh += 8) {
+            const std::uint32_t c = ((p00 >> sh) & 0xFFu) * w00 + ((p10 >> sh) & 0xFFu) * w10
+                                  + ((p01 >> sh) & 0xFFu) * w01 + ((p11 >> sh) & 0xFFu) * w11;
+            out |= ((c + 0x8000u) >> 16) << sh;
+        }
+        return out;
+    }
+
+    /**
+     * @brief affine 스프라이트 (타일 교집합만). (dx,dy)는 레코드 좌표에 더할 오프셋 (DisplayList 재생)
+     * - 행마다 텍셀 [0,w) x [0,h) 안에 드는 x 구간을 정수로 구하므로 구간 안에서는 범위 검사가 없다.
+     * - 샘플은 버퍼에 모아 sprite_()와 같은 span 커널로 쓴다.
+     * - 정수 확대(nearest)는 텍셀을 복제한 행을 만들어 같은 텍셀 행끼리 재사용한다.
+     * - straight 캔버스의 bilinear는 straight 값을 보간한다 (premultiplied 캔버스는 사본을 보간).
+     */
+    static void sprite_affine_(const TileTarget& t, const SpriteRef& sp, const std::uint32_t* src, int stride,
+                               int w, int h, const SpriteAffine& a, bool bilinear, ColorRGBA8 tint,
+                               int dx, int dy) noexcept {
+        if (!src || w <= 0 || h <= 0 || stride <= 0 || tint.a == 0) return;
 
-        auto write_px = [&](int x, int y, ColorRGBA8 c) noexcept {
-            if (x < t.x0 || x >= t.x1 || y < t.y0 || y >= t.y1) return;
-            if (!in_bounds(x, y, W, H)) return;
-            const std::size_t idx = (std::size_t)y * (std::size_t)W + (std::size_t)x;
-            if (c.a == 255) {
-                pix[idx] = PixelCanvas::pack(c);
-            } else if (c.a != 0) {
-                pix[idx] = blend_over(pix[idx], c);
+        const std::int64_t ox = (std::int64_t)a.x0 + dx, oy = (std::int64_t)a.y0 + dy;
+        const int ax0 = (int)std::max<std::int64_t>(t.x0, ox);
+        const int ay0 = (int)std::max<std::int64_t>(t.y0, oy);
+        const int ax1 = (int)std::min<std::int64_t>(t.x1, (std::int64_t)a.x1 + dx);
+        const int ay1 = (int)std::min<std::int64_t>(t.y1, (std::int64_t)a.y1 + dy);
+        if (ax0 >= ax1 || ay0 >= ay1) return;
+
+        const bool untinted = (internal::pack_rgba(tint) == 0xFFFFFFFFu);
+        SpriteAlpha alpha = untinted ? sp.alpha : SpriteAlpha::Unknown;
+        if (bilinear && alpha == SpriteAlpha::Binary) alpha = SpriteAlpha::Unknown;   // 경계에 중간 알파가 생긴다
+        const std::uint32_t tint_p = internal::pack_premul(tint);
+
+        auto put = [&](std::uint32_t* drow, const std::uint32_t* srow, std::size_t n) noexcept {
+            if (t.written) *t.written += n;
+            switch (alpha) {
+            case SpriteAlpha::Opaque: internal::copy_span(drow, srow, n); break;
+            case SpriteAlpha::Binary: internal::copy_masked_span(drow, srow, n); break;
+            default:
+                if (t.premul) internal::blit_premul_span(drow, srow, n, tint_p);
+                else          internal::blit_span(drow, srow, n, tint);
+                break;
             }
         };
 
-        auto fill_tile = [&](std::uint32_t p) noexcept {
-            for (int y = t.y0; y < t.y1; ++y) {
-                if (y < 0 || y >= H) continue;
-                const std::size_t row = (std::size_t)y * (std::size_t)W;
-                for (int x = t.x0; x < t.x1; ++x) {
-                    if (x < 0 || x >= W) continue;
-                    pix[row + (std::size_t)x] = p;
+        constexpr std::int64_t kChunk = 256;
+        std::array<std::uint32_t, kChunk> buf;
+
+        if (!bilinear && a.up_x && a.up_y) {
+            // 정수 확대: 영역이 스프라이트 블록과 정확히 같으므로 구간 계산이 필요 없다
+            const bool reuse = (ax1 - ax0) <= kChunk;
+            int last_ty = -1;
+            for (int y = ay0; y < ay1; ++y) {
+                const int ty = (int)((y - oy) / a.up_y);
+                const std::uint32_t* srow = src + (std::size_t)ty * (std::size_t)stride;
+                for (int xa = ax0; xa < ax1; xa += (int)kChunk) {
+                    const int n = std::min<int>((int)kChunk, ax1 - xa);
+                    if (!reuse || ty != last_ty) {
+                        const int rx = (int)(xa - ox);
+                        int tx = rx / a.up_x;
+                        int rep = rx - tx * a.up_x;
+                        for (int k = 0; k < n; ++k) {
+                            buf[(std::size_t)k] = srow[tx];
+                            if (++rep == a.up_x) { rep = 0; ++tx; }
+                        }
+                        last_ty = ty;
+                    }
+                    put(t.row(y) + xa, buf.data(), (std::size_t)n);
                 }
             }
-        };
+            return;
+        }
+
+        const std::int64_t lim_u = (std::int64_t)w << 16, lim_v = (std::int64_t)h << 16;
+        for (int y = ay0; y < ay1; ++y) {
+            const std::int64_t rx = ax0 - ox, ry = y - oy;
+            const std::int64_t u = a.u0 + rx * a.du_dx + ry * a.du_dy;
+            const std::int64_t v = a.v0 + rx * a.dv_dx + ry * a.dv_dy;
+
+            std::int64_t k0 = 0, k1 = ax1 - ax0;
+            affine_span_(u, a.du_dx, lim_u, k0, k1);
+            affine_span_(v, a.dv_dx, lim_v, k0, k1);
+
+            std::uint32_t* drow = t.row(y) + ax0;
+            for (std::int64_t kb = k0; kb < k1; kb += kChunk) {
+                const std::size_t n = (std::size_t)std::min(kChunk, k1 - kb);
+                std::int64_t su = u + kb * a.du_dx, sv = v + kb * a.dv_dx;
+                if (bilinear) {
+                    for (std::size_t k = 0; k < n; ++k) {
+                        buf[k] = bilerp_(src, stride, w, h, su, sv);
+                        su += a.du_dx; sv += a.dv_dx;
+                    }
+                } else {
+                    for (std::size_t k = 0; k < n; ++k) {
+                        buf[k] = src[(std::size_t)(sv >> 16) * (std::size_t)stride + (std::size_t)(su >> 16)];
+                        su += a.du_dx; sv += a.dv_dx;
+                    }
+                }
+                put(drow + kb, buf.data(), n);
+            }
+        }
+    }
+
+    /// @brief 다각형 변: 행 [y0,y1)에서 활성. 이 행의 첫 칠해질 픽셀 = ceil(n/den)을 몫/나머지로 정확히 진행
+    struct PolyEdge {
+        std::int32_t y0, y1;
+        std::int32_t dir;            // 위->아래 +1, 아래->위 -1 (nonzero 누적)
+        std::int64_t q, r, den;      // n = q*den + r (0 <= r < den)
+        std::int64_t qs, rs;         // 한 행마다 n += 2*dx 의 몫/나머지
+    };
+
+    /**
+     * @brief 다각형 채우기 (edge table 스캔라인, nonzero). 꼭짓점 + (dx,dy)
+     * @note 픽셀 중심 (x+0.5, y+0.5)가 안쪽이면 칠한다. 변과 행 중심의 교점 X에 대해 첫 픽셀은 ceil(X - 0.5).
+     *       시작 행에서 정수로 바로 계산하므로 타일/시작 행과 무관하게 같은 결과가 나온다.
+     */
+    static void polygon_(const TileTarget& t, const PointI* v, std::uint32_t n, ColorRGBA8 c, int dx, int dy) noexcept {
+        static thread_local std::vector<PolyEdge> edges;
+        static thread_local std::vector<std::uint32_t> active;
+        static thread_local std::vector<std::pair<std::int64_t, std::int32_t>> xs;
+
+        // 1) 이 타일 행에 걸친 변만 (y 시작 순)
+        edges.clear();
+        for (std::uint32_t i = 0; i < n; ++i) {
+            const PointI& a = v[i];
+            const PointI& b = v[(i + 1 == n) ? 0 : i + 1];
+            if (a.y == b.y) continue;
+
+            const bool down = a.y < b.y;
+            const std::int64_t xa = (std::int64_t)(down ? a.x : b.x) + dx;
+            const std::int64_t ya = (std::int64_t)(down ? a.y : b.y) + dy;
+            const std::int64_t yb = (std::int64_t)(down ? b.y : a.y) + dy;
+            const std::int64_t ex = (std::int64_t)(down ? b.x - a.x : a.x - b.x);
+
+            const std::int64_t r0 = std::max<std::int64_t>(ya, t.y0);
+            const std::int64_t r1 = std::min<std::int64_t>(yb, t.y1);
+            if (r0 >= r1) continue;
+
+            // n(y) = 2*xa*ey + (2*(y-ya)+1)*ex - ey,  den = 2*ey
+            const std::int64_t ey = yb - ya;
+            const std::int64_t den = 2 * ey;
+            const std::int64_t n0 = 2 * xa * ey + (2 * (r0 - ya) + 1) * ex - ey;
+
+            PolyEdge e{};
+            e.y0 = (std::int32_t)r0;
+            e.y1 = (std::int32_t)r1;
+            e.dir = down ? 1 : -1;
+            e.den = den;
+            e.q = floor_div_(n0, den);
+            e.r = n0 - e.q * den;
+            e.qs = floor_div_(2 * ex, den);
+            e.rs = 2 * ex - e.qs * den;
+            edges.push_back(e);
+        }
+        if (edges.empty()) return;
+        std::sort(edges.begin(), edges.end(), [](const PolyEdge& a, const PolyEdge& b) noexcept { return a.y0 < b.y0; });
+
+        // 2) 행마다 활성 변 갱신 -> 교점 정렬 -> winding이 0이 아닌 구간을 span으로
+        active.clear();
+        std::size_t next = 0;
+        int y = edges[0].y0;
+        while (true) {
+            if (active.empty()) {
+                if (next == edges.size()) break;
+                y = std::max(y, edges[next].y0);
+            }
+            while (next < edges.size() && edges[next].y0 == y) active.push_back((std::uint32_t)next++);
+
+            xs.clear();
+            for (std::uint32_t k : active) {
+                const PolyEdge& e = edges[k];
+                xs.emplace_back(e.q + (e.r != 0), e.dir);
+            }
+            // 변 순서는 행마다 조금씩만 바뀐다 (삽입 정렬)
+            for (std::size_t i = 1; i < xs.size(); ++i) {
+                const auto cur = xs[i];
+                std::size_t j = i;
+                while (j > 0 && xs[j - 1].first > cur.first) { xs[j] = xs[j - 1]; --j; }
+                xs[j] = cur;
+            }
+
+            std::int32_t wind = 0;
+            std::int64_t xl = 0;
+            for (const auto& [x, d] : xs) {
+                const std::int32_t prev = wind;
+                wind += d;
+                if (prev == 0) {
+                    xl = x;
+                } else if (wind == 0 && x > xl) {
+                    const int xa = (int)std::max<std::int64_t>(xl, t.x0);
+                    const int xb = (int)std::min<std::int64_t>(x, t.x1);
+                    if (xa < xb) hspan_(t, y, xa, xb, c);
+                }
+            }
+
+            // 다음 행: 진행 + 끝난 변 제거
+            ++y;
+            std::size_t w = 0;
+            for (std::uint32_t k : active) {
+                PolyEdge& e = edges[k];
+                if (e.y1 <= y) continue;
+                e.q += e.qs;
+                e.r += e.rs;
+                if (e.r >= e.den) { e.r -= e.den; ++e.q; }
+                active[w++] = k;
+            }
+            active.resize(w);
+            if (y >= t.y1) break;
+        }
+    }
+
+    /// @brief 타일 실행 입력 (커맨드 인덱스별 배열 + 좌표 오프셋)
+    struct TileInputs {
+        const SpriteRef* sprites{nullptr};                 // 커맨드 인덱스별 스프라이트 소스/분류
+        const std::uint32_t* inst_n{nullptr};              // order와 평행: 인스턴스 op면 이 타일의 인스턴스 수
+        const std::uint32_t* inst_refs{nullptr};           // 이 타일의 인스턴스 번호. nullptr이면 전체 인스턴스를 클립해 그림
+        const DisplayListIndex* const* lists{nullptr};     // 커맨드 인덱스별 (DrawList만)
+        int dx{0}, dy{0};                                  // 커맨드 좌표에 더할 오프셋 (DisplayList 재생)
+        SoftwareRenderer::Profile* prof{nullptr};          // 계측 누적 (job별 칸, nullptr이면 세지 않음)
+    };
+
+    /// @brief 커맨드 좌표를 (dx,dy)만큼 이동 (인스턴스 op는 인스턴스 좌표에서 따로 더한다)
+    static inline void translate_(RenderQueue::Cmd& c, int dx, int dy) noexcept {
+        switch (c.op) {
+        case RenderQueue::Op::Clear:
+        case RenderQueue::Op::FillRectInstanced:
+        case RenderQueue::Op::BlitSpriteInstanced:
+        case RenderQueue::Op::DrawList:
+        case RenderQueue::Op::BlitSpriteAffine:   // 오프셋은 샘플링에서 더한다
+        case RenderQueue::Op::FillPolygon:        // 오프셋은 변 계산에서 더한다
+            break;
+        case RenderQueue::Op::Line:
+            c.x0 += dx; c.y0 += dy; c.x1 += dx; c.y1 += dy;
+            break;
+        case RenderQueue::Op::HLine:
+            c.x0 += dx; c.x1 += dx; c.y0 += dy;
+            break;
+        case RenderQueue::Op::VLine:
+            c.x0 += dx; c.y0 += dy; c.y1 += dy;
+            break;
+        default:
+            c.x0 += dx; c.y0 += dy;
+            break;
+        }
+    }
+
+    /// @brief 타일 대상을 clip 사각형(+오프셋)으로 좁힌다. 비면 false
+    static inline bool narrow_(TileTarget& t, const RectI& clip, int dx, int dy) noexcept {
+        t.x0 = (int)std::max<std::int64_t>(t.x0, (std::int64_t)clip.x0 + dx);
+        t.y0 = (int)std::max<std::int64_t>(t.y0, (std::int64_t)clip.y0 + dy);
+        t.x1 = (int)std::min<std::int64_t>(t.x1, (std::int64_t)clip.x1 + dx);
+        t.y1 = (int)std::min<std::int64_t>(t.y1, (std::int64_t)clip.y1 + dy);
+        return t.x0 < t.x1 && t.y0 < t.y1;
+    }
+
+    static void replay_list_(const DisplayList& list, const DisplayListIndex& li,
+                             PixelCanvas& out, const Tile& tile, int dx, int dy,
+                             SoftwareRenderer::Profile* prof) noexcept;
+
+    /// @param src RenderQueue 또는 DisplayList
+    /// @param order 커맨드 인덱스 (슬롯 번호, uint16 또는 uint32)
+    template <class Source, class Index>
+    static void execute_tile_(const Source& src,
+                              const TileInputs& in,
+                              const Index* order,
+                              std::size_t n,
+                              PixelCanvas& out,
+                              const Tile& tile) noexcept {
+        // tile은 이미 캔버스 안으로 클립되어 있다
+        TileTarget tt{};
+        tt.pixels = out.pixels().data();
+        tt.stride = (std::size_t)out.width();
+        tt.x0 = tile.x0; tt.y0 = tile.y0; tt.x1 = tile.x1; tt.y1 = tile.y1;
+        tt.premul = out.premultiplied();
+
+        const std::uint32_t* inst_refs = in.inst_refs;
+        const bool offset = (in.dx | in.dy) != 0;
 
         for (std::size_t oi = 0; oi < n; ++oi) {
-            const RenderQueue::Cmd& c = cmds[order[oi]];
+            RenderQueue::Cmd c = src.cmd(order[oi]);
+            if (offset) translate_(c, in.dx, in.dy);
+
+            // clip: 프리미티브는 타일 대상 밖을 쓰지 않으므로 대상만 좁힌다
+            TileTarget t = tt;
+            if (in.prof) ++in.prof->visited;
+            if (c.u1 != RenderQueue::kNoClip && !narrow_(t, src.clip_rect(c.u1), in.dx, in.dy)) {
+                if (inst_refs && is_instanced_(c.op)) inst_refs += in.inst_n[oi];
+                continue;
+            }
+
+            std::uint64_t written = 0;
+            if (in.prof) t.written = &written;
 
             switch (c.op) {
             case RenderQueue::Op::Clear: {
-                fill_tile(PixelCanvas::pack(c.color));
+                const std::uint32_t p = out.encode(c.color);
+                const std::size_t w = (std::size_t)(t.x1 - t.x0);
+                if (t.written) *t.written += (std::uint64_t)w * (std::uint64_t)(t.y1 - t.y0);
+                for (int y = t.y0; y < t.y1; ++y) internal::fill_span(t.row(y) + t.x0, w, p);
                 break;
             }
             case RenderQueue::Op::PutPixel: {
-                write_px(c.x0, c.y0, c.color);
+                point_(t, c.x0, c.y0, c.color);
                 break;
             }
             case RenderQueue::Op::FillRect:
             case RenderQueue::Op::BlendRect: {
-                const int rx0 = c.x0;
-                const int ry0 = c.y0;
-                const int rx1 = c.x0 + c.x1;
-                const int ry1 = c.y0 + c.y1;
-
-                const int sx0 = (rx0 > t.x0) ? rx0 : t.x0;
-                const int sy0 = (ry0 > t.y0) ? ry0 : t.y0;
-                const int sx1 = (rx1 < t.x1) ? rx1 : t.x1;
-                const int sy1 = (ry1 < t.y1) ? ry1 : t.y1;
-
-                for (int y = sy0; y < sy1; ++y) {
-                    if (y < 0 || y >= H) continue;
-                    for (int x = sx0; x < sx1; ++x) {
-                        if (x < 0 || x >= W) continue;
-                        write_px(x, y, c.color);
-                    }
-                }
+                rect_(t, c.x0, c.y0, c.x0 + c.x1, c.y0 + c.y1, c.color);
                 break;
             }
             case RenderQueue::Op::RectOutline: {
+                // 변마다 span으로. 겹치는 픽셀(모서리/두꺼운 테두리)은 기존처럼 여러 번 쓴다.
                 const int tpx = (int)c.u0;
                 if (tpx <= 0) break;
                 const int x = c.x0, y = c.y0;
                 const int w = c.x1, h = c.y1;
 
                 for (int i = 0; i < tpx; ++i) {
-                    for (int xx = x; xx < x + w; ++xx) {
-                        write_px(xx, y + i, c.color);
-                        write_px(xx, y + h - 1 - i, c.color);
-                    }
-                    for (int yy = y; yy < y + h; ++yy) {
-                        write_px(x + i, yy, c.color);
-                        write_px(x + w - 1 - i, yy, c.color);
-                    }
+                    hspan_(t, y + i, x, x + w, c.color);
+                    hspan_(t, y + h - 1 - i, x, x + w, c.color);
+                    vspan_(t, x + i, y, y + h, c.color);
+                    vspan_(t, x + w - 1 - i, y, y + h, c.color);
                 }
                 break;
             }
             case RenderQueue::Op::Line: {
-                raster_line(c.x0, c.y0, c.x1, c.y1, [&](int x, int y) {
-                    write_px(x, y, c.color);
-                });
+                line_(t, c.x0, c.y0, c.x1, c.y1, c.color);
                 break;
             }
             case RenderQueue::Op::HLine: {
-                const int y = c.y0;
                 int x0 = c.x0, x1 = c.x1;
                 if (x0 > x1) std::swap(x0, x1);
-                for (int x = x0; x <= x1; ++x) write_px(x, y, c.color);
+                hspan_(t, c.y0, x0, x1 + 1, c.color);
                 break;
             }
             case RenderQueue::Op::VLine: {
-                const int x = c.x0;
                 int y0 = c.y0, y1 = c.y1;
                 if (y0 > y1) std::swap(y0, y1);
-                for (int y = y0; y <= y1; ++y) write_px(x, y, c.color);
+                vspan_(t, c.x0, y0, y1 + 1, c.color);
                 break;
             }
             case RenderQueue::Op::FillCircle:
             case RenderQueue::Op::Circle: {
-                const int cx = c.x0, cy = c.y0, r = c.x1;
-                if (r <= 0) break;
-
-                int x = r;
-                int y = 0;
-                int err = 0;
-
-                auto plot8 = [&](int px, int py) {
-                    const int pts[8][2] = {
-                        { cx + px, cy + py }, { cx + py, cy + px },
-                        { cx - py, cy + px }, { cx - px, cy + py },
-                        { cx - px, cy - py }, { cx - py, cy - px },
-                        { cx + py, cy - px }, { cx + px, cy - py },
-                    };
-                    for (auto& pt : pts) write_px(pt[0], pt[1], c.color);
-                };
+                if (c.x1 <= 0) break;
+                circle_(t, c.x0, c.y0, c.x1, c.op == RenderQueue::Op::FillCircle, c.color);
+                break;
+            }
+            case RenderQueue::Op::BlitSprite: {
+                // binning 단계에서 정한 소스 (premultiplied 사본일 수 있음)
+                const SpriteRef& sp = in.sprites[order[oi]];
+                const auto* pix = sp.pixels ? sp.pixels : (const std::uint32_t*)src.payload0(order[oi]);
+                const int stride = sp.pixels ? (int)sp.stride : (int)c.u0;
+                sprite_(t, sp, pix, stride, c.x0, c.y0, c.x1, c.y1, c.color);
+                break;
+            }
+            case RenderQueue::Op::BlitSpriteAffine: {
+                const SpriteAffine* a = src.affine_data((std::uint32_t)c.x0);
+                if (!a) break;
+                const SpriteRef& sp = in.sprites[order[oi]];
+                const auto* pix = sp.pixels ? sp.pixels : (const std::uint32_t*)src.payload0(order[oi]);
+                const int stride = sp.pixels ? (int)sp.stride : (int)c.u0;
+                sprite_affine_(t, sp, pix, stride, c.x1, c.y1, *a, (c.flags & RenderQueue::kFlagBilinear) != 0,
+                               c.color, in.dx, in.dy);
+                break;
+            }
+            case RenderQueue::Op::FillPolygon: {
+                const PointI* v = src.vertex_data((std::uint32_t)c.x0, (std::uint32_t)c.x1);
+                if (!v || c.x1 < 3) break;
+                polygon_(t, v, (std::uint32_t)c.x1, c.color, in.dx, in.dy);
+                break;
+            }
+            case RenderQueue::Op::FillRectInstanced:
+            case RenderQueue::Op::BlitSpriteInstanced: {
+                const auto* inst = (const Instance*)src.payload0(order[oi]);
+                const bool own = (c.flags & RenderQueue::kFlagInstanceColor) != 0;
+                const bool rect = (c.op == RenderQueue::Op::FillRectInstanced);
 
-                auto hspan = [&](int yline, int x0, int x1) {
-                    if (x0 > x1) std::swap(x0, x1);
-                    for (int xx = x0; xx <= x1; ++xx) write_px(xx, yline, c.color);
-                };
+                const SpriteRef& sp = in.sprites[order[oi]];
+                const auto* pix = sp.pixels ? sp.pixels : (const std::uint32_t*)src.payload1(order[oi]);
+                const int stride = sp.pixels ? (int)sp.stride : (int)c.u0;
 
-                while (x >= y) {
-                    if (c.op == RenderQueue::Op::Circle) {
-                        plot8(x, y);
-                    } else {
-                        hspan(cy + y, cx - x, cx + x);
-                        hspan(cy - y, cx - x, cx + x);
-                        hspan(cy + x, cx - y, cx + y);
-                        hspan(cy - x, cx - y, cx + y);
-                    }
+                auto draw = [&](const Instance& e) noexcept {
+                    const int x = e.x + in.dx, y = e.y + in.dy;
+                    if (rect) rect_(t, x, y, x + c.x1, y + c.y1, own ? e.color : c.color);
+                    else      sprite_(t, sp, pix, stride, x, y, c.x1, c.y1, own ? e.color : c.color);
+                };
 
-                    if (err <= 0) { y += 1; err += 2*y + 1; }
-                    if (err > 0)  { x -= 1; err -= 2*x + 1; }
+                if (inst_refs) {
+                    // 이 타일에 걸친 인스턴스만 (binning 결과)
+                    const std::uint32_t k = in.inst_n[oi];
+                    for (std::uint32_t j = 0; j < k; ++j) draw(inst[inst_refs[j]]);
+                    inst_refs += k;
+                } else {
+                    for (std::int32_t j = 0; j < c.x0; ++j) draw(inst[j]);
                 }
                 break;
             }
-            case RenderQueue::Op::BlitSprite: {
-                const auto* src = (const std::uint32_t*)rq.payload0(order[oi]);
-                const int w = c.x1;
-                const int h = c.y1;
-                const int dx0 = c.x0;
-                const int dy0 = c.y0;
-                const int stride = (int)c.u0;
-
-                if (!src || w <= 0 || h <= 0 || stride <= 0) break;
-
-                // 타일과 교집합만
-                const int sx0 = (dx0 > t.x0) ? dx0 : t.x0;
-                const int sy0 = (dy0 > t.y0) ? dy0 : t.y0;
-                const int sx1 = ((dx0 + w) < t.x1) ? (dx0 + w) : t.x1;
-                const int sy1 = ((dy0 + h) < t.y1) ? (dy0 + h) : t.y1;
-
-                for (int y = sy0; y < sy1; ++y) {
-                    const int sy = y - dy0;
-                    if (y < 0 || y >= H) continue;
-
-                    for (int x = sx0; x < sx1; ++x) {
-                        const int sx = x - dx0;
-                        if (x < 0 || x >= W) continue;
-
-                        const std::uint32_t sp = src[(std::size_t)sy * (std::size_t)stride + (std::size_t)sx];
-                        ColorRGBA8 sc{
-                            pr(sp), pg(sp), pb(sp), pa(sp)
-                        };
-                        sc = modulate(sc, c.color);
-                        write_px(x, y, sc);
-                    }
-                }
+            case RenderQueue::Op::DrawList: {
+                const DisplayListIndex* li = in.lists ? in.lists[order[oi]] : nullptr;
+                if (!li) break;
+
+                replay_list_(*(const DisplayList*)src.payload0(order[oi]), *li, out, Tile{t.x0, t.y0, t.x1, t.y1}, c.x0, c.y0, in.prof);
                 break;
             }
             case RenderQueue::Op::Text: {
                 const std::uint32_t ofs = (std::uint32_t)c.x1;
                 const std::uint32_t len = (std::uint32_t)c.y1;
-                const char* s = rq.text_data(ofs);
+                const char* s = src.text_data(ofs);
 
                 // 지금은 debug text: 각 문자를 "작은 블록"으로 표시(폰트는 다음 스텝)
                 int penx = c.x0;
@@ -279,17 +784,11 @@ namespace framedot::gfx {
                     const char ch = s[i];
                     if (ch == '\n') { penx = c.x0; peny += 8 * scale; continue; }
 
-                    // 4x6 블록
+                    // 4x6 블록 (공백은 스킵)
                     const int bw = 4 * scale;
                     const int bh = 6 * scale;
 
-                    for (int yy = 0; yy < bh; ++yy) {
-                        for (int xx = 0; xx < bw; ++xx) {
-                            // 공백은 스킵
-                            if (ch == ' ') continue;
-                            write_px(penx + xx, peny + yy, c.color);
-                        }
-                    }
+                    if (ch != ' ') rect_(t, penx, peny, penx + bw, peny + bh, c.color);
                     penx += (bw + 1);
                 }
                 break;
@@ -297,6 +796,16 @@ namespace framedot::gfx {
             default:
                 break;
             }
+
+            if (written) {
+                const std::size_t op = (std::size_t)c.op;
+                ++in.prof->drawn;
+                in.prof->pixels += written;
+                if (op < kDrawOpCount) {
+                    ++in.prof->op_drawn[op];
+                    in.prof->op_pixels[op] += written;
+                }
+            }
         }
     }
 
@@ -305,58 +814,1037 @@ namespace framedot::gfx {
         execute(dummy, rq, out);
     }
 
+    /// @brief 클립 전 커맨드 영역 [x0,x1) x [y0,y1). full이면 무한 (Clear 등)
+    struct RawBounds {
+        std::int64_t x0, y0, x1, y1;
+        bool full;
+
+        bool empty() const noexcept { return !full && (x0 >= x1 || y0 >= y1); }
+    };
+
+    /// @param src RenderQueue 또는 DisplayList
+    template <class Source>
+    static RawBounds raw_bounds_(const Source& src, std::size_t i) noexcept {
+        const RenderQueue::Cmd& c = src.cmd(i);
+        std::int64_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+        switch (c.op) {
+        case RenderQueue::Op::Clear:
+        case RenderQueue::Op::DrawList:   // 호출자가 리스트 인덱스로 따로 계산
+            return RawBounds{0, 0, 0, 0, true};
+        case RenderQueue::Op::PutPixel:
+            x0 = c.x0; y0 = c.y0; x1 = x0 + 1; y1 = y0 + 1;
+            break;
+        case RenderQueue::Op::FillRect:
+        case RenderQueue::Op::BlendRect:
+            x0 = c.x0; y0 = c.y0; x1 = x0 + c.x1; y1 = y0 + c.y1;
+            break;
+        case RenderQueue::Op::BlitSprite:
+            if (!src.payload0(i) || c.u0 == 0) return RawBounds{0, 0, 0, 0, false};
+            x0 = c.x0; y0 = c.y0; x1 = x0 + c.x1; y1 = y0 + c.y1;
+            break;
+        case RenderQueue::Op::BlitSpriteAffine: {
+            const SpriteAffine* a = src.affine_data((std::uint32_t)c.x0);
+            if (!a || !src.payload0(i) || c.u0 == 0) return RawBounds{0, 0, 0, 0, false};
+            x0 = a->x0; y0 = a->y0; x1 = a->x1; y1 = a->y1;
+            break;
+        }
+        case RenderQueue::Op::FillPolygon: {
+            // 픽셀 중심 규칙이라 칠해지는 픽셀은 꼭짓점 AABB [min,max) 안에 있다
+            const PointI* v = src.vertex_data((std::uint32_t)c.x0, (std::uint32_t)c.x1);
+            if (!v || c.x1 < 3) return RawBounds{0, 0, 0, 0, false};
+            x0 = x1 = v[0].x;
+            y0 = y1 = v[0].y;
+            for (std::int32_t k = 1; k < c.x1; ++k) {
+                x0 = std::min<std::int64_t>(x0, v[k].x); x1 = std::max<std::int64_t>(x1, v[k].x);
+                y0 = std::min<std::int64_t>(y0, v[k].y); y1 = std::max<std::int64_t>(y1, v[k].y);
+            }
+            break;
+        }
+        case RenderQueue::Op::RectOutline: {
+            // 두께가 변보다 크면 안쪽 변이 반대편 밖으로 넘어간다
+            const std::int64_t tpx = c.u0;
+            if (tpx <= 0) return RawBounds{0, 0, 0, 0, false};
+            const std::int64_t w = c.x1, h = c.y1;
+            x0 = std::min<std::int64_t>(c.x0, c.x0 + w - tpx);
+            x1 = std::max<std::int64_t>(c.x0 + w, c.x0 + tpx);
+            y0 = std::min<std::int64_t>(c.y0, c.y0 + h - tpx);
+            y1 = std::max<std::int64_t>(c.y0 + h, c.y0 + tpx);
+            break;
+        }
+        case RenderQueue::Op::Line:
+            x0 = std::min(c.x0, c.x1); x1 = (std::int64_t)std::max(c.x0, c.x1) + 1;
+            y0 = std::min(c.y0, c.y1); y1 = (std::int64_t)std::max(c.y0, c.y1) + 1;
+            break;
+        case RenderQueue::Op::HLine:
+            x0 = std::min(c.x0, c.x1); x1 = (std::int64_t)std::max(c.x0, c.x1) + 1;
+            y0 = c.y0; y1 = y0 + 1;
+            break;
+        case RenderQueue::Op::VLine:
+            x0 = c.x0; x1 = x0 + 1;
+            y0 = std::min(c.y0, c.y1); y1 = (std::int64_t)std::max(c.y0, c.y1) + 1;
+            break;
+        case RenderQueue::Op::FillCircle:
+        case RenderQueue::Op::Circle: {
+            const std::int64_t r = c.x1;
+            if (r <= 0) return RawBounds{0, 0, 0, 0, false};
+            x0 = c.x0 - r; x1 = c.x0 + r + 1;
+            y0 = c.y0 - r; y1 = c.y0 + r + 1;
+            break;
+        }
+        case RenderQueue::Op::FillRectInstanced:
+        case RenderQueue::Op::BlitSpriteInstanced: {
+            // 인스턴스 영역의 합집합
+            const auto* inst = (const Instance*)src.payload0(i);
+            if (!inst || c.x0 <= 0 || c.x1 <= 0 || c.y1 <= 0) return RawBounds{0, 0, 0, 0, false};
+            if (c.op == RenderQueue::Op::BlitSpriteInstanced && (!src.payload1(i) || c.u0 == 0)) return RawBounds{0, 0, 0, 0, false};
+
+            std::int32_t ix0 = inst[0].x, iy0 = inst[0].y, ix1 = inst[0].x, iy1 = inst[0].y;
+            for (std::int32_t k = 1; k < c.x0; ++k) {
+                ix0 = std::min(ix0, inst[k].x); ix1 = std::max(ix1, inst[k].x);
+                iy0 = std::min(iy0, inst[k].y); iy1 = std::max(iy1, inst[k].y);
+            }
+            x0 = ix0; y0 = iy0; x1 = (std::int64_t)ix1 + c.x1; y1 = (std::int64_t)iy1 + c.y1;
+            break;
+        }
+        case RenderQueue::Op::Text: {
+            // execute_tile_과 같은 펜 규칙으로 줄 수/최대 글자 수만 센다
+            const char* s = src.text_data((std::uint32_t)c.x1);
+            const std::uint32_t len = (std::uint32_t)c.y1;
+            const std::int64_t scale = (c.u0 == 0) ? 1 : (std::int64_t)c.u0;
+
+            std::int64_t lines = 0, cols = 0, max_cols = 0;
+            for (std::uint32_t k = 0; k < len; ++k) {
+                if (s[k] == '\n') { ++lines; cols = 0; continue; }
+                ++cols;
+                if (cols > max_cols) max_cols = cols;
+            }
+            x0 = c.x0; x1 = x0 + max_cols * (4 * scale + 1);
+            y0 = c.y0; y1 = y0 + lines * 8 * scale + 6 * scale;
+            break;
+        }
+        default:
+            // 모르는 op는 보수적으로 전체
+            return RawBounds{0, 0, 0, 0, true};
+        }
+
+        return RawBounds{x0, y0, x1, y1, false};
+    }
+
+    /// @brief 커맨드 영역을 clip 사각형으로 자른다 (full이면 clip 자체가 된다)
+    static inline RawBounds clip_raw_(RawBounds b, const RectI& clip) noexcept {
+        if (clip == RectI::unbounded()) return b;
+        if (b.full) return RawBounds{clip.x0, clip.y0, clip.x1, clip.y1, false};
+        b.x0 = std::max<std::int64_t>(b.x0, clip.x0);
+        b.y0 = std::max<std::int64_t>(b.y0, clip.y0);
+        b.x1 = std::min<std::int64_t>(b.x1, clip.x1);
+        b.y1 = std::min<std::int64_t>(b.y1, clip.y1);
+        return b;
+    }
+
+    /// @brief 캔버스 [0,W) x [0,H)로 클립 (비면 x0>=x1)
+    static SoftwareRenderer::CmdBounds clip_bounds_(const RawBounds& r, int W, int H) noexcept {
+        if (r.full) return SoftwareRenderer::CmdBounds{0, 0, W, H};
+
+        SoftwareRenderer::CmdBounds b{};
+        b.x0 = (int)std::clamp<std::int64_t>(r.x0, 0, W);
+        b.y0 = (int)std::clamp<std::int64_t>(r.y0, 0, H);
+        b.x1 = (int)std::clamp<std::int64_t>(r.x1, 0, W);
+        b.y1 = (int)std::clamp<std::int64_t>(r.y1, 0, H);
+        return b;
+    }
+
+    /// @brief 커맨드가 clip을 적용한 뒤에도 타일 전체를 불투명하게 덮는지 (앞 커맨드 결과가 남지 않는다)
+    static bool occludes_(const RenderQueue& rq, std::size_t ci, const SoftwareRenderer::SpriteRef& sp,
+                          int x0, int y0, int x1, int y1) noexcept {
+        const RenderQueue::Cmd& c = rq.cmd(ci);
+        switch (c.op) {
+        case RenderQueue::Op::Clear:   // 알파와 무관하게 덮어쓴다
+            break;
+        case RenderQueue::Op::FillRect:
+        case RenderQueue::Op::BlendRect:
+            if (c.color.a != 255) return false;
+            break;
+        case RenderQueue::Op::BlitSprite:
+            // 무tint 불투명은 행 복사 경로
+            if (sp.alpha != SoftwareRenderer::SpriteAlpha::Opaque || internal::pack_rgba(c.color) != 0xFFFFFFFFu) return false;
+            break;
+        default:
+            return false;
+        }
+
+        const RawBounds b = clip_raw_(raw_bounds_(rq, ci), rq.clip_rect(c.u1));
+        if (b.full) return true;
+        return b.x0 <= x0 && b.y0 <= y0 && b.x1 >= x1 && b.y1 >= y1;
+    }
+
+    static inline std::uint64_t mix_(std::uint64_t h, std::uint64_t v) noexcept {
+        h = (h ^ v) * 0x9E3779B97F4A7C15ull;
+        return h ^ (h >> 29);
+    }
+
+    /**
+     * @brief 타일 signature: 실행할 커맨드들의 내용 + clip 사각형 + payload 포인터
+     *        (텍스트 바이트, 이 타일의 인스턴스 값, 리스트 revision 포함). 0은 쓰지 않는다
+     */
+    template <class Index>
+    static std::uint64_t tile_signature_(const RenderQueue& rq, const Index* cmds, std::size_t n,
+                                         const std::uint32_t* inst_n, const std::uint32_t* inst_refs) noexcept {
+        std::uint64_t h = 0xCBF29CE484222325ull;
+        for (std::size_t k = 0; k < n; ++k) {
+            const std::size_t ci = cmds[k];
+            const RenderQueue::Cmd& c = rq.cmd(ci);
+
+            h = mix_(h, (std::uint64_t)c.op | (std::uint64_t)c.flags << 8 | (std::uint64_t)internal::pack_rgba(c.color) << 16);
+            h = mix_(h, (std::uint64_t)(std::uint32_t)c.x0 | (std::uint64_t)(std::uint32_t)c.y0 << 32);
+            h = mix_(h, (std::uint64_t)(std::uint32_t)c.x1 | (std::uint64_t)(std::uint32_t)c.y1 << 32);
+            h = mix_(h, (std::uint64_t)c.u0);
+            if (c.u1 != RenderQueue::kNoClip) {
+                const RectI r = rq.clip_rect(c.u1);
+                h = mix_(h, (std::uint64_t)(std::uint32_t)r.x0 | (std::uint64_t)(std::uint32_t)r.y0 << 32);
+                h = mix_(h, (std::uint64_t)(std::uint32_t)r.x1 | (std::uint64_t)(std::uint32_t)r.y1 << 32);
+            }
+            h = mix_(h, (std::uint64_t)rq.payload0(ci));
+            h = mix_(h, (std::uint64_t)rq.payload1(ci));
+
+            switch (c.op) {
+            case RenderQueue::Op::Text: {
+                const char* t = rq.text_data((std::uint32_t)c.x1);
+                for (std::int32_t i = 0; i < c.y1; ++i) h = mix_(h, (std::uint64_t)(unsigned char)t[i]);
+                break;
+            }
+            case RenderQueue::Op::FillRectInstanced:
+            case RenderQueue::Op::BlitSpriteInstanced: {
+                const auto* inst = (const Instance*)rq.payload0(ci);
+                const std::uint32_t m = inst_n[k];
+                for (std::uint32_t j = 0; j < m; ++j) {
+                    const Instance& e = inst[inst_refs[j]];
+                    h = mix_(h, (std::uint64_t)(std::uint32_t)e.x | (std::uint64_t)(std::uint32_t)e.y << 32);
+                    h = mix_(h, internal::pack_rgba(e.color));
+                }
+                inst_refs += m;
+                break;
+            }
+            case RenderQueue::Op::DrawList:
+                h = mix_(h, ((const DisplayList*)rq.payload0(ci))->revision());
+                break;
+            case RenderQueue::Op::BlitSprite:
+                // 텍스처는 update()로 같은 주소의 내용이 바뀔 수 있다
+                if (rq.payload1(ci)) h = mix_(h, ((const Texture*)rq.payload1(ci))->revision);
+                break;
+            case RenderQueue::Op::FillPolygon:
+                if (const PointI* v = rq.vertex_data((std::uint32_t)c.x0, (std::uint32_t)c.x1)) {
+                    for (std::int32_t i = 0; i < c.x1; ++i) {
+                        h = mix_(h, (std::uint64_t)(std::uint32_t)v[i].x | (std::uint64_t)(std::uint32_t)v[i].y << 32);
+                    }
+                }
+                break;
+            case RenderQueue::Op::BlitSpriteAffine:
+                if (rq.payload1(ci)) h = mix_(h, ((const Texture*)rq.payload1(ci))->revision);
+                if (const SpriteAffine* a = rq.affine_data((std::uint32_t)c.x0)) {
+                    h = mix_(h, (std::uint64_t)a->u0);
+                    h = mix_(h, (std::uint64_t)a->v0);
+                    h = mix_(h, (std::uint64_t)(std::uint32_t)a->du_dx | (std::uint64_t)(std::uint32_t)a->dv_dx << 32);
+                    h = mix_(h, (std::uint64_t)(std::uint32_t)a->du_dy | (std::uint64_t)(std::uint32_t)a->dv_dy << 32);
+                    h = mix_(h, (std::uint64_t)(std::uint32_t)a->x0 | (std::uint64_t)(std::uint32_t)a->y0 << 32);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        return h | 1u;
+    }
+
+    /// @brief 실행한 타일을 사각형으로: 행마다 연속 구간, 위 행 사각형과 x 범위가 같으면 아래로 늘린다
+    static void build_damage_(const std::uint8_t* state, int tiles_x, int tiles_y, int tile, int W, int H,
+                              std::vector<RectI>& out) noexcept {
+        out.clear();
+        std::vector<std::size_t> open, next;   // 직전 행/이번 행에서 닿은 사각형
+
+        for (int ty = 0; ty < tiles_y; ++ty) {
+            const std::uint8_t* row = state + (std::size_t)ty * (std::size_t)tiles_x;
+            const int y0 = ty * tile;
+            const int y1 = std::min(y0 + tile, H);
+            next.clear();
+
+            for (int tx = 0; tx < tiles_x;) {
+                if (row[tx] != 1) { ++tx; continue; }
+                const int run0 = tx;
+                while (tx < tiles_x && row[tx] == 1) ++tx;
+                const int x0 = run0 * tile;
+                const int x1 = std::min(tx * tile, W);
+
+                auto it = std::find_if(open.begin(), open.end(), [&](std::size_t k) noexcept {
+                    return out[k].x0 == x0 && out[k].x1 == x1;
+                });
+                if (it != open.end()) {
+                    out[*it].y1 = y1;
+                    next.push_back(*it);
+                } else {
+                    next.push_back(out.size());
+                    out.push_back(RectI{x0, y0, x1, y1});
+                }
+            }
+            open.swap(next);
+        }
+    }
+
+    // ---- 계측 ----
+
+    static inline std::uint64_t now_ns_() noexcept {
+        return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /// @brief 실행한 타일을 가장 느린 타일 대비 시간으로 칠한다 (파랑 -> 빨강, 반투명)
+    static void heatmap_(PixelCanvas& out, const std::uint64_t* ns, const std::uint8_t* state,
+                         int tiles_x, int tiles_y, int tile, std::uint64_t max_ns) noexcept {
+        if (max_ns == 0) return;
+        TileTarget t{};
+        t.pixels = out.pixels().data();
+        t.stride = (std::size_t)out.width();
+        t.x1 = (int)out.width();
+        t.y1 = (int)out.height();
+        t.premul = out.premultiplied();
+
+        for (int ty = 0; ty < tiles_y; ++ty) {
+            for (int tx = 0; tx < tiles_x; ++tx) {
+                const std::size_t k = (std::size_t)ty * (std::size_t)tiles_x + (std::size_t)tx;
+                if (state[k] != 1) continue;
+                const auto r = (std::uint8_t)std::min<std::uint64_t>(ns[k] * 255u / max_ns, 255u);
+                rect_(t, tx * tile, ty * tile, (tx + 1) * tile, (ty + 1) * tile,
+                      ColorRGBA8{r, 0, (std::uint8_t)(255u - r), 96});
+            }
+        }
+    }
+
+    // ---- 타일 크기 / job 배치 ----
+
+    /// @brief 워커당 job 목표 (타일 수와 job 크기의 기준)
+    static constexpr std::uint64_t kJobsPerWorker = 4;
+
+    /// @brief 자동 타일 크기에서 타일당 예상 bin 항목 상한 (넘으면 타일을 줄인다)
+    static constexpr std::uint64_t kMaxBinPerTile = 64;
+
+    /// @brief bin 항목 하나의 고정 비용 (커맨드 복사/clip/분기, 픽셀 1개 = 1)
+    static constexpr std::uint64_t kCmdCost = 64;
+
+    /// @brief 비싼 타일을 나눌 때 띠의 최소 높이(px)
+    static constexpr int kMinBand = 8;
+
+    /// @brief 64에서 시작해 타일 수가 워커 x kJobsPerWorker보다 적거나 타일당 bin 항목이 많으면 절반으로 (최소 16)
+    /// @param density 지난 프레임 bin 항목 수 / kTile x kTile 면적 (x16)
+    static int auto_tile_size_(int W, int H, std::uint32_t workers, std::uint32_t density) noexcept {
+        const std::uint64_t want = workers ? (std::uint64_t)workers * kJobsPerWorker : 1u;
+        int s = 64;
+        while (s > 16) {
+            const std::uint64_t tiles = (std::uint64_t)((W + s - 1) / s) * (std::uint64_t)((H + s - 1) / s);
+            const std::uint64_t per_tile = (std::uint64_t)density * (std::uint64_t)s * (std::uint64_t)s
+                                           / (16u * (std::uint64_t)SoftwareRenderer::kTile * SoftwareRenderer::kTile);
+            if (tiles >= want && per_tile <= kMaxBinPerTile) break;
+            s /= 2;
+        }
+        return s;
+    }
+
+    /// @brief 타일 안 w x h 영역에 대한 커맨드 래스터 비용 추정 (픽셀 수 x op 가중치)
+    static std::uint64_t cmd_cost_(const RenderQueue::Cmd& c, std::int64_t w, std::int64_t h) noexcept {
+        const std::uint64_t area = (std::uint64_t)(w * h);
+        const std::uint64_t blend = (c.color.a == 255) ? 1u : 2u;
+        switch (c.op) {
+        case RenderQueue::Op::Line:
+            return (std::uint64_t)std::max(w, h) * blend;
+        case RenderQueue::Op::Circle:
+            return (std::uint64_t)(w + h) * blend;
+        case RenderQueue::Op::RectOutline:
+            return std::min(area, (std::uint64_t)(2 * (std::int64_t)c.u0 * (w + h))) * blend;
+        case RenderQueue::Op::BlitSprite:
+        case RenderQueue::Op::BlitSpriteInstanced:
+            return area * 3u;
+        case RenderQueue::Op::BlitSpriteAffine:
+            return area * (((c.flags & RenderQueue::kFlagBilinear) != 0) ? 10u : 6u);
+        case RenderQueue::Op::DrawList:
+            return area * 4u;
+        case RenderQueue::Op::Text:
+            return area / 2u;
+        default:
+            return area * blend;
+        }
+    }
+
+    void SoftwareRenderer::invalidate_sprite(const void* pixels) noexcept {
+        m_sig_valid = false;
+        for (auto it = m_sprite_cache.begin(); it != m_sprite_cache.end();) {
+            if (it->first.pixels == pixels) it = m_sprite_cache.erase(it);
+            else ++it;
+        }
+    }
+
+    SoftwareRenderer::SpriteRef SoftwareRenderer::sprite_ref_(const RenderQueue::Cmd& c,
+                                                              const std::uint32_t* pixels,
+                                                              bool premul) noexcept {
+        const SpriteKey key{pixels, c.x1, c.y1, c.u0};
+        auto it = m_sprite_cache.find(key);
+        if (it == m_sprite_cache.end()) {
+            it = m_sprite_cache.emplace(key, SpriteEntry{classify_alpha(pixels, c.x1, c.y1, c.u0), m_frame, {}}).first;
+        }
+        SpriteEntry& e = it->second;
+        e.last_used = m_frame;
+
+        // 불투명이면 premultiplied 표현이 원본과 같다
+        if (!premul || e.alpha == SpriteAlpha::Opaque) return SpriteRef{pixels, c.u0, e.alpha};
+
+        if (e.premul.empty()) {
+            const std::size_t w = (std::size_t)c.x1;
+            e.premul.resize(w * (std::size_t)c.y1);
+            for (std::int32_t y = 0; y < c.y1; ++y) {
+                const std::uint32_t* row = pixels + (std::size_t)y * c.u0;
+                std::uint32_t* dst = e.premul.data() + (std::size_t)y * w;
+                for (std::size_t x = 0; x < w; ++x) dst[x] = internal::premultiply(row[x]);
+            }
+        }
+        return SpriteRef{e.premul.data(), (std::uint32_t)c.x1, e.alpha};
+    }
+
+    /// @brief TextureCache 텍스처의 소스 (premultiplied 캔버스면 사본)
+    static inline SpriteRef texture_ref_(const Texture& t, bool premul) noexcept {
+        return SpriteRef{premul ? t.premul : t.pixels, t.stride, t.alpha};
+    }
+
+    // ---- DisplayList ----
+
+    /// @brief 로컬 격자 타일 수 상한 (넘으면 격자 타일 크기를 2배씩 키운다)
+    static constexpr std::int64_t kMaxListTiles = 1 << 16;
+
+    /// @brief 로컬 좌표 범위 (오프셋을 더해도 int에 들어가도록)
+    static constexpr std::int64_t kListCoordLimit = 1 << 28;
+
+    /// @brief 정렬 순서와 로컬 타일 인덱스를 만든다 (리스트가 바뀐 뒤 첫 재생에서만)
+    static void build_list_index_(const DisplayList& list, DisplayListIndex& li,
+                                  std::vector<std::uint64_t>& sort_a, std::vector<std::uint64_t>& sort_b) noexcept {
+        const std::size_t n = list.size();
+        li.order.resize(n);
+        if (n) internal::radix_sort_order(&list.data()[0].sort_key, sizeof(RenderQueue::Cmd), n, li.order.data(), sort_a, sort_b);
+
+        li.sprites.assign(n, SpriteRef{});
+        li.sprite_cmds.clear();
+        li.full.clear();
+
+        std::vector<RawBounds> rb(n);
+        std::int64_t ux0 = kListCoordLimit, uy0 = kListCoordLimit, ux1 = -kListCoordLimit, uy1 = -kListCoordLimit;
+
+        for (std::size_t r = 0; r < n; ++r) {
+            const std::uint32_t ci = li.order[r];
+            const RenderQueue::Op op = list.cmd(ci).op;
+            if (op == RenderQueue::Op::BlitSprite || op == RenderQueue::Op::BlitSpriteInstanced
+                || op == RenderQueue::Op::BlitSpriteAffine) li.sprite_cmds.push_back(ci);
+
+            RawBounds& b = rb[r];
+            b = clip_raw_(raw_bounds_(list, ci), list.clip_rect(list.cmd(ci).u1));
+            if (b.full) { li.full.push_back((std::uint32_t)r); continue; }
+            if (b.empty()) continue;
+
+            b.x0 = std::clamp(b.x0, -kListCoordLimit, kListCoordLimit);
+            b.y0 = std::clamp(b.y0, -kListCoordLimit, kListCoordLimit);
+            b.x1 = std::clamp(b.x1, -kListCoordLimit, kListCoordLimit);
+            b.y1 = std::clamp(b.y1, -kListCoordLimit, kListCoordLimit);
+            if (b.empty()) continue;
+
+            ux0 = std::min(ux0, b.x0); uy0 = std::min(uy0, b.y0);
+            ux1 = std::max(ux1, b.x1); uy1 = std::max(uy1, b.y1);
+        }
+
+        li.x0 = ux0; li.y0 = uy0; li.x1 = ux1; li.y1 = uy1;
+        li.gw = li.gh = 0;
+        li.bin_start.assign(1, 0u);
+        li.bin_ranks.clear();
+        if (ux0 >= ux1 || uy0 >= uy1) return;   // 유한 영역 커맨드 없음 -> full만
+
+        std::int64_t tile = SoftwareRenderer::kTile;
+        while (((ux1 - ux0 + tile - 1) / tile) * ((uy1 - uy0 + tile - 1) / tile) > kMaxListTiles) tile *= 2;
+
+        li.tile = (int)tile;
+        li.gx0 = (int)ux0;
+        li.gy0 = (int)uy0;
+        li.gw = (int)((ux1 - ux0 + tile - 1) / tile);
+        li.gh = (int)((uy1 - uy0 + tile - 1) / tile);
+
+        const std::size_t cells = (std::size_t)li.gw * (std::size_t)li.gh;
+        li.bin_start.assign(cells + 1, 0u);
+
+        auto for_each_cell = [&](const RawBounds& b, auto&& fn) noexcept {
+            if (b.full) {
+                for (std::size_t k = 0; k < cells; ++k) fn(k);
+                return;
+            }
+            if (b.empty()) return;
+            const int cx0 = (int)((b.x0 - ux0) / tile), cx1 = (int)((b.x1 - 1 - ux0) / tile);
+            const int cy0 = (int)((b.y0 - uy0) / tile), cy1 = (int)((b.y1 - 1 - uy0) / tile);
+            for (int cy = cy0; cy <= cy1; ++cy) {
+                for (int cx = cx0; cx <= cx1; ++cx) fn((std::size_t)cy * (std::size_t)li.gw + (std::size_t)cx);
+            }
+        };
+
+        for (std::size_t r = 0; r < n; ++r) for_each_cell(rb[r], [&](std::size_t k) noexcept { ++li.bin_start[k + 1]; });
+        for (std::size_t k = 0; k < cells; ++k) li.bin_start[k + 1] += li.bin_start[k];
+
+        // rank 오름차순으로 채우므로 bin마다 실행 순서가 유지된다
+        std::vector<std::uint32_t> fill(li.bin_start.begin(), li.bin_start.end() - 1);
+        li.bin_ranks.resize(li.bin_start[cells]);
+        for (std::size_t r = 0; r < n; ++r) {
+            for_each_cell(rb[r], [&](std::size_t k) noexcept { li.bin_ranks[fill[k]++] = (std::uint32_t)r; });
+        }
+    }
+
+    /// @brief 화면 타일 하나에 리스트를 재생: 겹치는 로컬 bin들을 rank 순으로 병합(중복 제거)해 실행
+    static void replay_list_(const DisplayList& list, const DisplayListIndex& li,
+                             PixelCanvas& out, const Tile& tile, int dx, int dy,
+                             SoftwareRenderer::Profile* prof) noexcept {
+        TileInputs in{};
+        in.sprites = li.sprites.data();
+        in.dx = dx;
+        in.dy = dy;
+        in.prof = prof;
+
+        constexpr std::size_t kChunk = 256;
+        std::array<std::uint32_t, kChunk> buf;
+        std::size_t fill = 0;
+
+        auto emit = [&](std::uint32_t rank) noexcept {
+            buf[fill++] = li.order[rank];
+            if (fill == kChunk) {
+                execute_tile_(list, in, buf.data(), fill, out, tile);
+                fill = 0;
+            }
+        };
+
+        // 이 타일이 덮는 로컬 격자 범위
+        std::int64_t cx0 = 0, cy0 = 0, cx1 = -1, cy1 = -1;
+        if (li.gw > 0) {
+            cx0 = std::max<std::int64_t>(0, floor_div_((std::int64_t)tile.x0 - dx - li.gx0, li.tile));
+            cy0 = std::max<std::int64_t>(0, floor_div_((std::int64_t)tile.y0 - dy - li.gy0, li.tile));
+            cx1 = std::min<std::int64_t>(li.gw - 1, floor_div_((std::int64_t)tile.x1 - 1 - dx - li.gx0, li.tile));
+            cy1 = std::min<std::int64_t>(li.gh - 1, floor_div_((std::int64_t)tile.y1 - 1 - dy - li.gy0, li.tile));
+        }
+
+        if (cx0 > cx1 || cy0 > cy1) {
+            // 격자 밖: 영역이 무한인 커맨드만
+            for (std::uint32_t r : li.full) emit(r);
+        } else {
+            struct Cursor { const std::uint32_t* it; const std::uint32_t* end; };
+            std::array<Cursor, 16> cur;
+            std::size_t nc = 0;
+
+            const std::size_t cells = (std::size_t)((cx1 - cx0 + 1) * (cy1 - cy0 + 1));
+            if (cells > cur.size()) {
+                // 로컬 격자보다 화면 타일이 훨씬 큰 경우: 전체 순서대로 (프리미티브가 타일로 클립)
+                for (std::uint32_t r = 0; r < (std::uint32_t)li.order.size(); ++r) emit(r);
+            } else {
+                for (std::int64_t cy = cy0; cy <= cy1; ++cy) {
+                    for (std::int64_t cx = cx0; cx <= cx1; ++cx) {
+                        const std::size_t k = (std::size_t)cy * (std::size_t)li.gw + (std::size_t)cx;
+                        if (li.bin_start[k] != li.bin_start[k + 1]) {
+                            cur[nc++] = Cursor{li.bin_ranks.data() + li.bin_start[k], li.bin_ranks.data() + li.bin_start[k + 1]};
+                        }
+                    }
+                }
+
+                while (true) {
+                    std::uint32_t next = 0xFFFFFFFFu;
+                    for (std::size_t i = 0; i < nc; ++i) {
+                        if (cur[i].it != cur[i].end && *cur[i].it < next) next = *cur[i].it;
+                    }
+                    if (next == 0xFFFFFFFFu) break;
+
+                    // 여러 bin에 걸친 커맨드는 한 번만
+                    for (std::size_t i = 0; i < nc; ++i) {
+                        if (cur[i].it != cur[i].end && *cur[i].it == next) ++cur[i].it;
+                    }
+                    emit(next);
+                }
+            }
+        }
+
+        if (fill) execute_tile_(list, in, buf.data(), fill, out, tile);
+    }
+
+    SoftwareRenderer::SoftwareRenderer() = default;
+    SoftwareRenderer::~SoftwareRenderer() = default;
+
+    void SoftwareRenderer::clear_list_cache() noexcept {
+        m_list_cache.clear();
+    }
+
+    const DisplayListIndex* SoftwareRenderer::list_index_(const DisplayList& list, bool premul) noexcept {
+        auto& slot = m_list_cache[&list];
+        if (!slot) slot = std::make_unique<DisplayListIndex>();
+
+        DisplayListIndex& li = *slot;
+        li.last_used = m_frame;
+        if (li.revision != list.revision()) {
+            li.revision = list.revision();
+            build_list_index_(list, li, m_sort_a, m_sort_b);
+        }
+
+        // 스프라이트 참조는 매 프레임 갱신 (캐시 aging 유지 + 캔버스 포맷 변경 반영)
+        for (std::uint32_t ci : li.sprite_cmds) {
+            const RenderQueue::Cmd& c = list.cmd(ci);
+            if (c.op != RenderQueue::Op::BlitSpriteInstanced && list.payload1(ci)) {
+                li.sprites[ci] = texture_ref_(*(const Texture*)list.payload1(ci), premul);
+            } else if (c.op == RenderQueue::Op::BlitSpriteInstanced) {
+                li.sprites[ci] = sprite_ref_(c, (const std::uint32_t*)list.payload1(ci), premul);
+            } else if (c.x1 > 0 && c.y1 > 0 && (premul || internal::pack_rgba(c.color) == 0xFFFFFFFFu)) {
+                li.sprites[ci] = sprite_ref_(c, (const std::uint32_t*)list.payload0(ci), premul);
+            } else {
+                li.sprites[ci] = SpriteRef{};
+            }
+        }
+        return &li;
+    }
+
     void SoftwareRenderer::execute(const framedot::core::FrameContext& ctx,
                                    const RenderQueue& rq,
                                    PixelCanvas& out) noexcept {
+        m_stats = Stats{};
+        m_damage.clear();
+        m_profile = Profile{};
+        m_tile_ns.clear();
         const std::size_t n = rq.size();
         if (n == 0) return;
+        if (out.width() == 0 || out.height() == 0) return;
 
-        // 1) order 정렬 (고정 배열)
-        std::array<std::uint16_t, RenderQueue::kMax> order{};
-        for (std::size_t i = 0; i < n; ++i) order[i] = (std::uint16_t)i;
-
-        const RenderQueue::Cmd* cmds = rq.data();
-        std::sort(order.begin(), order.begin() + (std::ptrdiff_t)n,
-                  [&](std::uint16_t a, std::uint16_t b) {
-                      return cmds[a].sort_key < cmds[b].sort_key;
-                  });
+        const std::uint64_t t0 = m_profiling ? now_ns_() : 0u;
+        if (n <= 0x10000u) execute_(ctx, rq, out, m_idx16);
+        else               execute_(ctx, rq, out, m_idx32);
+        if (m_profiling) m_profile.execute_ns = now_ns_() - t0;
+    }
 
+    template <class Index>
+    void SoftwareRenderer::execute_(const framedot::core::FrameContext& ctx,
+                                    const RenderQueue& rq,
+                                    PixelCanvas& out,
+                                    IndexBuffers<Index>& idx) noexcept {
+        const std::size_t n = rq.size();
         const int W = (int)out.width();
         const int H = (int)out.height();
 
-        // 2) 타일 병렬
-        constexpr int kTile = 32;
+        // 1) order 정렬: (sort_key, 제출 인덱스) 오름차순. 같은 key의 순서가 프레임마다 흔들리지 않는다
+        idx.order.resize(n);
+        Index* order = idx.order.data();
+
+        if (rq.contiguous()) {
+            internal::radix_sort_order(&rq.data()[0].sort_key, sizeof(RenderQueue::Cmd), n, order,
+                                       m_sort_a, m_sort_b, ctx.jobs);
+        } else {
+            m_keys.resize(n);
+            for (std::size_t i = 0; i < n; ++i) m_keys[i] = rq.cmd(i).sort_key;
+            internal::radix_sort_order(m_keys.data(), sizeof(std::uint32_t), n, order,
+                                       m_sort_a, m_sort_b, ctx.jobs);
+        }
+
+        // 2) binning: 커맨드 영역은 한 번만 계산하고, 겹치는 타일 bin에 정렬 순서대로 추가
+        const std::uint32_t workers = ctx.jobs ? ctx.jobs->worker_count() : 0u;
+        const bool track = m_dirty_tracking;
+        const CanvasKey canvas_key{out.pixels().data(), out.width(), out.height(), out.format()};
+
+        // 타일 크기: dirty 추적 중에는 signature 격자가 바뀌지 않도록 캔버스가 같으면 유지
+        int tile = m_tile_size;
+        if (tile == 0) {
+            const bool keep = track && m_sig_valid && canvas_key == m_sig_canvas;
+            tile = keep ? m_tile : auto_tile_size_(W, H, workers, m_bin_density);
+        }
+        const bool same_grid = (tile == m_tile);
+        m_tile = tile;
+
+        const int tiles_x = (W + tile - 1) / tile;
+        const int tiles_y = (H + tile - 1) / tile;
+        const std::size_t tile_count = (std::size_t)tiles_x * (std::size_t)tiles_y;
+        const bool can_parallel = (workers > 0 && tile_count >= 2);
+        const bool prof = m_profiling;
+        if (prof) m_tile_ns.assign(tile_count, 0u);
+
+        m_bounds.resize(n);
+        m_bin_start.assign(tile_count + 1, 0u);
+        m_cmd_sprite.assign(n, SpriteRef{});
+        const bool premul = out.premultiplied();
+
+        // 스프라이트 분류 캐시 aging
+        ++m_frame;
+        if ((m_frame & 63u) == 0u) {
+            for (auto it = m_sprite_cache.begin(); it != m_sprite_cache.end();) {
+                if (m_frame - it->second.last_used > kSpriteCacheMaxAge) it = m_sprite_cache.erase(it);
+                else ++it;
+            }
+            for (auto it = m_list_cache.begin(); it != m_list_cache.end();) {
+                if (m_frame - it->second->last_used > kSpriteCacheMaxAge) it = m_list_cache.erase(it);
+                else ++it;
+            }
+        }
+
+        // 인스턴스 op: 인스턴스마다 타일을 세고, 커맨드는 타일당 한 번만 bin에 넣는다 (stamp로 중복 제거)
+        m_inst_start.assign(tile_count + 1, 0u);
+        m_tile_stamp.assign(tile_count, ~0u);
+        bool any_instanced = false;
+
+        // 인스턴스 영역은 커맨드 영역(캔버스 ∩ clip)으로 잘라서 배분한다
+        auto for_each_instance_tile = [&](std::size_t oi, auto&& fn) noexcept {
+            const RenderQueue::Cmd& c = rq.cmd(order[oi]);
+            const CmdBounds& cb = m_bounds[oi];
+            const auto* inst = (const Instance*)rq.payload0(order[oi]);
+            for (std::int32_t k = 0; k < c.x0; ++k) {
+                const std::int64_t ix = inst[k].x, iy = inst[k].y;
+                const int x0 = (int)std::clamp<std::int64_t>(ix, cb.x0, cb.x1);
+                const int y0 = (int)std::clamp<std::int64_t>(iy, cb.y0, cb.y1);
+                const int x1 = (int)std::clamp<std::int64_t>(ix + c.x1, cb.x0, cb.x1);
+                const int y1 = (int)std::clamp<std::int64_t>(iy + c.y1, cb.y0, cb.y1);
+                if (x0 >= x1 || y0 >= y1) continue;
+
+                for (int ty = y0 / tile; ty <= (y1 - 1) / tile; ++ty) {
+                    for (int tx = x0 / tile; tx <= (x1 - 1) / tile; ++tx) {
+                        fn((std::size_t)ty * (std::size_t)tiles_x + (std::size_t)tx, (std::uint32_t)k);
+                    }
+                }
+            }
+        };
+
+        m_cmd_list.resize(n);
+
+        for (std::size_t oi = 0; oi < n; ++oi) {
+            const RenderQueue::Cmd& c = rq.cmd(order[oi]);
+
+            RawBounds rb{};
+            if (c.op == RenderQueue::Op::DrawList) {
+                // 리스트: 캐시된 인덱스의 영역 + 오프셋
+                const DisplayListIndex* li = list_index_(*(const DisplayList*)rq.payload0(order[oi]), premul);
+                m_cmd_list[order[oi]] = li;
+
+                if (!li->full.empty()) rb = RawBounds{0, 0, 0, 0, true};
+                else rb = RawBounds{li->x0 + c.x0, li->y0 + c.y0, li->x1 + c.x0, li->y1 + c.y0, false};
+            } else {
+                rb = raw_bounds_(rq, order[oi]);
+            }
 
-        const int tiles_x = (W + kTile - 1) / kTile;
-        const int tiles_y = (H + kTile - 1) / kTile;
-        const int tile_count = tiles_x * tiles_y;
+            // clip: 완전히 잘린 커맨드는 어느 bin에도 들어가지 않는다
+            rb = clip_raw_(rb, rq.clip_rect(c.u1));
 
-        const bool can_parallel = (ctx.jobs && ctx.jobs->worker_count() > 0 && tile_count >= 2);
+            const CmdBounds b = rb.empty() ? CmdBounds{0, 0, 0, 0} : clip_bounds_(rb, W, H);
+            m_bounds[oi] = b;
+            if (b.x0 >= b.x1 || b.y0 >= b.y1) continue;
+
+            // 스프라이트: straight면 무tint만 분류, premultiplied면 tint와 무관하게 사본이 필요하다
+            // (인스턴스 sprite는 인스턴스별 tint가 있을 수 있으므로 항상)
+            const bool single = (c.op == RenderQueue::Op::BlitSprite || c.op == RenderQueue::Op::BlitSpriteAffine);
+            if (single && rq.payload1(order[oi])) {
+                m_cmd_sprite[order[oi]] = texture_ref_(*(const Texture*)rq.payload1(order[oi]), premul);
+            } else if (single && c.x1 > 0 && c.y1 > 0
+                && (premul || internal::pack_rgba(c.color) == 0xFFFFFFFFu)) {
+                m_cmd_sprite[order[oi]] = sprite_ref_(c, (const std::uint32_t*)rq.payload0(order[oi]), premul);
+            } else if (c.op == RenderQueue::Op::BlitSpriteInstanced) {
+                m_cmd_sprite[order[oi]] = sprite_ref_(c, (const std::uint32_t*)rq.payload1(order[oi]), premul);
+            }
+
+            if (is_instanced_(c.op)) {
+                any_instanced = true;
+                for_each_instance_tile(oi, [&](std::size_t t, std::uint32_t) noexcept {
+                    if (m_tile_stamp[t] != (std::uint32_t)oi) {
+                        m_tile_stamp[t] = (std::uint32_t)oi;
+                        ++m_bin_start[t + 1];
+                    }
+                    ++m_inst_start[t + 1];
+                });
+                continue;
+            }
+
+            for (int ty = b.y0 / tile; ty <= (b.y1 - 1) / tile; ++ty) {
+                for (int tx = b.x0 / tile; tx <= (b.x1 - 1) / tile; ++tx) {
+                    ++m_bin_start[(std::size_t)ty * (std::size_t)tiles_x + (std::size_t)tx + 1];
+                }
+            }
+        }
+
+        for (std::size_t t = 0; t < tile_count; ++t) m_bin_start[t + 1] += m_bin_start[t];
+
+        m_bin_fill.assign(m_bin_start.begin(), m_bin_start.end() - 1);
+        idx.bin_cmds.resize(m_bin_start[tile_count]);
+        m_tile_culled.assign(tile_count, 0u);
+        m_tile_state.assign(tile_count, 0u);
+
+        // 병렬이면 타일 비용을 bin과 같이 센다 (job 배치용)
+        if (can_parallel) m_tile_cost.assign(tile_count, 0u);
+
+        // dirty 추적: 캔버스/타일 격자가 바뀌었거나 무효화됐으면 모든 signature를 버린다
+        if (track && !(m_sig_valid && same_grid && canvas_key == m_sig_canvas && m_tile_sig.size() == tile_count)) {
+            m_tile_sig.assign(tile_count, 0u);
+        }
+
+        if (any_instanced) {
+            for (std::size_t t = 0; t < tile_count; ++t) m_inst_start[t + 1] += m_inst_start[t];
+            m_inst_fill.assign(m_inst_start.begin(), m_inst_start.end() - 1);
+            m_inst_refs.resize(m_inst_start[tile_count]);
+            m_bin_inst_n.resize(idx.bin_cmds.size());
+            m_tile_entry.resize(tile_count);
+            std::fill(m_tile_stamp.begin(), m_tile_stamp.end(), ~0u);
+        }
+
+        for (std::size_t oi = 0; oi < n; ++oi) {
+            const CmdBounds& b = m_bounds[oi];
+            if (b.x0 >= b.x1 || b.y0 >= b.y1) continue;
+
+            const RenderQueue::Cmd& c = rq.cmd(order[oi]);
+            if (is_instanced_(c.op)) {
+                // 인스턴스 비용은 타일로 자르지 않은 크기 (타일 면적 상한)
+                const std::int64_t iw = std::min<std::int64_t>(c.x1, tile), ih = std::min<std::int64_t>(c.y1, tile);
+                for_each_instance_tile(oi, [&](std::size_t t, std::uint32_t k) noexcept {
+                    if (m_tile_stamp[t] != (std::uint32_t)oi) {
+                        m_tile_stamp[t] = (std::uint32_t)oi;
+                        m_tile_entry[t] = m_bin_fill[t]++;
+                        idx.bin_cmds[m_tile_entry[t]] = order[oi];
+                        m_bin_inst_n[m_tile_entry[t]] = 0;
+                        if (can_parallel) m_tile_cost[t] += kCmdCost;
+                    }
+                    m_inst_refs[m_inst_fill[t]++] = k;
+                    ++m_bin_inst_n[m_tile_entry[t]];
+                    if (can_parallel) m_tile_cost[t] += cmd_cost_(c, iw, ih);
+                });
+                continue;
+            }
+
+            for (int ty = b.y0 / tile; ty <= (b.y1 - 1) / tile; ++ty) {
+                for (int tx = b.x0 / tile; tx <= (b.x1 - 1) / tile; ++tx) {
+                    const std::size_t t = (std::size_t)ty * (std::size_t)tiles_x + (std::size_t)tx;
+                    idx.bin_cmds[m_bin_fill[t]++] = order[oi];
+                    if (can_parallel) {
+                        const std::int64_t w = std::min(b.x1, (tx + 1) * tile) - std::max(b.x0, tx * tile);
+                        const std::int64_t h = std::min(b.y1, (ty + 1) * tile) - std::max(b.y0, ty * tile);
+                        m_tile_cost[t] += kCmdCost + cmd_cost_(c, w, h);
+                    }
+                }
+            }
+        }
+
+        // 3) 타일 실행: prepare(가림/dirty 판단) 뒤 draw. 띠로 나눈 타일은 prepare를 dispatch 전에 한 번만 한다
+        m_tile_begin.resize(tile_count);
+        m_tile_inst.resize(tile_count);
+
+        auto tile_rect = [&](std::size_t t) noexcept {
+            const int x0 = (int)(t % (std::size_t)tiles_x) * tile;
+            const int y0 = (int)(t / (std::size_t)tiles_x) * tile;
+            return Tile{x0, y0, (x0 + tile < W) ? (x0 + tile) : W, (y0 + tile < H) ? (y0 + tile) : H};
+        };
+
+        // 그릴 타일이면 실행 시작 위치를 m_tile_begin/m_tile_inst에 두고 true
+        auto prepare_tile = [&](std::size_t t) noexcept -> bool {
+            const std::uint32_t b = m_bin_start[t];
+            const std::uint32_t e = m_bin_start[t + 1];
+            if (b == e) return false;
+            const Tile r = tile_rect(t);
+
+            // 뒤에서부터 타일을 덮는 첫 커맨드를 찾는다 (그 앞은 결과에 남지 않는다)
+            std::uint32_t first = b;
+            bool covered = false;
+            if (m_occlusion || track) {
+                for (std::uint32_t k = e; k-- > b;) {
+                    const std::size_t ci = idx.bin_cmds[k];
+                    if (occludes_(rq, ci, m_cmd_sprite[ci], r.x0, r.y0, r.x1, r.y1)) { first = k; covered = true; break; }
+                }
+            }
+            std::uint32_t first_refs = any_instanced ? m_inst_start[t] : 0u;
+            if (any_instanced) {
+                for (std::uint32_t k = b; k < first; ++k) {
+                    if (is_instanced_(rq.cmd(idx.bin_cmds[k]).op)) first_refs += m_bin_inst_n[k];
+                }
+            }
+
+            // dirty 추적: 이전 픽셀과 무관한 타일만 signature 비교로 건너뛸 수 있다
+            if (track) {
+                const std::uint64_t sig = covered
+                    ? tile_signature_(rq, idx.bin_cmds.data() + first, e - first,
+                                      any_instanced ? m_bin_inst_n.data() + first : nullptr,
+                                      any_instanced ? m_inst_refs.data() + first_refs : nullptr)
+                    : 0u;
+                if (sig != 0u && m_tile_sig[t] == sig) {
+                    m_tile_state[t] = 2;
+                    return false;
+                }
+                m_tile_sig[t] = sig;
+            }
+            m_tile_state[t] = 1;
+
+            // 가림 제거: 덮는 커맨드 앞은 실행하지 않는다
+            m_tile_begin[t] = b;
+            m_tile_inst[t] = any_instanced ? m_inst_start[t] : 0u;
+            if (m_occlusion) {
+                m_tile_culled[t] = first - b;
+                m_tile_begin[t] = first;
+                m_tile_inst[t] = first_refs;
+            }
+            return true;
+        };
+
+        // 인스턴스 op가 없으면 inst_n/inst_refs는 읽히지 않는다. slot은 계측 누적 칸 (꺼져 있으면 nullptr)
+        auto draw_tile = [&](std::size_t t, const Tile& r, Profile* slot) noexcept {
+            const std::uint32_t b = m_tile_begin[t];
+            TileInputs in{};
+            in.sprites = m_cmd_sprite.data();
+            in.inst_n = any_instanced ? m_bin_inst_n.data() + b : nullptr;
+            in.inst_refs = any_instanced ? m_inst_refs.data() + m_tile_inst[t] : nullptr;
+            in.lists = m_cmd_list.data();
+            in.prof = slot;
+            execute_tile_(rq, in, idx.bin_cmds.data() + b, m_bin_start[t + 1] - b, out, r);
+        };
+
+        // 타일 시간은 prepare 포함, 실행한 타일만
+        auto run_tile = [&](std::size_t t, Profile* slot) noexcept {
+            const std::uint64_t t0 = slot ? now_ns_() : 0u;
+            if (!prepare_tile(t)) return;
+            draw_tile(t, tile_rect(t), slot);
+            if (slot) m_tile_ns[t] = now_ns_() - t0;
+        };
+
+        std::uint32_t split_tiles = 0;
+
+        auto finish_stats = [&]() noexcept {
+            m_stats.commands = (std::uint32_t)n;
+            m_stats.tiles = (std::uint32_t)tile_count;
+            m_stats.bin_entries = m_bin_start[tile_count];
+            m_stats.tile_size = (std::uint32_t)tile;
+            m_stats.jobs = can_parallel ? (std::uint32_t)m_jobs.size() : 0u;
+            m_stats.split_tiles = split_tiles;
+            for (std::size_t t = 0; t < tile_count; ++t) {
+                m_stats.culled += m_tile_culled[t];
+                m_stats.occluded_tiles += (m_tile_culled[t] != 0);
+                m_stats.dirty_tiles += (m_tile_state[t] == 1);
+                m_stats.clean_tiles += (m_tile_state[t] == 2);
+            }
+
+            // 다음 프레임 자동 타일 크기 입력
+            const std::uint64_t area = (std::uint64_t)tile_count * (std::uint64_t)tile * (std::uint64_t)tile;
+            const std::uint64_t density = (std::uint64_t)m_stats.bin_entries * 16u * (std::uint64_t)kTile * kTile / area;
+            m_bin_density = (std::uint32_t)std::min<std::uint64_t>(density, 0xFFFFFFFFu);
+
+            build_damage_(m_tile_state.data(), tiles_x, tiles_y, tile, W, H, m_damage);
+            m_sig_valid = track;
+            m_sig_canvas = canvas_key;
+            if (!prof) return;
+
+            // 계측: 띠 job 시간을 타일에 더하고 job 칸을 합친다
+            for (std::size_t ji = 0; ji < m_job_ns.size(); ++ji) m_tile_ns[m_job_tiles[m_jobs[ji].first]] += m_job_ns[ji];
+
+            Profile& p = m_profile;
+            for (const Profile& sl : m_prof_slots) {
+                p.visited += sl.visited;
+                p.drawn += sl.drawn;
+                p.pixels += sl.pixels;
+                for (std::size_t op = 0; op < kDrawOpCount; ++op) {
+                    p.op_drawn[op] += sl.op_drawn[op];
+                    p.op_pixels[op] += sl.op_pixels[op];
+                }
+            }
+            for (std::size_t t = 0; t < tile_count; ++t) {
+                p.raster_ns += m_tile_ns[t];
+                p.max_tile_ns = std::max(p.max_tile_ns, m_tile_ns[t]);
+            }
+
+            // heatmap은 캔버스를 덮어쓰므로 다음 프레임 signature를 쓰지 않는다
+            if (m_heatmap) {
+                heatmap_(out, m_tile_ns.data(), m_tile_state.data(), tiles_x, tiles_y, tile, p.max_tile_ns);
+                m_sig_valid = false;
+            }
+        };
 
         if (!can_parallel) {
-            Tile whole{0, 0, W, H};
-            execute_tile_(rq, cmds, order.data(), n, out, whole);
+            m_job_ns.clear();
+            if (prof) m_prof_slots.assign(1, Profile{});
+            Profile* slot = prof ? &m_prof_slots[0] : nullptr;
+            for (std::size_t t = 0; t < tile_count; ++t) run_tile(t, slot);
+            finish_stats();
             return;
         }
 
-        framedot::core::TaskGroup tg(ctx.jobs, framedot::core::JobLane::Engine);
+        // job 배치: 목표 크기 grain = 전체 비용 / (워커 x kJobsPerWorker).
+        // 싼 타일은 row-major로 grain까지 이어 붙이고, grain의 2배를 넘는 타일은 kMinBand 이상 높이의 띠로 나눈다
+        std::uint64_t total = 0;
+        for (std::size_t t = 0; t < tile_count; ++t) total += m_tile_cost[t];
+        const std::uint64_t grain = std::max<std::uint64_t>(total / ((std::uint64_t)workers * kJobsPerWorker), 1u);
 
-        for (int ty = 0; ty < tiles_y; ++ty) {
-            for (int tx = 0; tx < tiles_x; ++tx) {
-                const int x0 = tx * kTile;
-                const int y0 = ty * kTile;
-                const int x1 = (x0 + kTile < W) ? (x0 + kTile) : W;
-                const int y1 = (y0 + kTile < H) ? (y0 + kTile) : H;
+        m_jobs.clear();
+        m_job_tiles.clear();
+        TileJob cur{};
+        auto close_job = [&]() noexcept {
+            if (cur.count) m_jobs.push_back(cur);
+            cur = TileJob{};
+            cur.first = (std::uint32_t)m_job_tiles.size();
+        };
 
-                Tile tile{x0, y0, x1, y1};
+        for (std::size_t t = 0; t < tile_count; ++t) {
+            if (m_bin_start[t] == m_bin_start[t + 1]) continue;
+            const std::uint64_t cost = m_tile_cost[t];
+            const Tile r = tile_rect(t);
+            const std::uint64_t bands = std::min<std::uint64_t>(cost / grain, (std::uint64_t)((r.y1 - r.y0) / kMinBand));
 
-                tg.run([&, tile]() noexcept {
-                    execute_tile_(rq, cmds, order.data(), n, out, tile);
-                });
+            if (cost > 2u * grain && bands >= 2u) {
+                // 띠 job들은 prepare 결과만 읽는다 (계측: prepare 시간은 여기서, 띠 시간은 끝난 뒤 더한다)
+                close_job();
+                const std::uint64_t t0 = prof ? now_ns_() : 0u;
+                if (!prepare_tile(t)) continue;
+                if (prof) m_tile_ns[t] = now_ns_() - t0;
+                ++split_tiles;
+                const std::uint32_t at = (std::uint32_t)m_job_tiles.size();
+                m_job_tiles.push_back((std::uint32_t)t);
+                const int h = r.y1 - r.y0;
+                for (std::uint64_t k = 0; k < bands; ++k) {
+                    const int y0 = r.y0 + (int)((std::uint64_t)h * k / bands);
+                    const int y1 = r.y0 + (int)((std::uint64_t)h * (k + 1u) / bands);
+                    m_jobs.push_back(TileJob{cost / bands, at, 1u, y0, y1});
+                }
+                cur.first = (std::uint32_t)m_job_tiles.size();
+                continue;
             }
+
+            if (cur.count && cur.cost + cost > grain) close_job();
+            m_job_tiles.push_back((std::uint32_t)t);
+            ++cur.count;
+            cur.cost += cost;
+        }
+        close_job();
+
+        // 비싼 job부터 제출 (큐는 FIFO: 긴 job이 마지막에 혼자 남지 않게)
+        std::sort(m_jobs.begin(), m_jobs.end(), [](const TileJob& a, const TileJob& b) noexcept {
+            if (a.cost != b.cost) return a.cost > b.cost;
+            return (a.first != b.first) ? a.first < b.first : a.y0 < b.y0;
+        });
+
+        // 계측 칸은 job마다 (띠 job 시간도 job 칸에 두었다가 합친다)
+        if (prof) {
+            m_prof_slots.assign(m_jobs.size(), Profile{});
+            m_job_ns.assign(m_jobs.size(), 0u);
+        } else {
+            m_job_ns.clear();
+        }
+
+        framedot::core::TaskGroup tg(ctx.jobs, framedot::core::JobLane::Engine);
+
+        for (std::size_t ji = 0; ji < m_jobs.size(); ++ji) {
+            tg.run([&, ji]() noexcept {
+                const TileJob& j = m_jobs[ji];
+                Profile* slot = prof ? &m_prof_slots[ji] : nullptr;
+                if (j.y0 < j.y1) {
+                    const std::uint64_t t0 = slot ? now_ns_() : 0u;
+                    const std::size_t t = m_job_tiles[j.first];
+                    Tile r = tile_rect(t);
+                    r.y0 = j.y0;
+                    r.y1 = j.y1;
+                    draw_tile(t, r, slot);
+                    if (slot) m_job_ns[ji] = now_ns_() - t0;
+                    return;
+                }
+                for (std::uint32_t k = 0; k < j.count; ++k) run_tile(m_job_tiles[j.first + k], slot);
+            });
         }
 
         tg.wait();
+        finish_stats();
     }
 
 } // namespace framedot::gfx
\ No newline at end of file
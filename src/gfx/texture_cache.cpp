@@ -0,0 +1,212 @@
+// src/gfx/texture_cache.cpp
+/**
+ * @file texture_cache.cpp
+ * @brief TextureCache 구현부 (shelf 아틀라스 배치, 분류, premultiplied 사본)
+ */
+#include <framedot/gfx/TextureCache.hpp>
+#include <framedot_internal/gfx/RasterKernels.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace framedot::gfx {
+
+    TextureAlpha classify_alpha(const std::uint32_t* pixels, std::int32_t w, std::int32_t h,
+                                std::uint32_t stride) noexcept {
+        TextureAlpha alpha = TextureAlpha::Opaque;
+        for (std::int32_t y = 0; y < h && alpha != TextureAlpha::Translucent; ++y) {
+            const std::uint32_t* row = pixels + (std::size_t)y * stride;
+            for (std::int32_t x = 0; x < w; ++x) {
+                const std::uint32_t a = row[x] & 0xFFu;
+                if (a == 0xFFu) continue;
+                if (a != 0) { alpha = TextureAlpha::Translucent; break; }
+                alpha = TextureAlpha::Binary;
+            }
+        }
+        return alpha;
+    }
+
+    TextureCache::TextureCache(const TextureCacheConfig& cfg) {
+        m_page_size = std::clamp<std::int32_t>(cfg.page_size, 64, 4096);
+        m_max_packed = std::clamp<std::int32_t>(cfg.max_packed, 1, m_page_size);
+    }
+
+    TextureCache::~TextureCache() = default;
+
+    TextureHandle TextureCache::add(const std::uint32_t* pixels, std::int32_t w, std::int32_t h,
+                                    std::uint32_t stride_pixels) {
+        if (!pixels || w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF || stride_pixels < (std::uint32_t)w) return {};
+
+        std::uint32_t page = 0;
+        std::int32_t x = 0, y = 0;
+        if (!place_(w, h, page, x, y)) return {};
+
+        std::uint32_t si = 0;
+        if (!m_free.empty()) {
+            si = m_free.back();
+            m_free.pop_back();
+        } else {
+            si = (std::uint32_t)m_slots.size();
+            m_slots.emplace_back();
+        }
+
+        Slot& s = m_slots[si];
+        s.used = true;
+        s.tex = Texture{};
+        s.tex.w = w;
+        s.tex.h = h;
+        s.tex.page = page;
+        s.tex.x = x;
+        s.tex.y = y;
+        upload_(s.tex, pixels, stride_pixels);
+        ++m_pages[page]->live;
+        ++m_live;
+        return TextureHandle{si + 1u, s.generation};
+    }
+
+    bool TextureCache::update(TextureHandle t, const std::uint32_t* pixels, std::uint32_t stride_pixels) {
+        Slot* s = slot_(t);
+        if (!s || !pixels || stride_pixels < (std::uint32_t)s->tex.w) return false;
+        upload_(s->tex, pixels, stride_pixels);
+        return true;
+    }
+
+    void TextureCache::remove(TextureHandle t) noexcept {
+        Slot* s = slot_(t);
+        if (!s) return;
+
+        Page& pg = *m_pages[s->tex.page];
+        if (--pg.live == 0) {
+            if (pg.dedicated) {
+                m_pages[s->tex.page].reset();
+            } else {
+                // 빈 페이지는 처음부터 다시 채운다 (버퍼는 유지)
+                pg.shelves.clear();
+                pg.y_used = 0;
+            }
+        }
+
+        s->used = false;
+        s->tex = Texture{};
+        ++s->generation;
+        m_free.push_back(t.index - 1u);
+        --m_live;
+    }
+
+    const Texture* TextureCache::get(TextureHandle t) const noexcept {
+        if (t.index == 0 || (std::size_t)t.index > m_slots.size()) return nullptr;
+        const Slot& s = m_slots[t.index - 1u];
+        return (s.used && s.generation == t.generation) ? &s.tex : nullptr;
+    }
+
+    std::size_t TextureCache::page_count() const noexcept {
+        std::size_t n = 0;
+        for (const auto& p : m_pages) n += (p != nullptr);
+        return n;
+    }
+
+    void TextureCache::clear() noexcept {
+        for (Slot& s : m_slots) {
+            if (!s.used) continue;
+            s.used = false;
+            s.tex = Texture{};
+            ++s.generation;
+        }
+        m_free.clear();
+        for (std::size_t i = m_slots.size(); i-- > 0;) m_free.push_back((std::uint32_t)i);
+        m_pages.clear();
+        m_live = 0;
+    }
+
+    TextureCache::Slot* TextureCache::slot_(TextureHandle t) noexcept {
+        return get(t) ? &m_slots[t.index - 1u] : nullptr;
+    }
+
+    bool TextureCache::place_(std::int32_t w, std::int32_t h, std::uint32_t& page, std::int32_t& x, std::int32_t& y) {
+        // 큰 이미지: 전용 페이지 (해제된 자리 재사용)
+        if (w > m_max_packed || h > m_max_packed) {
+            auto pg = std::make_unique<Page>();
+            pg->w = w;
+            pg->h = h;
+            pg->dedicated = true;
+            pg->pixels.resize((std::size_t)w * (std::size_t)h);
+
+            auto it = std::find(m_pages.begin(), m_pages.end(), nullptr);
+            if (it == m_pages.end()) it = m_pages.insert(m_pages.end(), nullptr);
+            *it = std::move(pg);
+            page = (std::uint32_t)(it - m_pages.begin());
+            x = y = 0;
+            return true;
+        }
+
+        // shelf: 높이가 맞는(h 이상, 2배 미만) 선반 중 가장 낮은 것, 없으면 새 선반
+        for (std::size_t pi = 0; pi < m_pages.size(); ++pi) {
+            Page* pg = m_pages[pi].get();
+            if (!pg || pg->dedicated) continue;
+
+            Shelf* best = nullptr;
+            for (Shelf& s : pg->shelves) {
+                if (s.h < h || s.h >= 2 * h || pg->w - s.x < w) continue;
+                if (!best || s.h < best->h) best = &s;
+            }
+            if (!best && pg->h - pg->y_used >= h) {
+                pg->shelves.push_back(Shelf{pg->y_used, h, 0});
+                pg->y_used += h;
+                best = &pg->shelves.back();
+            }
+            if (!best) continue;
+
+            page = (std::uint32_t)pi;
+            x = best->x;
+            y = best->y;
+            best->x += w;
+            return true;
+        }
+
+        auto pg = std::make_unique<Page>();
+        pg->w = pg->h = m_page_size;
+        pg->pixels.resize((std::size_t)m_page_size * (std::size_t)m_page_size);
+        pg->shelves.push_back(Shelf{0, h, w});
+        pg->y_used = h;
+
+        auto it = std::find(m_pages.begin(), m_pages.end(), nullptr);
+        if (it == m_pages.end()) it = m_pages.insert(m_pages.end(), nullptr);
+        *it = std::move(pg);
+        page = (std::uint32_t)(it - m_pages.begin());
+        x = y = 0;
+        return true;
+    }
+
+    void TextureCache::upload_(Texture& t, const std::uint32_t* pixels, std::uint32_t stride) {
+        Page& pg = *m_pages[t.page];
+        const std::size_t ps = (std::size_t)pg.w;
+        const std::size_t w = (std::size_t)t.w;
+        std::uint32_t* dst = pg.pixels.data() + (std::size_t)t.y * ps + (std::size_t)t.x;
+
+        for (std::int32_t y = 0; y < t.h; ++y) {
+            std::memcpy(dst + (std::size_t)y * ps, pixels + (std::size_t)y * stride, w * sizeof(std::uint32_t));
+        }
+
+        t.pixels = dst;
+        t.stride = (std::uint32_t)ps;
+        t.alpha = classify_alpha(dst, t.w, t.h, t.stride);
+        t.revision = ++m_revision;
+
+        // 불투명이면 premultiplied 표현이 원본과 같다
+        if (t.alpha == TextureAlpha::Opaque) {
+            t.premul = dst;
+            return;
+        }
+
+        if (pg.premul.empty()) pg.premul.resize(pg.pixels.size());
+        std::uint32_t* pm = pg.premul.data() + (std::size_t)t.y * ps + (std::size_t)t.x;
+        for (std::int32_t y = 0; y < t.h; ++y) {
+            const std::uint32_t* row = dst + (std::size_t)y * ps;
+            std::uint32_t* out = pm + (std::size_t)y * ps;
+            for (std::size_t x = 0; x < w; ++x) out[x] = internal::premultiply(row[x]);
+        }
+        t.premul = pm;
+    }
+
+} // namespace framedot::gfx
@@ -0,0 +1,47 @@
+// tests/TestCanvas.hpp
+/**
+ * @file TestCanvas.hpp
+ * @brief 래스터 테스트 공용: 캔버스 크기/배경색, 픽셀 단위 비교, 결정적 난수
+ *
+ * 130x100은 64px 타일 경계를 가로/세로로 모두 넘는 크기다.
+ */
+#pragma once
+#include <framedot/gfx/Color.hpp>
+#include <framedot/gfx/PixelCanvas.hpp>
+
+#include <cstdint>
+#include <cstdio>
+
+namespace framedot::test {
+
+    inline constexpr int kW = 130, kH = 100;
+    inline constexpr gfx::ColorRGBA8 kBack{16, 32, 48, 255};
+
+    /// @brief 두 캔버스가 픽셀 단위로 같은지. 다르면 첫 위치를 출력한다
+    inline bool equal(const char* name, const gfx::PixelCanvas& a, const gfx::PixelCanvas& b) {
+        const auto pa = a.pixels();
+        const auto pb = b.pixels();
+        for (std::size_t i = 0; i < pa.size(); ++i) {
+            if (pa[i] != pb[i]) {
+                std::printf("%s: mismatch at (%zu,%zu)\n", name, i % (std::size_t)a.width(), i / (std::size_t)a.width());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief 결정적 LCG. rnd(lo, hi)는 [lo, hi] 정수
+    class Lcg {
+    public:
+        explicit Lcg(std::uint32_t seed) noexcept : m_state(seed) {}
+
+        int operator()(int lo, int hi) noexcept {
+            m_state = m_state * 1664525u + 1013904223u;
+            return lo + (int)((m_state >> 8) % (std::uint32_t)(hi - lo + 1));
+        }
+
+    private:
+        std::uint32_t m_state;
+    };
+
+} // namespace framedot::test
@@ -0,0 +1,241 @@
+// tests/test_affine_sprite.cpp
+// affine 스프라이트: 항등 변환은 blit_sprite와 같고, 정수 확대/회전/반전은 double 역변환 기준과 같으며,
+// bilinear 값, 병렬/DisplayList 재생 결과, 테이블 용량 초과 처리를 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/math/Types.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+#include <framedot_internal/gfx/RasterKernels.hpp>
+
+#include "TestCanvas.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace framedot;
+using test::kW;
+using test::kH;
+using test::kBack;
+using test::equal;
+
+namespace {
+
+    std::vector<std::uint32_t> make_sprite(int w, int h, bool translucent) {
+        std::vector<std::uint32_t> s((std::size_t)w * (std::size_t)h);
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                const std::uint32_t a = translucent ? (std::uint32_t)(60 + (x * 37 + y * 11) % 196) : 0xFFu;
+                s[(std::size_t)y * (std::size_t)w + (std::size_t)x] =
+                    (std::uint32_t)(x * 23 & 0xFF) << 24 | (std::uint32_t)(y * 41 & 0xFF) << 16 | 0x8000u | a;
+            }
+        }
+        return s;
+    }
+
+    math::Mat3f translate(float x, float y) {
+        return math::make_affine_2d(math::Vec2f{x, y}, 0.0f, math::Vec2f{1.0f, 1.0f});
+    }
+
+    /// @brief 항등(정수 이동) affine은 nearest/bilinear 모두 blit_sprite와 같다
+    bool check_identity(bool premul) {
+        const std::vector<std::uint32_t> spr = make_sprite(11, 9, true);
+        const gfx::ColorRGBA8 tints[] = {gfx::ColorRGBA8{255, 255, 255, 255}, gfx::ColorRGBA8{200, 100, 255, 180}};
+
+        for (const gfx::ColorRGBA8 tint : tints) {
+            for (const gfx::SampleFilter f : {gfx::SampleFilter::Nearest, gfx::SampleFilter::Bilinear}) {
+                gfx::RenderQueue a, b;
+                a.begin_frame();
+                b.begin_frame();
+                a.clear(kBack);
+                b.clear(kBack);
+                a.blit_sprite(27, -3, spr.data(), 11, 9, 11, tint);
+                if (!b.blit_sprite_affine(translate(27.0f, -3.0f), spr.data(), 11, 9, 11, tint, f)) return false;
+
+                gfx::PixelCanvas ca(kW, kH), cb(kW, kH);
+                if (premul) {
+                    ca.set_format(gfx::PixelFormat::RGBA8888Premul);
+                    cb.set_format(gfx::PixelFormat::RGBA8888Premul);
+                }
+                gfx::SoftwareRenderer r;
+                r.execute(a, ca);
+                r.execute(b, cb);
+                if (!equal("identity", ca, cb)) return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief double 역변환 기준: 픽셀 중심의 텍셀 좌표가 경계에서 충분히 떨어진 픽셀만 비교
+     *        (안쪽이면 그 텍셀, 바깥이면 배경). 불투명 무tint 스프라이트 + 불투명 배경
+     */
+    bool match_reference(const char* name, const gfx::PixelCanvas& c, const math::Mat3f& m,
+                         const std::vector<std::uint32_t>& spr, int w, int h) {
+        const double a = m.m[0], b = m.m[1], tx = m.m[2];
+        const double cc = m.m[3], d = m.m[4], ty = m.m[5];
+        const double det = a * d - b * cc;
+        const double ia = d / det, ib = -b / det, ic = -cc / det, id = a / det;
+        constexpr double kEps = 1e-3;
+
+        int compared = 0;
+        const auto px = c.pixels();
+        for (int y = 0; y < kH; ++y) {
+            for (int x = 0; x < kW; ++x) {
+                const double u = ia * (x + 0.5 - tx) + ib * (y + 0.5 - ty);
+                const double v = ic * (x + 0.5 - tx) + id * (y + 0.5 - ty);
+                const double fu = u - std::floor(u), fv = v - std::floor(v);
+                if (fu < kEps || fu > 1.0 - kEps || fv < kEps || fv > 1.0 - kEps) continue;
+
+                const bool inside = (u > 0.0 && u < w && v > 0.0 && v < h);
+                const std::uint32_t want = inside ? spr[(std::size_t)std::floor(v) * (std::size_t)w + (std::size_t)std::floor(u)] : gfx::internal::pack_rgba(kBack);
+                const std::uint32_t got = px[(std::size_t)y * kW + (std::size_t)x];
+                if (got != want) {
+                    std::printf("%s: (%d,%d) got %08X want %08X\n", name, x, y, got, want);
+                    return false;
+                }
+                ++compared;
+            }
+        }
+        return compared > kW * kH / 2;
+    }
+
+    bool check_transforms(core::JobSystem* js) {
+        constexpr int w = 10, h = 8;
+        const std::vector<std::uint32_t> spr = make_sprite(w, h, false);
+
+        struct Case { const char* name; math::Mat3f m; };
+        const Case cases[] = {
+            {"upscale", math::make_affine_2d(math::Vec2f{20.0f, 10.0f}, 0.0f, math::Vec2f{3.0f, 2.0f})},   // 정수 확대 경로
+            {"upscale_frac", math::make_affine_2d(math::Vec2f{20.25f, 10.25f}, 0.0f, math::Vec2f{3.0f, 2.0f})},
+            {"downscale", math::make_affine_2d(math::Vec2f{5.0f, 60.0f}, 0.0f, math::Vec2f{0.8f, 0.6f})},
+            {"rot90", math::make_affine_2d(math::Vec2f{70.0f, 5.0f}, 1.57079632679f, math::Vec2f{2.0f, 2.0f})},
+            {"rotate", math::make_affine_2d(math::Vec2f{60.0f, 40.0f}, 0.7f, math::Vec2f{2.5f, 1.5f})},
+            {"flip", math::make_affine_2d(math::Vec2f{120.0f, 90.0f}, -2.2f, math::Vec2f{-4.0f, 3.0f})},
+        };
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        for (const Case& cs : cases) {
+            gfx::RenderQueue q;
+            q.begin_frame();
+            q.clear(kBack);
+            if (!q.blit_sprite_affine(cs.m, spr.data(), w, h, w, gfx::ColorRGBA8{255, 255, 255, 255})) return false;
+
+            gfx::PixelCanvas c(kW, kH);
+            gfx::SoftwareRenderer r;
+            r.execute(ctx, q, c);
+            if (!match_reference(cs.name, c, cs.m, spr, w, h)) return false;
+        }
+        return true;
+    }
+
+    /// @brief 가로 4배 bilinear: 텍셀 중심 사이 선형 보간, 가장자리 clamp (8비트 가중치 양자화 ±1)
+    bool check_bilinear() {
+        const std::uint32_t spr[3] = {0x000000FFu, 0xFFFFFFFFu, 0x800040FFu};
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        q.blit_sprite_affine(math::make_affine_2d(math::Vec2f{0.0f, 0.0f}, 0.0f, math::Vec2f{4.0f, 1.0f}),
+                             spr, 3, 1, 3, gfx::ColorRGBA8{255, 255, 255, 255}, gfx::SampleFilter::Bilinear);
+        gfx::PixelCanvas c(kW, kH);
+        gfx::SoftwareRenderer r;
+        r.execute(q, c);
+
+        for (int x = 0; x < 12; ++x) {
+            const double fu = (x + 0.5) / 4.0 - 0.5;
+            const int i = (int)std::floor(fu);
+            const double f = fu - i;
+            const std::uint32_t p0 = spr[std::clamp(i, 0, 2)], p1 = spr[std::clamp(i + 1, 0, 2)];
+            const std::uint32_t got = c.pixels()[(std::size_t)x];
+            for (int sh = 0; sh < 32; sh += 8) {
+                const double want = (1.0 - f) * ((p0 >> sh) & 0xFFu) + f * ((p1 >> sh) & 0xFFu);
+                if (std::fabs((double)((got >> sh) & 0xFFu) - want) > 1.0) {
+                    std::printf("bilinear: x=%d got %08X\n", x, got);
+                    return false;
+                }
+            }
+        }
+        return c.pixels()[kW] == 0x000000FFu;   // 아래 행은 그대로
+    }
+
+    /// @brief 여러 타일에 걸친 장면: 직렬 == 병렬, DisplayList 재생(오프셋 + clip) == 직접 기록
+    template <class R>
+    void scene(R& r, const std::vector<std::uint32_t>& spr, float dx, float dy) {
+        r.blit_sprite_affine(math::make_affine_2d(math::Vec2f{dx + 30.0f, dy + 20.0f}, 0.4f, math::Vec2f{3.0f, 2.0f}),
+                             spr.data(), 10, 8, 10, gfx::ColorRGBA8{255, 255, 255, 255}, gfx::SampleFilter::Bilinear, 1);
+        r.blit_sprite_affine(math::make_affine_2d(math::Vec2f{dx + 90.0f, dy + 10.0f}, -1.1f, math::Vec2f{-2.0f, 4.0f}),
+                             spr.data(), 10, 8, 10, gfx::ColorRGBA8{255, 120, 60, 200}, gfx::SampleFilter::Nearest, 0);
+        gfx::ClipScope clip(r, gfx::RectI{(int)dx + 0, (int)dy + 50, (int)dx + 60, (int)dy + 90});
+        r.blit_sprite_affine(math::make_affine_2d(math::Vec2f{dx + 10.0f, dy + 45.0f}, 0.0f, math::Vec2f{5.0f, 5.0f}),
+                             spr.data(), 10, 8, 10, gfx::ColorRGBA8{255, 255, 255, 255}, gfx::SampleFilter::Nearest, 2);
+    }
+
+    bool check_scene(core::JobSystem* js, bool premul) {
+        const std::vector<std::uint32_t> spr = make_sprite(10, 8, true);
+
+        gfx::DisplayList list;
+        scene(list, spr, 0.0f, 0.0f);
+
+        gfx::RenderQueue direct, replay;
+        direct.begin_frame();
+        replay.begin_frame();
+        direct.clear(kBack);
+        replay.clear(kBack);
+        scene(direct, spr, 7.0f, -5.0f);
+        replay.draw_list(list, 7, -5);
+
+        gfx::PixelCanvas serial(kW, kH), parallel(kW, kH), listed(kW, kH);
+        if (premul) {
+            serial.set_format(gfx::PixelFormat::RGBA8888Premul);
+            parallel.set_format(gfx::PixelFormat::RGBA8888Premul);
+            listed.set_format(gfx::PixelFormat::RGBA8888Premul);
+        }
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::SoftwareRenderer r;
+        r.execute(direct, serial);
+        r.execute(ctx, direct, parallel);
+        r.execute(ctx, replay, listed);
+        return equal("parallel", serial, parallel) && equal("list", serial, listed);
+    }
+
+    bool check_capacity() {
+        const std::vector<std::uint32_t> spr = make_sprite(4, 4, false);
+        gfx::RenderQueueConfig cfg{};
+        cfg.affine_sprites = 1;
+        gfx::RenderQueue q(cfg);
+        q.begin_frame();
+
+        const math::Mat3f m = math::make_affine_2d(math::Vec2f{1.0f, 1.0f}, 0.3f, math::Vec2f{2.0f, 2.0f});
+        if (!q.blit_sprite_affine(m, spr.data(), 4, 4, 4, gfx::ColorRGBA8{255, 255, 255, 255})) return false;
+        if (q.blit_sprite_affine(m, spr.data(), 4, 4, 4, gfx::ColorRGBA8{255, 255, 255, 255})) return false;
+        if (q.dropped() != 1 || q.size() != 1) return false;
+
+        // 면적 0인 변환은 기록하지 않는다
+        const math::Mat3f flat = math::make_affine_2d(math::Vec2f{1.0f, 1.0f}, 0.0f, math::Vec2f{0.0f, 2.0f});
+        if (q.blit_sprite_affine(flat, spr.data(), 4, 4, 4, gfx::ColorRGBA8{255, 255, 255, 255})) return false;
+
+        q.begin_frame();
+        return q.blit_sprite_affine(m, spr.data(), 4, 4, 4, gfx::ColorRGBA8{255, 255, 255, 255});
+    }
+
+} // namespace
+
+int main() {
+    if (!check_identity(false) || !check_identity(true)) return 1;
+    if (!check_transforms(nullptr)) return 1;
+    if (!check_bilinear()) return 1;
+    if (!check_scene(nullptr, false) || !check_scene(nullptr, true)) return 1;
+    if (!check_capacity()) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_transforms(js) && check_scene(js, false);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
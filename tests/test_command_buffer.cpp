@@ -0,0 +1,217 @@
+// tests/test_command_buffer.cpp
+// CommandBuffer/World 지연 커맨드: 재생 순서(자기 기록 -> fork 하위 0..n-1 -> 시스템 등록 순),
+// Pending resolve/EmplacePending, 이미 무효인(또는 재사용된) entity 대상 커맨드, reset()/move 대입의 페이로드 소멸자,
+// 더 큰 fork 뒤에도 기록이 보존되는지 확인한다.
+#include <framedot/ecs/CommandBuffer.hpp>
+#include <framedot/ecs/World.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace framedot;
+using ecs::CommandBuffer;
+
+namespace {
+
+    struct Mark {
+        int id{0};
+    };
+
+    struct Counted {
+        std::shared_ptr<int> ref;
+    };
+
+    /// @brief 새 registry에서는 entity 인덱스가 생성 순서 -> Mark를 생성 순으로 나열
+    std::vector<int> marks_in_creation_order(ecs::World::Registry& reg) {
+        std::vector<std::pair<std::uint32_t, int>> all;
+        for (auto [e, m] : reg.storage<Mark>().each()) all.emplace_back(entt::to_entity(e), m.id);
+        std::sort(all.begin(), all.end());
+
+        std::vector<int> out;
+        for (const auto& p : all) out.push_back(p.second);
+        return out;
+    }
+
+    bool expect(const std::vector<int>& got, const std::vector<int>& want, const char* name) {
+        if (got == want) return true;
+        std::printf("%s: order", name);
+        for (int v : got) std::printf(" %d", v);
+        std::printf("\n");
+        return false;
+    }
+
+    /// @brief 자기 기록 -> 하위 0..n-1, Pending resolve, EmplacePending
+    bool check_order_and_pending() {
+        ecs::World::Registry reg;
+        CommandBuffer cb;
+
+        const auto a = cb.create();
+        auto kids = cb.fork(3);
+        // 하위 버퍼에 역순으로 기록해도 재생은 인덱스 순
+        for (int i = 2; i >= 0; --i) {
+            const auto p = kids[(std::size_t)i].create();
+            kids[(std::size_t)i].emplace(p, Mark{10 + i});
+        }
+        cb.emplace(a, Mark{1});
+        const auto b = cb.create();
+        cb.emplace(b, Mark{2});
+        cb.emplace(CommandBuffer::Pending{99}, Mark{-1});   // 만든 적 없는 Pending은 무시
+
+        if (cb.size() != 11 || cb.resolve(a) != entt::null) return false;   // 재생 전에는 null
+
+        cb.playback(reg);
+        if (!expect(marks_in_creation_order(reg), {1, 2, 10, 11, 12}, "order")) return false;
+
+        const entt::entity ea = cb.resolve(a), eb = cb.resolve(b);
+        if (!reg.valid(ea) || !reg.valid(eb) || reg.get<Mark>(ea).id != 1 || reg.get<Mark>(eb).id != 2) return false;
+        if (cb.resolve(CommandBuffer::Pending{99}) != entt::null) return false;
+
+        cb.reset();
+        return cb.empty() && cb.resolve(a) == entt::null;
+    }
+
+    /// @brief 이미 파괴된 entity 대상 destroy/emplace/remove는 무시되고, 같은 슬롯을 재사용한 entity는 건드리지 않는다
+    bool check_invalid_targets() {
+        ecs::World::Registry reg;
+        const entt::entity dead = reg.create();
+        reg.destroy(dead);
+        const entt::entity reused = reg.create();   // 같은 인덱스, 다른 버전일 수 있다
+        reg.emplace<Mark>(reused, Mark{7});
+
+        CommandBuffer cb;
+        cb.destroy(dead);
+        cb.emplace(dead, Mark{8});
+        cb.remove<Mark>(dead);
+        cb.destroy(entt::null);
+
+        const entt::entity live = reg.create();
+        cb.destroy(live);
+        cb.destroy(live);   // 두 번째는 재생 시점에 이미 무효
+        cb.emplace(live, Mark{9});
+
+        cb.playback(reg);
+        return reg.valid(reused) && reg.get<Mark>(reused).id == 7 && !reg.valid(live);
+    }
+
+    /// @brief reset()/소멸자가 재생하지 않은 페이로드의 소멸자를 부른다 (하위 버퍼 포함)
+    bool check_payload_destructors() {
+        auto token = std::make_shared<int>(0);
+        ecs::World::Registry reg;
+        const entt::entity e = reg.create();
+        {
+            CommandBuffer cb;
+            cb.emplace(e, Counted{token});
+            cb.emplace(cb.create(), Counted{token});
+            auto kids = cb.fork(2);
+            kids[1].emplace(e, Counted{token});
+            if (token.use_count() != 4) return false;
+
+            cb.reset();
+            if (token.use_count() != 1) {
+                std::printf("reset: use_count %ld\n", token.use_count());
+                return false;
+            }
+
+            // 재생한 페이로드는 registry로 옮겨지고, 남은 껍데기는 reset에서 정리된다
+            cb.emplace(e, Counted{token});
+            cb.playback(reg);
+            cb.reset();
+            if (token.use_count() != 2) return false;
+
+            cb.emplace(e, Counted{token});   // 소멸자에서 정리
+        }
+        reg.remove<Counted>(e);
+        if (token.use_count() != 1) return false;
+
+        // move 대입: 대상의 재생하지 않은 페이로드(하위 버퍼 포함)는 소멸되고, 원본 기록은 옮겨져 재생된다
+        {
+            CommandBuffer dst, src;
+            dst.emplace(e, Counted{token});
+            dst.fork(1)[0].emplace(e, Counted{token});
+            src.emplace(e, Counted{token});
+            if (token.use_count() != 4) return false;
+
+            dst = std::move(src);
+            if (token.use_count() != 2 || dst.size() != 1 || !src.empty()) {
+                std::printf("move assign: use_count %ld\n", token.use_count());
+                return false;
+            }
+
+            src.emplace(e, Counted{token});   // move된 버퍼도 다시 쓸 수 있다
+            dst.playback(reg);
+            if (!reg.all_of<Counted>(e) || token.use_count() != 3) return false;
+        }
+        reg.remove<Counted>(e);
+        return token.use_count() == 1;
+    }
+
+    /// @brief 더 큰 fork는 span을 바꾸지만 이미 기록된 하위 버퍼 내용은 옮겨진다
+    bool check_fork_growth() {
+        ecs::World::Registry reg;
+        CommandBuffer cb;
+
+        auto first = cb.fork(1);
+        first[0].emplace(first[0].create(), Mark{20});
+
+        auto second = cb.fork(4);   // first는 이제 무효
+        if (second.size() != 4 || cb.size() != 2) return false;
+        second[3].emplace(second[3].create(), Mark{23});
+        second[0].emplace(second[0].create(), Mark{21});
+
+        cb.playback(reg);
+        if (!expect(marks_in_creation_order(reg), {20, 21, 23}, "fork growth")) return false;
+
+        // 다음 프레임: 하위 버퍼를 재사용하고 이전 기록은 남지 않는다
+        cb.reset();
+        auto again = cb.fork(2);
+        return again.data() == second.data() && cb.empty();
+    }
+
+    /// @brief World: 같은 Phase의 커맨드는 시스템 등록 순서로 재생된다 (병렬 실행과 무관)
+    bool check_world_order(core::JobSystem* js) {
+        ecs::World world;
+        for (int s = 0; s < 4; ++s) {
+            world.add_read_system(ecs::Phase::Update,
+                [s](const core::FrameContext&, const ecs::World::Registry&, CommandBuffer& cmds) {
+                    auto kids = cmds.fork(2);
+                    kids[1].emplace(kids[1].create(), Mark{s * 100 + 2});
+                    kids[0].emplace(kids[0].create(), Mark{s * 100 + 1});
+                    cmds.emplace(cmds.create(), Mark{s * 100});
+                });
+        }
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        for (int frame = 0; frame < 2; ++frame) {
+            world.tick(ctx);
+            std::vector<int> want;
+            for (int f = 0; f <= frame; ++f) {
+                for (int s = 0; s < 4; ++s) {
+                    want.push_back(s * 100);
+                    want.push_back(s * 100 + 1);
+                    want.push_back(s * 100 + 2);
+                }
+            }
+            if (!expect(marks_in_creation_order(world.registry()), want, "world")) return false;
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_order_and_pending() || !check_invalid_targets() || !check_payload_destructors() || !check_fork_growth()) {
+        return 1;
+    }
+    if (!check_world_order(nullptr)) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_world_order(js);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,182 @@
+// tests/test_dirty_tiles.cpp
+// 타일 dirty 추적: 여러 프레임 동안 추적 on/off 결과가 같은지, 바뀐 픽셀이 모두 damage 안에 있는지,
+// 변하지 않은 타일은 건너뛰는지, damage를 모르는 Surface는 전체 present로 대체되는지 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/rhi/Surface.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    constexpr int kW = 200, kH = 120;   // 7 x 4 타일 (마지막 열/행은 잘림)
+
+    struct World {
+        std::vector<std::uint32_t> sprite;
+        gfx::DisplayList hud;
+    };
+
+    /// @brief frame마다 일부만 바뀌는 장면
+    void record(gfx::RenderQueue& q, World& w, int frame) {
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{12, 24, 36, 255});
+        q.blend_rect(10, 10, 50, 40, gfx::ColorRGBA8{200, 200, 0, 100});
+
+        // 움직이는 스프라이트 (2프레임마다)
+        const int sx = 40 + (frame / 2) * 7;
+        q.blit_sprite(sx, 70, w.sprite.data(), 6, 6, 6, gfx::ColorRGBA8{255, 255, 255, 255}, gfx::make_sort_key(1, 0));
+
+        // 같은 포인터의 arena 인스턴스: 프레임 3부터 같은 타일 안에서 움직인다
+        const std::span<gfx::Instance> inst = q.alloc_instances(3);
+        for (int i = 0; i < 3; ++i) inst[(std::size_t)i] = gfx::Instance{150 + i * 9, 5 + (frame >= 3 ? 3 : 0)};
+        q.fill_rect_instanced(inst, 5, 5, gfx::ColorRGBA8{0, 255, 128, 200}, false, gfx::make_sort_key(1, 0));
+
+        // 같은 길이의 텍스트, 내용만 바뀐다 (debug 글꼴은 공백만 구분된다)
+        q.text(100, 100, frame >= 4 ? "A B" : "AB ", gfx::ColorRGBA8{255, 255, 255, 255}, gfx::make_sort_key(2, 0));
+
+        // clip 사각형만 바뀐다
+        {
+            gfx::ClipScope clip(q, gfx::RectI{0, 0, frame >= 5 ? 120 : 100, 60});
+            q.fill_rect(90, 40, 60, 10, gfx::ColorRGBA8{255, 0, 0, 255}, gfx::make_sort_key(2, 0));
+        }
+
+        // 리스트 내용 변경 (revision)
+        if (frame == 6) {
+            w.hud.reset();
+            w.hud.fill_rect(0, 0, 20, 8, gfx::ColorRGBA8{0, 0, 255, 255});
+        }
+        q.draw_list(w.hud, 170, 100, gfx::make_sort_key(3, 0));
+    }
+
+    bool inside(std::span<const gfx::RectI> rects, int x, int y) {
+        for (const gfx::RectI& r : rects) if (r.contains(x, y)) return true;
+        return false;
+    }
+
+    bool check(core::JobSystem* js, bool premul) {
+        World w;
+        w.sprite.resize(36);
+        for (std::size_t i = 0; i < w.sprite.size(); ++i) w.sprite[i] = 0xFF000000u | (std::uint32_t)(i * 7u) << 8 | 0xC0u;
+        w.hud.fill_rect(0, 0, 20, 8, gfx::ColorRGBA8{255, 0, 255, 255});
+
+        gfx::RenderQueue q;
+        gfx::PixelCanvas tracked(kW, kH), full(kW, kH);
+        if (premul) {
+            tracked.set_format(gfx::PixelFormat::RGBA8888Premul);
+            full.set_format(gfx::PixelFormat::RGBA8888Premul);
+        }
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::SoftwareRenderer rt, rf;
+        rt.set_tile_size(gfx::SoftwareRenderer::kTile);   // 타일 수 기대값은 32px 격자 기준
+        rf.set_tile_size(gfx::SoftwareRenderer::kTile);
+        rt.set_dirty_tracking(true);
+
+        std::vector<std::uint32_t> prev(tracked.pixels().begin(), tracked.pixels().end());
+        std::uint32_t clean_total = 0;
+
+        for (int frame = 0; frame < 9; ++frame) {
+            record(q, w, frame);
+            if (frame == 8) rt.invalidate_tiles();
+            rt.execute(ctx, q, tracked);
+            rf.execute(ctx, q, full);
+
+            const auto pt = tracked.pixels();
+            const auto pf = full.pixels();
+            for (int y = 0; y < kH; ++y) {
+                for (int x = 0; x < kW; ++x) {
+                    const std::size_t i = (std::size_t)y * kW + (std::size_t)x;
+                    if (pt[i] != pf[i]) {
+                        std::printf("dirty: frame %d mismatch at (%d,%d)\n", frame, x, y);
+                        return false;
+                    }
+                    if (pt[i] != prev[i] && !inside(rt.damage(), x, y)) {
+                        std::printf("dirty: frame %d change outside damage at (%d,%d)\n", frame, x, y);
+                        return false;
+                    }
+                }
+            }
+            prev.assign(pt.begin(), pt.end());
+
+            const auto& st = rt.stats();
+            if (st.dirty_tiles + st.clean_tiles != st.tiles) return false;
+            if ((frame == 0 || frame == 8) && st.clean_tiles != 0) return false;
+            if (frame == 1 && st.dirty_tiles != 0) return false;   // 프레임 0과 같은 장면
+            clean_total += st.clean_tiles;
+
+            // damage 사각형은 겹치지 않고 실행 타일 넓이와 같다
+            std::int64_t area = 0;
+            for (const gfx::RectI& r : rt.damage()) area += (std::int64_t)r.width() * r.height();
+            std::int64_t dirty_area = 0;
+            for (int y = 0; y < kH; ++y) {
+                for (int x = 0; x < kW; ++x) dirty_area += inside(rt.damage(), x, y);
+            }
+            if (area != dirty_area) return false;
+
+            // 추적하지 않으면 커맨드가 있는 타일 전부
+            if (rf.stats().dirty_tiles != rf.stats().tiles || rf.damage().size() != 1) return false;
+        }
+        return clean_total > 7 * 4 * 3;
+    }
+
+    /// @brief 캔버스가 바뀌면 (주소/포맷) 전체를 다시 그린다
+    bool check_canvas_change() {
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{1, 2, 3, 255});
+
+        gfx::SoftwareRenderer r;
+        r.set_tile_size(gfx::SoftwareRenderer::kTile);
+        r.set_dirty_tracking(true);
+        gfx::PixelCanvas a(64, 64), b(64, 64);
+        r.execute(q, a);
+        r.execute(q, a);
+        if (r.stats().clean_tiles != 4) return false;
+        r.execute(q, b);
+        if (r.stats().dirty_tiles != 4 || b.pixels()[0] != 0x010203FFu) return false;
+        b.set_format(gfx::PixelFormat::RGBA8888Premul);
+        r.execute(q, b);
+        return r.stats().dirty_tiles == 4;
+    }
+
+    /// @brief 한 인자 present만 구현한 어댑터
+    class FullSurface final : public rhi::Surface {
+    public:
+        using rhi::Surface::present;
+        void present(const gfx::PixelFrame& f) override { ++calls; w = f.width; }
+
+        int calls{0};
+        std::uint32_t w{0};
+    };
+
+    bool check_surface_fallback() {
+        gfx::PixelCanvas c(40, 30);
+        FullSurface fs;
+        rhi::Surface& s = fs;
+        const gfx::RectI damage[] = {gfx::RectI{0, 0, 8, 8}};
+        s.present(c.frame(), damage);
+        return fs.calls == 1 && fs.w == 40;
+    }
+
+} // namespace
+
+int main() {
+    if (!check(nullptr, false) || !check(nullptr, true)) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check(js, false);
+    core::internal::destroy_default_jobsystem(js);
+    if (!ok) return 1;
+
+    if (!check_canvas_change()) return 1;
+    if (!check_surface_fallback()) return 1;
+    return 0;
+}
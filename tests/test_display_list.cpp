@@ -0,0 +1,256 @@
+// tests/test_display_list.cpp
+// DisplayList 재생(오프셋/clip/리스트 내부 clip/sort_key 위치)이 같은 커맨드를 RenderQueue에 직접 넣은 결과와 같은지,
+// revision이 바뀌면 캐시가 다시 만들어지는지 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    constexpr int kW = 150, kH = 90;
+
+    struct Scene {
+        std::vector<std::uint32_t> sprite;
+        std::vector<gfx::Instance> inst;
+    };
+
+    /**
+     * @brief HUD 내용. pass < 0이면 리스트 기록(자체 sort_key),
+     *        pass >= 0이면 sort_key == pass인 커맨드만 (dx,dy)만큼 옮겨 base key로 (리스트 내부 정렬 순서 재현)
+     */
+    template <class R>
+    void hud(R& r, const Scene& sc, std::span<const gfx::Instance> inst, int dx, int dy, int pass, std::uint32_t base) {
+        auto on = [&](std::uint32_t k) { return pass < 0 || (std::uint32_t)pass == k; };
+        auto key = [&](std::uint32_t k) { return pass < 0 ? k : base; };
+
+        // key 1이 key 0보다 먼저 기록되지만 나중에 그려진다
+        if (on(1)) r.blend_rect(dx + 5, dy + 3, 40, 20, gfx::ColorRGBA8{200, 10, 10, 140}, key(1));
+        if (on(0)) r.fill_rect(dx + 0, dy + 0, 50, 30, gfx::ColorRGBA8{20, 20, 60, 255}, key(0));
+        if (on(0)) r.rect_outline(dx - 3, dy + 20, 70, 25, 2, gfx::ColorRGBA8{0, 200, 0, 255}, key(0));
+        if (on(0)) r.line(dx + 2, dy + 40, dx + 61, dy + 5, gfx::ColorRGBA8{255, 255, 0, 200}, key(0));
+        if (on(0)) r.hline(dx + 60, dx + 10, dy + 33, gfx::ColorRGBA8{0, 255, 255, 255}, key(0));
+        if (on(0)) r.vline(dx + 45, dy + 50, dy - 4, gfx::ColorRGBA8{255, 0, 255, 255}, key(0));
+        if (on(1)) r.fill_circle(dx + 30, dy + 30, 9, gfx::ColorRGBA8{90, 90, 255, 180}, key(1));
+        if (on(0)) r.circle(dx + 70, dy + 10, 12, gfx::ColorRGBA8{255, 128, 0, 255}, key(0));
+        if (on(0)) r.put_pixel(dx + 1, dy + 1, gfx::ColorRGBA8{255, 255, 255, 255}, key(0));
+        if (on(0)) r.text(dx + 4, dy + 45, "HP 100\nMP 42", gfx::ColorRGBA8{240, 240, 240, 255}, key(0), 2);
+        if (on(1)) r.blit_sprite(dx + 55, dy + 35, sc.sprite.data(), 8, 6, 8, gfx::ColorRGBA8{255, 255, 255, 255}, key(1));
+        if (on(1)) r.blit_sprite(dx + 20, dy + 50, sc.sprite.data(), 8, 6, 8, gfx::ColorRGBA8{255, 120, 60, 200}, key(1));
+        if (on(0)) r.fill_rect_instanced(inst, 3, 3, gfx::ColorRGBA8{}, true, key(0));
+    }
+
+    std::vector<gfx::Instance> shifted(const std::vector<gfx::Instance>& v, int dx, int dy) {
+        std::vector<gfx::Instance> out = v;
+        for (auto& e : out) { e.x += dx; e.y += dy; }
+        return out;
+    }
+
+    struct Draw {
+        int dx, dy;
+        bool clip;
+    };
+
+    constexpr int kClipX0 = 17, kClipY0 = 11, kClipX1 = 97, kClipY1 = 61;
+
+    void background(gfx::RenderQueue& q) {
+        q.clear(gfx::ColorRGBA8{10, 30, 20, 255});
+        q.blend_rect(30, 10, 80, 60, gfx::ColorRGBA8{128, 128, 0, 100}, gfx::make_sort_key(0, 0));
+    }
+
+    void foreground(gfx::RenderQueue& q) {
+        // 불투명: clip 밖/안 합성과 무관
+        q.fill_rect(100, 40, 30, 30, gfx::ColorRGBA8{1, 2, 3, 255}, gfx::make_sort_key(9, 0));
+    }
+
+    bool render_equal(const char* name, const gfx::PixelCanvas& a, const gfx::PixelCanvas& b) {
+        const auto pa = a.pixels();
+        const auto pb = b.pixels();
+        for (std::size_t i = 0; i < pa.size(); ++i) {
+            if (pa[i] != pb[i]) {
+                std::printf("%s: mismatch at (%zu,%zu)\n", name, i % kW, i / kW);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool check_replay(core::JobSystem* js, bool premul) {
+        Scene sc;
+        sc.sprite.resize(8 * 6);
+        for (std::size_t i = 0; i < sc.sprite.size(); ++i) {
+            const std::uint32_t a = (i % 5 == 0) ? 0u : (i % 3 == 0) ? 255u : (std::uint32_t)(40 + i * 3);
+            sc.sprite[i] = (std::uint32_t)(i * 29u) << 24 | (std::uint32_t)(200 - i) << 16 | 0x7700u | a;
+        }
+        for (int i = 0; i < 40; ++i) {
+            sc.inst.push_back(gfx::Instance{(i * 7) % 64, (i * 11) % 40,
+                                            gfx::ColorRGBA8{(std::uint8_t)(i * 6), 100, (std::uint8_t)(250 - i * 5), 200}});
+        }
+
+        gfx::DisplayList list;
+        hud(list, sc, sc.inst, 0, 0, -1, 0);
+        if (list.size() != 13) return false;
+
+        const std::uint32_t base = gfx::make_sort_key(5, 0);
+        const Draw draws[] = {
+            {0, 0, false}, {13, -7, false}, {-40, 25, true}, {90, 50, false}, {1000, 1000, false}, {37, 21, true},
+        };
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::SoftwareRenderer rl;   // 프레임 간 재사용 (리스트 캐시)
+
+        for (int frame = 0; frame < 2; ++frame) {
+            for (const Draw& d : draws) {
+                gfx::RenderQueue ql, qr, qs;
+                for (gfx::RenderQueue* q : {&ql, &qr, &qs}) {
+                    q->begin_frame();
+                    background(*q);
+                    foreground(*q);
+                }
+
+                if (d.clip) ql.draw_list_clipped(list, d.dx, d.dy, gfx::RectI{kClipX0, kClipY0, kClipX1, kClipY1}, base);
+                else        ql.draw_list(list, d.dx, d.dy, base);
+
+                const std::vector<gfx::Instance> moved = shifted(sc.inst, d.dx, d.dy);
+                hud(qr, sc, moved, d.dx, d.dy, 0, base);
+                hud(qr, sc, moved, d.dx, d.dy, 1, base);
+
+                gfx::PixelCanvas cl(kW, kH), cr(kW, kH), cs(kW, kH);
+                if (premul) {
+                    cl.set_format(gfx::PixelFormat::RGBA8888Premul);
+                    cr.set_format(gfx::PixelFormat::RGBA8888Premul);
+                    cs.set_format(gfx::PixelFormat::RGBA8888Premul);
+                }
+
+                gfx::SoftwareRenderer rr, rs;
+                rl.execute(ctx, ql, cl);
+                rr.execute(qr, cr);
+                rs.execute(qs, cs);
+
+                // clip: 안쪽은 리스트를 그린 결과, 바깥은 리스트 없는 결과
+                if (d.clip) {
+                    auto px = cr.pixels();
+                    const auto ps = cs.pixels();
+                    for (int y = 0; y < kH; ++y) {
+                        for (int x = 0; x < kW; ++x) {
+                            const bool in = x >= kClipX0 && x < kClipX1 && y >= kClipY0 && y < kClipY1;
+                            if (!in) px[(std::size_t)y * kW + (std::size_t)x] = ps[(std::size_t)y * kW + (std::size_t)x];
+                        }
+                    }
+                }
+
+                if (!render_equal("replay", cl, cr)) {
+                    std::printf("  offset=(%d,%d) clip=%d premul=%d\n", d.dx, d.dy, (int)d.clip, (int)premul);
+                    return false;
+                }
+            }
+        }
+        return rl.list_cache_size() == 1;
+    }
+
+    /// @brief 리스트 내용 변경(revision) 반영, 같은 리스트 여러 번 제출, 무한 영역(Clear) + 큰 좌표 범위
+    bool check_revision_and_extent() {
+        gfx::DisplayList list;
+        list.fill_rect(0, 0, 10, 10, gfx::ColorRGBA8{255, 0, 0, 255});
+
+        gfx::SoftwareRenderer r;
+        gfx::PixelCanvas c(kW, kH);
+        gfx::RenderQueue q;
+
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        q.draw_list(list, 5, 5);
+        q.draw_list(list, 100, 60);
+        r.execute(q, c);
+        if (c.pixels()[5 * kW + 5] != 0xFF0000FFu || c.pixels()[65 * kW + 105] != 0xFF0000FFu) return false;
+
+        const std::uint64_t rev = list.revision();
+        list.reset();
+        list.fill_rect(0, 0, 10, 10, gfx::ColorRGBA8{0, 255, 0, 255});
+        if (list.revision() == rev) return false;
+
+        r.execute(q, c);
+        if (c.pixels()[5 * kW + 5] != 0x00FF00FFu) return false;
+
+        // Clear는 clip 안만, 먼 좌표의 커맨드 때문에 격자 타일이 커져도 결과는 같아야 한다
+        gfx::DisplayList wide;
+        wide.clear(gfx::ColorRGBA8{0, 0, 255, 255});
+        wide.put_pixel(0, 100000, gfx::ColorRGBA8{255, 255, 255, 255});
+        wide.put_pixel(100000, 0, gfx::ColorRGBA8{255, 255, 255, 255});
+        wide.fill_rect(3, 3, 4, 4, gfx::ColorRGBA8{255, 255, 0, 255});
+
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        q.draw_list_clipped(wide, 50, 40, gfx::RectI{40, 30, 80, 60});
+        r.execute(q, c);
+
+        for (int y = 0; y < kH; ++y) {
+            for (int x = 0; x < kW; ++x) {
+                std::uint32_t expect = 0x000000FFu;
+                if (x >= 40 && x < 80 && y >= 30 && y < 60) expect = 0x0000FFFFu;
+                if (x >= 53 && x < 57 && y >= 43 && y < 47) expect = 0xFFFF00FFu;
+                if (c.pixels()[(std::size_t)y * kW + (std::size_t)x] != expect) {
+                    std::printf("wide: mismatch at (%d,%d)\n", x, y);
+                    return false;
+                }
+            }
+        }
+        return r.list_cache_size() == 2;
+    }
+
+    /// @brief 리스트 내부 clip(로컬 좌표)은 오프셋과 함께 옮겨지고 draw_list_clipped의 clip과 교차된다
+    bool check_local_clip() {
+        gfx::DisplayList list;
+        {
+            gfx::ClipScope clip(list, gfx::RectI{0, 0, 10, 10});
+            list.fill_rect(-5, -5, 30, 30, gfx::ColorRGBA8{255, 0, 0, 255});
+            list.clear(gfx::ColorRGBA8{0, 255, 0, 255}, 1);
+        }
+        list.put_pixel(20, 20, gfx::ColorRGBA8{0, 0, 255, 255});
+
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        q.draw_list_clipped(list, 50, 20, gfx::RectI{55, 0, 100, 100});
+
+        gfx::SoftwareRenderer r;
+        gfx::PixelCanvas c(kW, kH);
+        r.execute(q, c);
+
+        for (int y = 0; y < kH; ++y) {
+            for (int x = 0; x < kW; ++x) {
+                std::uint32_t expect = 0x000000FFu;
+                if (x >= 55 && x < 60 && y >= 20 && y < 30) expect = 0x00FF00FFu;
+                if (x == 70 && y == 40) expect = 0x0000FFFFu;
+                if (c.pixels()[(std::size_t)y * kW + (std::size_t)x] != expect) {
+                    std::printf("local clip: mismatch at (%d,%d)\n", x, y);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_replay(nullptr, false)) return 1;
+    if (!check_replay(nullptr, true)) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_replay(js, false) && check_replay(js, true);
+    core::internal::destroy_default_jobsystem(js);
+    if (!ok) return 1;
+
+    if (!check_revision_and_extent()) return 1;
+    if (!check_local_clip()) return 1;
+    return 0;
+}
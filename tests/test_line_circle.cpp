@@ -0,0 +1,133 @@
+// tests/test_line_circle.cpp
+// 타일 클립 선/원: 선은 Bresenham과 같은 픽셀, 원은 8분할 중점 순회와 같은 픽셀 집합을 (반투명이어도) 한 번씩만 쓰는지
+// put_pixel 기준과 비교한다. 화면 밖으로 긴 선, 큰 원, 병렬 실행도 확인한다.
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include "TestCanvas.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace framedot;
+using test::kW;
+using test::kH;
+using test::kBack;
+using test::equal;
+
+namespace {
+
+    using Pixels = std::set<std::pair<int, int>>;
+
+    test::Lcg rnd{777u};
+
+    Pixels bresenham(int x0, int y0, int x1, int y1) {
+        Pixels p;
+        const int dx = std::abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+        const int dy = -std::abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+        int err = dx + dy;
+        while (true) {
+            if (x0 >= 0 && x0 < kW && y0 >= 0 && y0 < kH) p.insert({x0, y0});
+            if (x0 == x1 && y0 == y1) break;
+            const int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x0 += sx; }
+            if (e2 <= dx) { err += dx; y0 += sy; }
+        }
+        return p;
+    }
+
+    /// @brief 8분할 중점 원 (테두리: 8점, 채움: 행 span)
+    Pixels midpoint(int cx, int cy, int r, bool fill) {
+        Pixels p;
+        auto put = [&](int x, int y) {
+            if (x >= 0 && x < kW && y >= 0 && y < kH) p.insert({x, y});
+        };
+        auto span = [&](int y, int xa, int xb) {
+            for (int x = xa; x <= xb; ++x) put(x, y);
+        };
+        int x = r, y = 0, err = 0;
+        while (x >= y) {
+            if (fill) {
+                span(cy + y, cx - x, cx + x); span(cy - y, cx - x, cx + x);
+                span(cy + x, cx - y, cx + y); span(cy - x, cx - y, cx + y);
+            } else {
+                put(cx + x, cy + y); put(cx + y, cy + x); put(cx - y, cy + x); put(cx - x, cy + y);
+                put(cx - x, cy - y); put(cx - y, cy - x); put(cx + y, cy - x); put(cx + x, cy - y);
+            }
+            if (err <= 0) { y += 1; err += 2 * y + 1; }
+            if (err > 0)  { x -= 1; err -= 2 * x + 1; }
+        }
+        return p;
+    }
+
+    /// @brief 커맨드 하나를 그린 결과 == 기준 픽셀마다 put_pixel 한 번 (반투명이라 중복/누락이 드러난다)
+    template <class Record>
+    bool check_one(const char* name, core::JobSystem* js, const Pixels& ref, Record&& record) {
+        const gfx::ColorRGBA8 c{230, 120, 40, 150};
+        gfx::RenderQueueConfig cfg{};
+        cfg.max_commands = (std::size_t)kW * kH + 1;   // 기준은 픽셀마다 커맨드 하나
+        gfx::RenderQueue a, b(cfg);
+        a.begin_frame();
+        b.begin_frame();
+        a.clear(kBack);
+        b.clear(kBack);
+        record(a, c);
+        for (const auto& [x, y] : ref) b.put_pixel(x, y, c);
+        if (b.dropped() != 0) return false;
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::PixelCanvas ca(kW, kH), cb(kW, kH);
+        gfx::SoftwareRenderer r;
+        r.execute(ctx, a, ca);
+        r.execute(b, cb);
+        return equal(name, ca, cb);
+    }
+
+    bool check_lines(core::JobSystem* js) {
+        for (int iter = 0; iter < 300; ++iter) {
+            const int span = (iter % 3 == 0) ? 400 : 60;
+            const int x0 = rnd(-span, kW + span), y0 = rnd(-span, kH + span);
+            const int x1 = (iter % 7 == 0) ? x0 : rnd(-span, kW + span);
+            const int y1 = (iter % 11 == 0) ? y0 : rnd(-span, kH + span);
+            const Pixels ref = bresenham(x0, y0, x1, y1);
+            if (!check_one("line", js, ref, [&](gfx::RenderQueue& q, gfx::ColorRGBA8 c) { q.line(x0, y0, x1, y1, c); })) return false;
+        }
+
+        // 대부분 화면 밖인 긴 선
+        const Pixels ref = bresenham(-100000, -3000, 100000, 5000);
+        return check_one("long", js, ref, [](gfx::RenderQueue& q, gfx::ColorRGBA8 c) { q.line(-100000, -3000, 100000, 5000, c); })
+               && check_one("long_steep", js, bresenham(40, -90000, 90, 90000),
+                            [](gfx::RenderQueue& q, gfx::ColorRGBA8 c) { q.line(40, -90000, 90, 90000, c); });
+    }
+
+    bool check_circles(core::JobSystem* js) {
+        for (int iter = 0; iter < 120; ++iter) {
+            const int cx = rnd(-30, kW + 30), cy = rnd(-30, kH + 30);
+            const int r = (iter % 10 == 0) ? rnd(100, 300) : rnd(1, 60);
+            const bool fill = (iter & 1) != 0;
+            const Pixels ref = midpoint(cx, cy, r, fill);
+            const bool ok = check_one(fill ? "fill_circle" : "circle", js, ref, [&](gfx::RenderQueue& q, gfx::ColorRGBA8 c) {
+                if (fill) q.fill_circle(cx, cy, r, c);
+                else      q.circle(cx, cy, r, c);
+            });
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_lines(nullptr) || !check_circles(nullptr)) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_lines(js) && check_circles(js);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+// tests/test_movement_2d.cpp
+// Movement2D: SSE/AVX 적분 커널이 스칼라 기준 구현과 비트 단위로 같은지(꼬리 길이 1..7, 비정렬 시작 포함),
+// 시스템 전체(gather/scatter, 선택 컴포넌트, 워커 분할)가 스칼라 커널로 계산한 값과 같은지 확인한다.
+#include <framedot/ecs/Fecs.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace framedot;
+using ecs::systems::MovementIsa;
+using ecs::systems::MovementSoA2D;
+
+namespace {
+
+    std::uint32_t g_rng = 0x2468ACE1u;
+
+    std::uint32_t next() {
+        g_rng ^= g_rng << 13;
+        g_rng ^= g_rng >> 17;
+        g_rng ^= g_rng << 5;
+        return g_rng;
+    }
+
+    /// @brief [-range, range) 실수
+    float rndf(float range) {
+        return ((float)(next() & 0xFFFFFFu) / (float)0x1000000 * 2.0f - 1.0f) * range;
+    }
+
+    struct Lanes {
+        std::vector<float> px, py, vx, vy, ax, ay, damp;
+
+        explicit Lanes(std::size_t n) : px(n), py(n), vx(n), vy(n), ax(n), ay(n), damp(n) {}
+
+        MovementSoA2D soa(std::size_t ofs, std::size_t n) {
+            MovementSoA2D s{};
+            s.px = px.data() + ofs; s.py = py.data() + ofs;
+            s.vx = vx.data() + ofs; s.vy = vy.data() + ofs;
+            s.ax = ax.data() + ofs; s.ay = ay.data() + ofs;
+            s.damp = damp.data() + ofs;
+            s.count = n;
+            return s;
+        }
+
+        bool operator==(const Lanes& o) const {
+            auto eq = [](const std::vector<float>& a, const std::vector<float>& b) {
+                return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+            };
+            return eq(px, o.px) && eq(py, o.py) && eq(vx, o.vx) && eq(vy, o.vy);
+        }
+    };
+
+    Lanes random_lanes(std::size_t n) {
+        Lanes l(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            l.px[i] = rndf(5000.0f);
+            l.py[i] = rndf(1e-3f);
+            l.vx[i] = rndf(300.0f);
+            l.vy[i] = rndf(1.0f);
+            l.ax[i] = (i % 3 == 0) ? 0.0f : rndf(50.0f);
+            l.ay[i] = rndf(9.8f);
+            l.damp[i] = (i % 4 == 0) ? 1.0f : 1.0f / (1.0f + (rndf(1.0f) + 1.0f) * (1.0f / 60.0f));
+        }
+        return l;
+    }
+
+    /// @brief 커널 == 스칼라 (길이 1..40, 블록 경계 전후, 시작 오프셋 0..3)
+    bool check_kernel(MovementIsa isa, const char* name) {
+        const auto fn = ecs::systems::integrate_soa_2d_for(isa);
+        if (!fn) return true;   // 이 CPU에서는 미지원
+
+        std::vector<std::size_t> lengths;
+        for (std::size_t n = 1; n <= 40; ++n) lengths.push_back(n);
+        for (std::size_t n : {511u, 512u, 513u, 1031u}) lengths.push_back(n);
+
+        for (const std::size_t n : lengths) {
+            for (std::size_t ofs = 0; ofs < 4; ++ofs) {
+                Lanes ref = random_lanes(n + ofs);
+                Lanes got = ref;
+                for (const float dt : {1.0f / 60.0f, 0.1f}) {
+                    ecs::systems::integrate_soa_2d_scalar(ref.soa(ofs, n), dt);
+                    fn(got.soa(ofs, n), dt);
+                }
+                if (!(ref == got)) {
+                    std::printf("kernel %s: mismatch n=%zu ofs=%zu\n", name, n, ofs);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief 시스템 결과 == 엔티티별 스칼라 커널 (Transform2D가 없는 엔티티는 속도도 그대로)
+    bool check_system(core::JobSystem* js, std::size_t count) {
+        fecs::World world;
+        fecs::systems::install_movement_2d(world);
+        auto& reg = world.registry();
+
+        std::vector<fecs::Entity> ents;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto e = reg.create();
+            ents.push_back(e);
+            if (i % 11 != 5) {
+                fecs::Transform2D t{};
+                t.position = math::Vec2f{rndf(1000.0f), rndf(1000.0f)};
+                reg.emplace<fecs::Transform2D>(e, t);
+            }
+            reg.emplace<fecs::Velocity2D>(e, math::Vec2f{rndf(200.0f), rndf(200.0f)});
+            if (i % 3 == 0) reg.emplace<fecs::Acceleration2D>(e, math::Vec2f{rndf(10.0f), 9.8f});
+            if (i % 5 == 0) reg.emplace<fecs::Damping2D>(e, rndf(1.0f) + 1.0f);
+        }
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        ctx.dt_seconds = 1.0 / 60.0;
+        const float dt = (float)ctx.dt_seconds;
+
+        for (int frame = 0; frame < 3; ++frame) {
+            // 기대값: 엔티티마다 길이 1짜리 SoA로 스칼라 커널
+            std::vector<fecs::Transform2D> want_t(count);
+            std::vector<fecs::Velocity2D> want_v(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto e = ents[i];
+                want_v[i] = reg.get<fecs::Velocity2D>(e);
+                if (!reg.all_of<fecs::Transform2D>(e)) continue;
+                want_t[i] = reg.get<fecs::Transform2D>(e);
+
+                const auto* a = reg.try_get<fecs::Acceleration2D>(e);
+                const auto* d = reg.try_get<fecs::Damping2D>(e);
+                const float ax = a ? a->a.x : 0.0f, ay = a ? a->a.y : 0.0f;
+                const float damp = d ? 1.0f / (1.0f + d->damping * dt) : 1.0f;
+
+                MovementSoA2D s{};
+                s.px = &want_t[i].position.x; s.py = &want_t[i].position.y;
+                s.vx = &want_v[i].v.x; s.vy = &want_v[i].v.y;
+                s.ax = &ax; s.ay = &ay; s.damp = &damp;
+                s.count = 1;
+                ecs::systems::integrate_soa_2d_scalar(s, dt);
+            }
+
+            world.tick(ctx);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto e = ents[i];
+                const auto& v = reg.get<fecs::Velocity2D>(e);
+                if (std::memcmp(&v, &want_v[i], sizeof(v)) != 0) {
+                    std::printf("system(%zu): velocity mismatch at %zu\n", count, i);
+                    return false;
+                }
+                if (!reg.all_of<fecs::Transform2D>(e)) continue;
+                const auto& t = reg.get<fecs::Transform2D>(e);
+                if (std::memcmp(&t.position, &want_t[i].position, sizeof(t.position)) != 0) {
+                    std::printf("system(%zu): position mismatch at %zu\n", count, i);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!ecs::systems::integrate_soa_2d_for(MovementIsa::Scalar)) return 1;
+    if (!check_kernel(MovementIsa::SSE, "sse") || !check_kernel(MovementIsa::AVX, "avx")) return 1;
+
+    if (!check_system(nullptr, 1300)) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_system(js, 10000);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
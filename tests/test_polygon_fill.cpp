@@ -0,0 +1,209 @@
+// tests/test_polygon_fill.cpp
+// fill_polygon/fill_triangle: 픽셀 중심 nonzero 규칙의 정수 기준과 같은지, 변을 공유하는 삼각형이 겹치거나
+// 틈이 없는지, 병렬/DisplayList 재생/dirty 추적 결과, vertex arena 용량 초과 처리를 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+#include <framedot_internal/gfx/RasterKernels.hpp>
+
+#include "TestCanvas.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot;
+using test::kW;
+using test::kH;
+using test::kBack;
+using test::equal;
+
+namespace {
+
+    test::Lcg rnd{12345u};
+
+    /// @brief 픽셀 중심 (x+0.5, y+0.5)의 winding (교점이 중심 이하인 변만 센다)
+    int winding(const std::vector<gfx::PointI>& v, int x, int y) {
+        int w = 0;
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            const gfx::PointI& a = v[i];
+            const gfx::PointI& b = v[(i + 1) % v.size()];
+            if (a.y == b.y) continue;
+            const bool down = a.y < b.y;
+            const gfx::PointI& top = down ? a : b;
+            const gfx::PointI& bot = down ? b : a;
+            if (y < top.y || y >= bot.y) continue;
+
+            const std::int64_t ey = bot.y - top.y, ex = bot.x - top.x;
+            if (2 * (std::int64_t)top.x * ey + (2 * (std::int64_t)(y - top.y) + 1) * ex <= (2 * (std::int64_t)x + 1) * ey) {
+                w += down ? 1 : -1;
+            }
+        }
+        return w;
+    }
+
+    /// @brief 무작위 다각형(오목/자기 교차/화면 밖 포함) == 정수 기준
+    bool check_reference() {
+        gfx::SoftwareRenderer r;
+        gfx::RenderQueue q;
+        const gfx::ColorRGBA8 c{250, 200, 20, 255};
+
+        for (int iter = 0; iter < 200; ++iter) {
+            std::vector<gfx::PointI> v((std::size_t)rnd(3, 9));
+            for (auto& p : v) p = gfx::PointI{rnd(-20, kW + 20), rnd(-20, kH + 20)};
+
+            q.begin_frame();
+            q.clear(kBack);
+            if (!q.fill_polygon(v, c)) return false;
+
+            gfx::PixelCanvas out(kW, kH), ref(kW, kH);
+            r.execute(q, out);
+            for (int y = 0; y < kH; ++y) {
+                for (int x = 0; x < kW; ++x) {
+                    ref.pixels()[(std::size_t)y * kW + (std::size_t)x] =
+                        gfx::internal::pack_rgba(winding(v, x, y) != 0 ? c : kBack);
+                }
+            }
+            if (!equal("reference", out, ref)) return false;
+        }
+        return true;
+    }
+
+    /// @brief 중심을 공유하는 삼각형 부채 == 같은 외곽의 다각형 (반투명: 겹치면 두 번 blend, 틈이면 배경)
+    bool check_shared_edges(bool premul) {
+        for (int iter = 0; iter < 20; ++iter) {
+            const gfx::PointI ctr{rnd(40, 90), rnd(30, 70)};
+            std::vector<gfx::PointI> ring;
+            const int n = rnd(3, 8);
+            for (int k = 0; k < n; ++k) {
+                // 중심 기준 각도 순으로 (볼록하지 않아도 부채는 겹치지 않는다)
+                const int dxs[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+                const int dys[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+                const int kk = k * 8 / n;
+                const int len = rnd(10, 35);
+                ring.push_back(gfx::PointI{ctr.x + dxs[kk] * len + rnd(-3, 3) * (dxs[kk] == 0),
+                                           ctr.y + dys[kk] * len + rnd(-3, 3) * (dys[kk] == 0)});
+            }
+
+            const gfx::ColorRGBA8 c{200, 60, 240, 128};
+            gfx::RenderQueue fan, poly;
+            fan.begin_frame();
+            poly.begin_frame();
+            fan.clear(kBack);
+            poly.clear(kBack);
+            for (int k = 0; k < n; ++k) {
+                const gfx::PointI& a = ring[(std::size_t)k];
+                const gfx::PointI& b = ring[(std::size_t)((k + 1) % n)];
+                fan.fill_triangle(ctr.x, ctr.y, a.x, a.y, b.x, b.y, c);
+            }
+            poly.fill_polygon(ring, c);
+
+            gfx::PixelCanvas a(kW, kH), b(kW, kH);
+            if (premul) {
+                a.set_format(gfx::PixelFormat::RGBA8888Premul);
+                b.set_format(gfx::PixelFormat::RGBA8888Premul);
+            }
+            gfx::SoftwareRenderer r;
+            r.execute(fan, a);
+            r.execute(poly, b);
+            if (!equal("shared", a, b)) return false;
+        }
+        return true;
+    }
+
+    template <class Recorder>
+    void scene(Recorder& rec, int ox, int oy) {
+        auto at = [&](int x, int y) { return gfx::PointI{x + ox, y + oy}; };
+        const std::vector<gfx::PointI> star = {at(60, 5), at(80, 90), at(10, 30), at(115, 30), at(35, 90)};
+        const std::vector<gfx::PointI> notch = {at(5, 5), at(50, 5), at(50, 45), at(30, 20), at(5, 45)};
+
+        rec.fill_polygon(star, gfx::ColorRGBA8{240, 200, 40, 255});
+        rec.fill_polygon(notch, gfx::ColorRGBA8{40, 200, 240, 150});
+        rec.fill_triangle(ox + 90, oy + 40, ox + 125, oy + 95, ox + 70, oy + 99, gfx::ColorRGBA8{255, 255, 255, 90});
+
+        const std::uint16_t prev = rec.push_clip(gfx::RectI{ox + 20, oy + 50, ox + 70, oy + 80});
+        rec.fill_triangle(ox + 0, oy + 40, ox + 100, oy + 60, ox + 10, oy + 99, gfx::ColorRGBA8{255, 0, 0, 255});
+        rec.pop_clip(prev);
+    }
+
+    bool check_scene(core::JobSystem* js, bool premul) {
+        gfx::DisplayList list;
+        scene(list, 0, 0);
+
+        gfx::RenderQueue direct, replay;
+        direct.begin_frame();
+        replay.begin_frame();
+        direct.clear(kBack);
+        replay.clear(kBack);
+        scene(direct, 7, -5);
+        replay.draw_list(list, 7, -5);
+
+        gfx::PixelCanvas serial(kW, kH), parallel(kW, kH), listed(kW, kH);
+        if (premul) {
+            serial.set_format(gfx::PixelFormat::RGBA8888Premul);
+            parallel.set_format(gfx::PixelFormat::RGBA8888Premul);
+            listed.set_format(gfx::PixelFormat::RGBA8888Premul);
+        }
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::SoftwareRenderer r;
+        r.execute(direct, serial);
+        r.execute(ctx, direct, parallel);
+        r.execute(ctx, replay, listed);
+        return equal("parallel", serial, parallel) && equal("list", serial, listed);
+    }
+
+    /// @brief 같은 arena 오프셋에 다른 꼭짓점이 오면 dirty 추적이 다시 그린다
+    bool check_dirty() {
+        gfx::RenderQueue q;
+        gfx::SoftwareRenderer tracked, fresh;
+        tracked.set_dirty_tracking(true);
+        gfx::PixelCanvas a(kW, kH), b(kW, kH);
+
+        for (int f = 0; f < 3; ++f) {
+            q.begin_frame();
+            q.clear(kBack);
+            q.fill_triangle(10, 10, 60 + f * 20, 15, 20, 70, gfx::ColorRGBA8{255, 128, 0, 255});
+            tracked.execute(q, a);
+            fresh.execute(q, b);
+            if (!equal("dirty", a, b)) return false;
+        }
+        return tracked.stats().dirty_tiles > 0;
+    }
+
+    bool check_capacity() {
+        gfx::RenderQueueConfig cfg{};
+        cfg.vertices = 5;
+        gfx::RenderQueue q(cfg);
+        q.begin_frame();
+
+        const gfx::ColorRGBA8 c{255, 255, 255, 255};
+        if (!q.fill_triangle(0, 0, 10, 0, 0, 10, c)) return false;
+        if (q.fill_triangle(0, 0, 10, 0, 0, 10, c)) return false;
+        if (q.dropped() != 1 || q.size() != 1) return false;
+
+        // 꼭짓점 부족 / 좌표 범위 밖은 기록하지 않는다
+        const gfx::PointI two[2] = {{0, 0}, {5, 5}};
+        if (q.fill_polygon(two, c)) return false;
+        if (q.fill_triangle(0, 0, 1 << 29, 0, 0, 10, c)) return false;
+
+        q.begin_frame();
+        return q.fill_triangle(0, 0, 10, 0, 0, 10, c);
+    }
+
+} // namespace
+
+int main() {
+    if (!check_reference()) return 1;
+    if (!check_shared_edges(false) || !check_shared_edges(true)) return 1;
+    if (!check_scene(nullptr, false) || !check_scene(nullptr, true)) return 1;
+    if (!check_dirty()) return 1;
+    if (!check_capacity()) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_scene(js, false) && check_scene(js, true);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
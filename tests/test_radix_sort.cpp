@@ -0,0 +1,121 @@
+// tests/test_radix_sort.cpp
+// 커맨드 순서 radix sort가 (key, 제출 인덱스) 기준 stable_sort와 같은지,
+// 상수 바이트 패스를 건너뛰는지, 병렬 경로가 순차 경로와 같은지 확인한다.
+#include <framedot_internal/gfx/RadixSort.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+using namespace framedot;
+using namespace framedot::gfx::internal;
+
+namespace {
+
+    std::uint32_t g_rng = 0x9E3779B9u;
+
+    std::uint32_t next() {
+        g_rng ^= g_rng << 13;
+        g_rng ^= g_rng >> 17;
+        g_rng ^= g_rng << 5;
+        return g_rng;
+    }
+
+    std::vector<std::uint32_t> reference(const std::vector<std::uint32_t>& keys) {
+        std::vector<std::uint32_t> order(keys.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+                         [&](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+        return order;
+    }
+
+    /// @param expect_passes 기대 패스 수 (-1이면 검사 안 함)
+    bool check(const char* name, const std::vector<std::uint32_t>& keys, int expect_passes,
+               core::JobSystem* jobs) {
+        std::vector<std::uint64_t> a, b;
+        const std::vector<std::uint32_t> ref = reference(keys);
+
+        std::vector<std::uint32_t> o32(keys.size());
+        const int passes = radix_sort_order(keys.data(), sizeof(std::uint32_t), keys.size(), o32.data(), a, b, jobs);
+        if (o32 != ref) {
+            std::printf("%s: order mismatch (n=%zu)\n", name, keys.size());
+            return false;
+        }
+        if (expect_passes >= 0 && passes != expect_passes) {
+            std::printf("%s: passes=%d expected=%d\n", name, passes, expect_passes);
+            return false;
+        }
+
+        if (keys.size() <= 65536) {
+            std::vector<std::uint16_t> o16(keys.size());
+            radix_sort_order(keys.data(), sizeof(std::uint32_t), keys.size(), o16.data(), a, b, jobs);
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                if (o16[i] != ref[i]) {
+                    std::printf("%s: uint16 order mismatch\n", name);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool run_all(core::JobSystem* jobs) {
+        for (std::size_t n : { std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{300},
+                               std::size_t{5000}, std::size_t{20000} }) {
+            std::vector<std::uint32_t> keys(n);
+
+            // 전부 같은 key -> 0패스, 제출 순서 그대로
+            std::fill(keys.begin(), keys.end(), gfx::make_sort_key(3, 7, 1));
+            if (!check("constant", keys, 0, jobs)) return false;
+
+            if (n < 2) continue;
+
+            // layer 바이트만 다름 -> 1패스
+            for (auto& k : keys) k = gfx::make_sort_key((std::uint8_t)(next() % 4), 5, 2);
+            if (!check("layer", keys, 1, jobs)) return false;
+
+            // 일반 key (layer/order/tie), 중복 많음
+            for (auto& k : keys) {
+                k = gfx::make_sort_key((std::uint8_t)(next() % 4), (std::uint16_t)(next() % 16), (std::uint16_t)(next() % 4));
+            }
+            if (!check("mixed", keys, -1, jobs)) return false;
+
+            // 임의 32bit -> 4패스
+            for (auto& k : keys) k = next();
+            keys[0] = 0x00000000u;
+            keys[1] = 0xFFFFFFFFu;
+            if (!check("random", keys, 4, jobs)) return false;
+        }
+
+        // Cmd 배열에서 stride로 key를 읽는 경로
+        std::vector<gfx::RenderQueue::Cmd> cmds(1000);
+        std::vector<std::uint32_t> keys(cmds.size());
+        for (std::size_t i = 0; i < cmds.size(); ++i) keys[i] = cmds[i].sort_key = next() % 64;
+
+        std::vector<std::uint64_t> a, b;
+        std::vector<std::uint16_t> order(cmds.size());
+        radix_sort_order(&cmds[0].sort_key, sizeof(gfx::RenderQueue::Cmd), cmds.size(), order.data(), a, b, jobs);
+        const std::vector<std::uint32_t> ref = reference(keys);
+        for (std::size_t i = 0; i < cmds.size(); ++i) {
+            if (order[i] != ref[i]) {
+                std::printf("stride: order mismatch\n");
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!run_all(nullptr)) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = run_all(js);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+// tests/test_raster_kernels.cpp
+// SIMD span 커널이 스칼라 기준 구현과 비트 단위로 같은지 확인한다.
+// premultiplied 경로는 straight 경로와 (불투명 배경에서) ±1 이내로 같은지도 본다.
+#include <framedot_internal/gfx/RasterKernels.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot::gfx;
+using namespace framedot::gfx::internal;
+
+namespace {
+
+    std::uint32_t g_rng = 0x12345678u;
+
+    std::uint32_t next() {
+        g_rng ^= g_rng << 13;
+        g_rng ^= g_rng >> 17;
+        g_rng ^= g_rng << 5;
+        return g_rng;
+    }
+
+    /// @brief 알파 0/255 경계값이 자주 나오도록 섞는다
+    std::uint32_t random_pixel() {
+        std::uint32_t p = next();
+        switch (next() % 4) {
+        case 0: return p | 0xFFu;
+        case 1: return p & ~0xFFu;
+        default: return p;
+        }
+    }
+
+    ColorRGBA8 random_color() {
+        const std::uint32_t p = random_pixel();
+        return ColorRGBA8{ pr(p), pg(p), pb(p), pa(p) };
+    }
+
+    bool check_set(const RasterKernelSet& ref, const RasterKernelSet& k) {
+        std::vector<std::uint32_t> src(96), a(96), b(96);
+
+        for (int iter = 0; iter < 4000; ++iter) {
+            const std::size_t n = next() % 80;
+            const std::size_t ofs = next() % 8;   // 정렬되지 않은 시작 주소
+            for (auto& p : src) p = random_pixel();
+            for (auto& p : a) p = random_pixel();
+            b = a;
+
+            switch (iter % 6) {
+            case 0: {
+                const std::uint32_t p = next();
+                ref.fill(a.data() + ofs, n, p);
+                k.fill(b.data() + ofs, n, p);
+                break;
+            }
+            case 1: {
+                const ColorRGBA8 c = random_color();
+                ref.blend(a.data() + ofs, n, c);
+                k.blend(b.data() + ofs, n, c);
+                break;
+            }
+            case 2: {
+                ref.copy_masked(a.data() + ofs, src.data() + ofs, n);
+                k.copy_masked(b.data() + ofs, src.data() + ofs, n);
+                break;
+            }
+            case 3: {
+                const ColorRGBA8 t = (next() & 1) ? ColorRGBA8{255, 255, 255, 255} : random_color();
+                ref.blit(a.data() + ofs, src.data() + ofs, n, t);
+                k.blit(b.data() + ofs, src.data() + ofs, n, t);
+                break;
+            }
+            case 4: {
+                for (auto& p : a) p = premultiply(p);
+                b = a;
+                const std::uint32_t c = pack_premul(random_color());
+                ref.blend_premul(a.data() + ofs, n, c);
+                k.blend_premul(b.data() + ofs, n, c);
+                break;
+            }
+            default: {
+                for (auto& p : src) p = premultiply(p);
+                for (auto& p : a) p = premultiply(p);
+                b = a;
+                const std::uint32_t t = (next() & 1) ? 0xFFFFFFFFu : pack_premul(random_color());
+                ref.blit_premul(a.data() + ofs, src.data() + ofs, n, t);
+                k.blit_premul(b.data() + ofs, src.data() + ofs, n, t);
+                break;
+            }
+            }
+
+            if (a != b) {
+                std::printf("%s: mismatch (iter=%d n=%zu)\n", k.name, iter, n);
+                return false;
+            }
+        }
+
+        // 모든 (src alpha, dst alpha) 조합
+        for (std::uint32_t sa = 0; sa < 256; ++sa) {
+            for (std::uint32_t i = 0; i < 256; ++i) a[i % 64] = b[i % 64] = (next() & ~0xFFu) | i;
+            const ColorRGBA8 c{ (std::uint8_t)next(), (std::uint8_t)next(), (std::uint8_t)next(), (std::uint8_t)sa };
+            ref.blend(a.data(), 64, c);
+            k.blend(b.data(), 64, c);
+            if (a != b) {
+                std::printf("%s: blend mismatch (sa=%u)\n", k.name, sa);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief 불투명 배경 위 합성: premultiplied 결과 == straight 결과 (채널별 ±1)
+    bool check_premul_matches_straight() {
+        for (std::uint32_t sa = 0; sa < 256; ++sa) {
+            for (int iter = 0; iter < 64; ++iter) {
+                const std::uint32_t d = next() | 0xFFu;
+                const ColorRGBA8 c{ (std::uint8_t)next(), (std::uint8_t)next(), (std::uint8_t)next(), (std::uint8_t)sa };
+
+                const std::uint32_t s = blend_over(d, c);
+                const std::uint32_t p = blend_over_premul(d, pack_premul(c));
+                for (int sh = 0; sh < 32; sh += 8) {
+                    const int diff = (int)((s >> sh) & 0xFFu) - (int)((p >> sh) & 0xFFu);
+                    if (diff < -1 || diff > 1) {
+                        std::printf("premul: mismatch (sa=%u s=%08x p=%08x)\n", sa, s, p);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    const RasterKernelSet* ref = raster_kernels_for(RasterIsa::Scalar);
+    if (!ref) return 1;
+    if (!check_premul_matches_straight()) return 1;
+
+    for (RasterIsa isa : { RasterIsa::SSE2, RasterIsa::AVX2 }) {
+        const RasterKernelSet* k = raster_kernels_for(isa);
+        if (!k) continue;   // 이 CPU에서는 미지원
+        if (!check_set(*ref, *k)) return 1;
+    }
+    return 0;
+}
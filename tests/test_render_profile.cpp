@@ -0,0 +1,177 @@
+// tests/test_render_profile.cpp
+// 래스터 계측: op별 픽셀 수가 알려진 장면과 맞는지, 읽은/그린 커맨드 수, 순차/병렬(띠 포함) 결과가 같은지,
+// 타일 시간 합/최대, heatmap이 실행한 타일만 덮는지, 꺼져 있으면 비어 있는지 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/math/Types.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    constexpr int kW = 100, kH = 60;
+    using Op = gfx::RenderQueue::Op;
+
+    std::size_t op(Op o) { return (std::size_t)o; }
+
+    /// @brief 커맨드마다 쓰는 픽셀 수가 정해진 장면 (타일 하나)
+    bool check_counts() {
+        std::vector<std::uint32_t> sprite(8 * 8, 0xFF8040FFu);
+        gfx::DisplayList list;
+        list.fill_rect(0, 0, 4, 4, gfx::ColorRGBA8{0, 255, 0, 255});
+
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        q.fill_rect(5, 5, 10, 10, gfx::ColorRGBA8{255, 0, 0, 255});
+        q.blend_rect(30, 5, 20, 5, gfx::ColorRGBA8{0, 0, 255, 100});
+        q.line(10, 40, 39, 40, gfx::ColorRGBA8{255, 255, 255, 255});
+        q.blit_sprite(60, 30, sprite.data(), 8, 8, 8, gfx::ColorRGBA8{255, 255, 255, 255});
+        q.draw_list(list, 80, 50);
+
+        gfx::SoftwareRenderer r;
+        r.set_tile_size(256);
+        r.set_profiling(true);
+        gfx::PixelCanvas c(kW, kH);
+        r.execute(q, c);
+
+        const auto& p = r.profile();
+        if (p.op_pixels[op(Op::Clear)] != (std::uint64_t)kW * kH) return false;
+        if (p.op_pixels[op(Op::FillRect)] != 100 + 16) return false;   // 리스트 안 fill_rect 포함
+        if (p.op_pixels[op(Op::BlendRect)] != 100) return false;
+        if (p.op_pixels[op(Op::Line)] != 30) return false;
+        if (p.op_pixels[op(Op::BlitSprite)] != 64) return false;
+        if (p.op_drawn[op(Op::FillRect)] != 2 || p.op_drawn[op(Op::DrawList)] != 0) return false;
+        if (p.pixels != (std::uint64_t)kW * kH + 116 + 100 + 30 + 64) return false;
+
+        // 큐 6개 + 리스트 안 1개, DrawList 자체는 픽셀을 쓰지 않는다
+        if (p.visited != 7 || p.drawn != 6) {
+            std::printf("counts: visited=%u drawn=%u\n", p.visited, p.drawn);
+            return false;
+        }
+        return r.tile_ns().size() == 1 && r.tile_ns()[0] > 0 && p.raster_ns == r.tile_ns()[0]
+               && p.max_tile_ns == p.raster_ns && p.execute_ns >= p.raster_ns;
+    }
+
+    /// @brief 원 테두리 안쪽 타일은 읽기만 하고 그리지 않는다
+    bool check_visited() {
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.circle(50, 30, 28, gfx::ColorRGBA8{255, 255, 255, 255});
+
+        gfx::SoftwareRenderer r;
+        r.set_tile_size(16);
+        r.set_profiling(true);
+        gfx::PixelCanvas c(kW, kH);
+        r.execute(q, c);
+        const auto& p = r.profile();
+        return p.visited == r.stats().bin_entries && p.drawn < p.visited && p.drawn > 0
+               && p.op_drawn[op(Op::Circle)] == p.drawn;
+    }
+
+    /// @brief 병렬(합친 타일/띠)도 픽셀 수는 순차와 같고, 타일 시간 합/최대가 tile_ns와 맞는다
+    bool check_parallel(core::JobSystem* js) {
+        std::vector<std::uint32_t> sprite(24 * 24);
+        for (std::size_t i = 0; i < sprite.size(); ++i) sprite[i] = (std::uint32_t)i * 2654435761u | 0x80u;
+
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{10, 20, 30, 255});
+        const math::Mat3f m = math::make_affine_2d(math::Vec2f{20.0f, 20.0f}, 0.3f, math::Vec2f{2.0f, 2.0f});
+        for (int i = 0; i < 10; ++i) {
+            q.blit_sprite_affine(m, sprite.data(), 24, 24, 24, gfx::ColorRGBA8{255, 255, 255, 200}, gfx::SampleFilter::Bilinear);
+        }
+        q.fill_circle(70, 40, 15, gfx::ColorRGBA8{255, 0, 0, 128});
+        q.fill_triangle(40, 0, 99, 59, 0, 59, gfx::ColorRGBA8{0, 255, 0, 60});
+
+        gfx::SoftwareRenderer rs, rp;
+        for (gfx::SoftwareRenderer* r : {&rs, &rp}) {
+            r->set_tile_size(32);
+            r->set_profiling(true);
+        }
+        gfx::PixelCanvas a(kW, kH), b(kW, kH);
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        rs.execute(q, a);
+        rp.execute(ctx, q, b);
+
+        const auto& ps = rs.profile();
+        const auto& pp = rp.profile();
+        if (rp.stats().split_tiles == 0) return false;
+        if (ps.pixels != pp.pixels || ps.op_pixels != pp.op_pixels) return false;
+
+        std::uint64_t sum = 0, mx = 0;
+        for (const std::uint64_t ns : rp.tile_ns()) { sum += ns; mx = std::max(mx, ns); }
+        return rp.tile_ns().size() == rp.stats().tiles && pp.raster_ns == sum && pp.max_tile_ns == mx && mx > 0;
+    }
+
+    /// @brief heatmap은 실행한 타일만 덮고, dirty 추적 중이면 다음 프레임을 전체 다시 그린다
+    bool check_heatmap() {
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        q.fill_rect(40, 10, 20, 20, gfx::ColorRGBA8{255, 255, 255, 255});
+
+        gfx::SoftwareRenderer plain, heat;
+        for (gfx::SoftwareRenderer* r : {&plain, &heat}) {
+            r->set_tile_size(32);
+            r->set_profiling(true);
+            r->set_dirty_tracking(true);
+        }
+        heat.set_heatmap(true);
+
+        gfx::PixelCanvas a(kW, kH), b(kW, kH);
+        plain.execute(q, a);
+        heat.execute(q, b);
+        const auto pa = a.pixels();
+        const auto pb = b.pixels();
+        for (std::size_t i = 0; i < pa.size(); ++i) {
+            if (pa[i] == pb[i]) {
+                std::printf("heatmap: untouched pixel (%zu,%zu)\n", i % kW, i / kW);
+                return false;   // clear가 모든 타일을 실행한다
+            }
+        }
+
+        plain.execute(q, a);
+        heat.execute(q, b);
+        if (plain.stats().clean_tiles != plain.stats().tiles || heat.stats().clean_tiles != 0) return false;
+
+        // 커맨드가 없는 타일은 그대로
+        gfx::RenderQueue small;
+        small.begin_frame();
+        small.fill_rect(2, 2, 5, 5, gfx::ColorRGBA8{255, 255, 255, 255});
+        gfx::PixelCanvas c(kW, kH);
+        heat.execute(small, c);
+        return c.pixels()[(std::size_t)50 * kW + 90] == 0u && c.pixels()[(std::size_t)3 * kW + 3] != 0xFFFFFFFFu;
+    }
+
+    bool check_off() {
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        gfx::SoftwareRenderer r;
+        r.set_heatmap(true);   // 계측이 꺼져 있으면 무시
+        gfx::PixelCanvas c(kW, kH);
+        r.execute(q, c);
+        const auto& p = r.profile();
+        return p.visited == 0 && p.pixels == 0 && p.execute_ns == 0 && r.tile_ns().empty()
+               && c.pixels()[0] == 0x000000FFu;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_counts() || !check_visited() || !check_heatmap() || !check_off()) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_parallel(js);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
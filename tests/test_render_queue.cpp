@@ -0,0 +1,503 @@
+// tests/test_render_queue.cpp
+// RenderQueue 용량 설정/paged 확장/워커 세그먼트/인스턴스 op/clip/가림 제거와, 커맨드 수가 uint16 범위를 넘을 때의 렌더 결과를 확인한다.
+#include <framedot/core/Tasks.hpp>
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    bool check_capacity() {
+        gfx::RenderQueueConfig cfg{};
+        cfg.max_commands = 100;
+        cfg.text_bytes = 8;
+
+        gfx::RenderQueue rq(cfg);
+        rq.begin_frame();
+        for (int i = 0; i < 120; ++i) rq.put_pixel(i, 0, gfx::ColorRGBA8{255, 0, 0, 255});
+        const bool text_ok = rq.text(0, 0, "0123456789", gfx::ColorRGBA8{255, 255, 255, 255});
+
+        if (rq.capacity() != 100 || rq.size() != 100 || rq.dropped() != 21 || text_ok || !rq.contiguous()) {
+            std::printf("capacity: size=%zu dropped=%u\n", rq.size(), rq.dropped());
+            return false;
+        }
+        return true;
+    }
+
+    bool check_paged_mpsc() {
+        gfx::RenderQueueConfig cfg{};
+        cfg.max_commands = 100000;
+        cfg.paged = true;
+        cfg.page_commands = 1000;   // -> 1024
+
+        gfx::RenderQueue rq(cfg);
+        if (rq.pages_allocated() != 1) return false;
+
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 5000;
+
+        for (int frame = 0; frame < 3; ++frame) {
+            rq.begin_frame();
+
+            std::vector<std::thread> ts;
+            for (int t = 0; t < kThreads; ++t) {
+                ts.emplace_back([&rq, t] {
+                    for (int i = 0; i < kPerThread; ++i) rq.put_pixel(i, t, gfx::ColorRGBA8{1, 2, 3, 255}, (std::uint32_t)t);
+                });
+            }
+            for (auto& th : ts) th.join();
+
+            if (rq.size() != (std::size_t)(kThreads * kPerThread) || rq.dropped() != 0) {
+                std::printf("paged: size=%zu dropped=%u\n", rq.size(), rq.dropped());
+                return false;
+            }
+
+            // 스레드별로 x가 0..kPerThread-1 순서대로 들어 있어야 한다
+            std::vector<int> next_x(kThreads, 0);
+            for (std::size_t i = 0; i < rq.size(); ++i) {
+                const auto& c = rq.cmd(i);
+                if (c.x0 != next_x[(std::size_t)c.y0]++) {
+                    std::printf("paged: order broken at %zu\n", i);
+                    return false;
+                }
+            }
+        }
+
+        // 20000 / 1024 -> 20 페이지, 프레임 간 재사용
+        if (rq.pages_allocated() != 20 || rq.contiguous()) {
+            std::printf("paged: pages=%zu\n", rq.pages_allocated());
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief 워커는 세그먼트로, 메인은 공유 경로로. end_frame 후 메인 커맨드 + 워커 순서대로 이어진다
+    bool check_worker_segments() {
+        gfx::RenderQueueConfig cfg{};
+        cfg.max_commands = 3000;
+        cfg.worker_segments = true;
+        gfx::RenderQueue rq(cfg);
+
+        core::JobSystem* js = core::internal::create_default_jobsystem(4);
+        const std::uint32_t workers = js->worker_count();
+        bool ok = true;
+
+        for (int frame = 0; frame < 2 && ok; ++frame) {
+            rq.begin_frame();
+            rq.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+
+            {
+                core::TaskGroup tg(js, core::JobLane::Engine);
+                for (std::uint32_t t = 0; t < 8; ++t) {
+                    tg.run([&rq, t]() noexcept {
+                        for (int i = 0; i < 500; ++i) rq.put_pixel(i, (int)t, gfx::ColorRGBA8{1, 2, 3, 255});
+                    });
+                }
+                tg.wait();
+            }
+
+            // 세그먼트 커맨드는 end_frame 전에는 보이지 않는다 (워커가 없으면 전부 공유 경로)
+            if (workers > 0 && rq.size() != 1) ok = false;
+
+            rq.end_frame();
+            // 1 + 8*500 = 4001 > 3000
+            if (rq.size() != 3000 || rq.dropped() != 1001) ok = false;
+            if (rq.cmd(0).op != gfx::RenderQueue::Op::Clear) ok = false;
+
+            // 태스크(y)별 x 순서 유지
+            std::vector<int> next_x(8, 0);
+            for (std::size_t i = 1; i < rq.size() && ok; ++i) {
+                const auto& c = rq.cmd(i);
+                if (c.x0 != next_x[(std::size_t)c.y0]++) ok = false;
+            }
+            if (!ok) std::printf("segments: size=%zu dropped=%u\n", rq.size(), rq.dropped());
+        }
+
+        core::internal::destroy_default_jobsystem(js);
+        return ok;
+    }
+
+    /// @brief 두 잡 시스템(번호가 같은 워커)이 한 큐에 동시에 기록해도 세그먼트를 공유하지 않는다
+    bool check_two_job_systems() {
+        gfx::RenderQueueConfig cfg{};
+        cfg.max_commands = 20000;
+        cfg.worker_segments = true;
+        gfx::RenderQueue rq(cfg);
+
+        core::JobSystem* a = core::internal::create_default_jobsystem(2);
+        core::JobSystem* b = core::internal::create_default_jobsystem(2);
+        constexpr int kTasks = 8, kPerTask = 1000;
+        bool ok = true;
+
+        for (int frame = 0; frame < 3 && ok; ++frame) {
+            rq.begin_frame();
+            {
+                core::TaskGroup ta(a, core::JobLane::Engine), tb(b, core::JobLane::Engine);
+                for (int t = 0; t < kTasks; ++t) {
+                    core::TaskGroup& tg = (t & 1) ? tb : ta;
+                    tg.run([&rq, t]() noexcept {
+                        for (int i = 0; i < kPerTask; ++i) rq.put_pixel(i, t, gfx::ColorRGBA8{1, 2, 3, 255});
+                    });
+                }
+                ta.wait();
+                tb.wait();
+            }
+            rq.end_frame();
+
+            std::vector<int> next_x(kTasks, 0);
+            if (rq.size() != (std::size_t)(kTasks * kPerTask) || rq.dropped() != 0) ok = false;
+            for (std::size_t i = 0; i < rq.size() && ok; ++i) {
+                const auto& c = rq.cmd(i);
+                if (c.x0 != next_x[(std::size_t)c.y0]++) ok = false;
+            }
+            if (!ok) std::printf("two job systems: size=%zu dropped=%u\n", rq.size(), rq.dropped());
+        }
+
+        core::internal::destroy_default_jobsystem(b);
+        core::internal::destroy_default_jobsystem(a);
+        return ok;
+    }
+
+    /// @brief 인스턴스 op 하나 == 같은 위치의 개별 커맨드 N개 (straight/premultiplied, 순차/병렬)
+    bool check_instanced(core::JobSystem* js) {
+        constexpr int kW = 150, kH = 90;
+        constexpr std::size_t kN = 600;
+
+        std::vector<std::uint32_t> sprite(7 * 5);
+        for (std::size_t i = 0; i < sprite.size(); ++i) {
+            sprite[i] = 0x20406000u | (std::uint32_t)(i * 37u) << 8 | (std::uint32_t)((i * 53u) & 0xFFu);
+        }
+
+        gfx::RenderQueue ref, inst;
+        ref.begin_frame();
+        inst.begin_frame();
+
+        std::vector<gfx::Instance> rects(kN);   // 호출자 소유
+        const std::span<gfx::Instance> sprites = inst.alloc_instances(kN);   // arena
+        if (sprites.size() != kN) return false;
+
+        std::uint32_t rng = 7;
+        for (std::size_t i = 0; i < kN; ++i) {
+            rng = rng * 1664525u + 1013904223u;
+            rects[i].x = (int)(rng >> 8) % (kW + 20) - 10;
+            rects[i].y = (int)(rng >> 16) % (kH + 20) - 10;
+            rects[i].color = gfx::ColorRGBA8{(std::uint8_t)rng, (std::uint8_t)(rng >> 8), 90, (std::uint8_t)(rng >> 24)};
+            sprites[i].x = rects[i].y * 2 - 20;
+            sprites[i].y = rects[i].x / 2;
+            sprites[i].color = (i % 3 == 0) ? gfx::ColorRGBA8{255, 255, 255, 255} : rects[i].color;
+        }
+
+        const gfx::ColorRGBA8 bg{10, 20, 30, 255};
+        const gfx::ColorRGBA8 tint{200, 255, 120, 180};
+        for (gfx::RenderQueue* q : {&ref, &inst}) {
+            q->clear(bg);
+            q->blend_rect(40, 20, 60, 40, gfx::ColorRGBA8{255, 0, 0, 128}, gfx::make_sort_key(1, 0));
+        }
+
+        // layer 2: 인스턴스별 색 rect, layer 0: 공통 tint sprite, layer 3: 인스턴스별 tint sprite
+        for (std::size_t i = 0; i < kN; ++i) {
+            ref.blend_rect(rects[i].x, rects[i].y, 6, 4, rects[i].color, gfx::make_sort_key(2, 0));
+            ref.blit_sprite(sprites[i].x, sprites[i].y, sprite.data(), 7, 5, 7, tint, gfx::make_sort_key(0, 1));
+        }
+        for (std::size_t i = 0; i < kN; ++i) {
+            ref.blit_sprite(sprites[i].x, sprites[i].y, sprite.data(), 7, 5, 7, sprites[i].color, gfx::make_sort_key(3, 0));
+        }
+        inst.fill_rect_instanced(rects, 6, 4, gfx::ColorRGBA8{}, true, gfx::make_sort_key(2, 0));
+        inst.blit_sprite_instanced(sprites, sprite.data(), 7, 5, 7, tint, false, gfx::make_sort_key(0, 1));
+        inst.blit_sprite_instanced(sprites, sprite.data(), 7, 5, 7, gfx::ColorRGBA8{}, true, gfx::make_sort_key(3, 0));
+
+        if (inst.size() != 5 || inst.dropped() != 0) return false;
+
+        for (const bool premul : {false, true}) {
+            gfx::PixelCanvas a(kW, kH), b(kW, kH);
+            if (premul) {
+                a.set_format(gfx::PixelFormat::RGBA8888Premul);
+                b.set_format(gfx::PixelFormat::RGBA8888Premul);
+            }
+
+            core::FrameContext ctx{};
+            ctx.jobs = js;
+            gfx::SoftwareRenderer ra, rb;
+            ra.execute(ref, a);
+            rb.execute(ctx, inst, b);
+
+            const auto pa = a.pixels();
+            const auto pb = b.pixels();
+            for (std::size_t i = 0; i < pa.size(); ++i) {
+                if (pa[i] != pb[i]) {
+                    std::printf("instanced: mismatch at %zu (premul=%d)\n", i, (int)premul);
+                    return false;
+                }
+            }
+        }
+
+        // arena 부족 -> 빈 span + dropped
+        if (!inst.alloc_instances(inst.instance_capacity()).empty() || inst.dropped() != 1) return false;
+        return true;
+    }
+
+    /// @brief 장면 일부 (clip 테스트용). group 0/1/2를 q에 기록
+    void clip_group(gfx::RenderQueue& q, int group, std::span<const gfx::Instance> inst, const std::uint32_t* sprite) {
+        switch (group) {
+        case 0:
+            q.fill_rect(5, 5, 80, 50, gfx::ColorRGBA8{30, 60, 200, 255});
+            q.line(0, 0, 149, 89, gfx::ColorRGBA8{255, 255, 0, 255});
+            q.fill_circle(100, 40, 25, gfx::ColorRGBA8{0, 200, 100, 160});
+            q.text(15, 50, "CLIP 42", gfx::ColorRGBA8{250, 250, 250, 255}, 0, 2);
+            q.fill_rect_instanced(inst, 5, 5, gfx::ColorRGBA8{}, true);
+            break;
+        case 1:
+            q.clear(gfx::ColorRGBA8{90, 0, 90, 255});
+            q.blend_rect(50, 0, 100, 90, gfx::ColorRGBA8{255, 128, 0, 120});
+            q.blit_sprite(70, 20, sprite, 7, 5, 7, gfx::ColorRGBA8{255, 255, 255, 255});
+            break;
+        default:
+            q.rect_outline(2, 2, 146, 86, 3, gfx::ColorRGBA8{200, 200, 200, 255});
+            break;
+        }
+    }
+
+    /// @brief 중첩 ClipScope: 결과 == clip 없이 그린 뒤 clip 밖을 이전 상태로 되돌린 것. 스레드/프레임별 clip 상태
+    bool check_clip(core::JobSystem* js) {
+        constexpr int kW = 150, kH = 90;
+        const gfx::RectI outer{20, 10, 110, 70};
+        const gfx::RectI inner{60, -5, 200, 40};   // 실제 clip = outer ∩ inner
+
+        std::vector<std::uint32_t> sprite(7 * 5);
+        for (std::size_t i = 0; i < sprite.size(); ++i) sprite[i] = 0xC0308000u | (std::uint32_t)((i * 41u) & 0xFFu);
+
+        std::vector<gfx::Instance> inst;
+        for (int i = 0; i < 60; ++i) {
+            inst.push_back(gfx::Instance{(i * 13) % 160 - 5, (i * 7) % 100 - 5,
+                                         gfx::ColorRGBA8{(std::uint8_t)(i * 4), 200, 50, 255}});
+        }
+
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{10, 20, 30, 255});
+        {
+            gfx::ClipScope a(q, outer);
+            clip_group(q, 0, inst, sprite.data());
+            {
+                gfx::ClipScope b(q, inner);
+                if (q.clip_rect(q.clip()) != outer.intersect(inner)) return false;
+                clip_group(q, 1, inst, sprite.data());
+
+                // 완전히 잘린 clip 안의 커맨드는 기록되지 않는다
+                gfx::ClipScope c(q, gfx::RectI{0, 50, 10, 60});
+                const std::size_t before = q.size();
+                if (!q.fill_rect(0, 0, 100, 100, gfx::ColorRGBA8{255, 0, 0, 255}) || q.size() != before) return false;
+            }
+
+            // 다른 스레드는 이 스레드의 clip을 보지 않는다
+            std::thread th([&] { q.put_pixel(0, 0, gfx::ColorRGBA8{1, 2, 3, 255}); });
+            th.join();
+            if (q.cmd(q.size() - 1).u1 != gfx::RenderQueue::kNoClip) return false;
+        }
+        if (q.clip() != gfx::RenderQueue::kNoClip) return false;
+        clip_group(q, 2, inst, sprite.data());
+
+        // 기대값: 그룹마다 clip 없이 그리고 clip 밖을 직전 상태로 되돌린다
+        gfx::PixelCanvas expect(kW, kH);
+        gfx::SoftwareRenderer rr;
+        gfx::RectI clips[] = {outer, outer.intersect(inner), gfx::RectI::unbounded()};
+        for (int step = -1; step < 3; ++step) {
+            gfx::RenderQueue g;
+            g.begin_frame();
+            if (step < 0) g.clear(gfx::ColorRGBA8{10, 20, 30, 255});
+            else clip_group(g, step, inst, sprite.data());
+            if (step == 1) g.put_pixel(0, 0, gfx::ColorRGBA8{1, 2, 3, 255});   // 스레드 커맨드 (sort_key 0, 그룹 1 다음)
+
+            const std::vector<std::uint32_t> prev(expect.pixels().begin(), expect.pixels().end());
+            rr.execute(g, expect);
+            if (step < 0) continue;
+
+            auto px = expect.pixels();
+            for (int y = 0; y < kH; ++y) {
+                for (int x = 0; x < kW; ++x) {
+                    const gfx::RectI& cr = clips[step];
+                    const bool keep = cr.contains(x, y) || (step == 1 && x == 0 && y == 0);
+                    if (!keep) px[(std::size_t)y * kW + (std::size_t)x] = prev[(std::size_t)y * kW + (std::size_t)x];
+                }
+            }
+        }
+
+        for (const bool parallel : {false, true}) {
+            core::FrameContext ctx{};
+            ctx.jobs = parallel ? js : nullptr;
+            gfx::PixelCanvas c(kW, kH);
+            gfx::SoftwareRenderer r;
+            r.execute(ctx, q, c);
+            const auto pa = c.pixels();
+            const auto pb = expect.pixels();
+            for (std::size_t i = 0; i < pa.size(); ++i) {
+                if (pa[i] != pb[i]) {
+                    std::printf("clip: mismatch at (%zu,%zu) parallel=%d\n", i % kW, i / kW, (int)parallel);
+                    return false;
+                }
+            }
+        }
+
+        // 같은 스레드에서 다른 큐의 clip push/pop(draw_list_clipped 포함)은 이 큐의 clip을 바꾸지 않는다
+        {
+            gfx::RenderQueue a, b;
+            a.begin_frame();
+            b.begin_frame();
+            const gfx::RectI ra{0, 0, 10, 10};
+            const std::uint16_t pa = a.push_clip(ra);
+            const std::uint16_t pb = b.push_clip(gfx::RectI{5, 5, 50, 50});
+            gfx::DisplayList list;
+            b.draw_list_clipped(list, 0, 0, gfx::RectI{0, 0, 20, 20});
+            if (!a.fill_rect(0, 0, 100, 100, gfx::ColorRGBA8{255, 0, 0, 255})) return false;
+            if (a.clip_rect(a.cmd(a.size() - 1).u1) != ra) return false;
+            b.pop_clip(pb);
+
+            // 빈 clip 범위도 유지된다 (다른 큐의 pop 뒤에도 커맨드가 새지 않는다)
+            const std::uint16_t pe = a.push_clip(gfx::RectI{50, 50, 60, 60});
+            const std::uint16_t pb2 = b.push_clip(gfx::RectI{0, 0, 8, 8});
+            b.pop_clip(pb2);
+            const std::size_t before = a.size();
+            a.fill_rect(0, 0, 100, 100, gfx::ColorRGBA8{255, 0, 0, 255});
+            if (a.size() != before || b.clip() != gfx::RenderQueue::kNoClip) return false;
+            a.pop_clip(pe);
+            a.pop_clip(pa);
+            if (a.clip() != gfx::RenderQueue::kNoClip) return false;
+        }
+
+        // 프레임이 바뀌면 남은 clip 상태는 무시된다
+        q.push_clip(gfx::RectI{0, 0, 1, 1});
+        q.begin_frame();
+        return q.clip() == gfx::RenderQueue::kNoClip;
+    }
+
+    /// @brief 가림 제거 on/off 결과가 같고, 덮인 타일의 앞쪽 커맨드가 건너뛰어지는지
+    bool check_occlusion(core::JobSystem* js) {
+        constexpr int kW = 160, kH = 96;   // 5 x 3 타일
+
+        std::vector<std::uint32_t> opaque(40 * 40, 0x3366CCFFu);
+        std::vector<gfx::Instance> inst, late;
+        for (int i = 0; i < 80; ++i) {
+            inst.push_back(gfx::Instance{(i * 17) % 170 - 5, (i * 5) % 100 - 4,
+                                         gfx::ColorRGBA8{(std::uint8_t)(i * 3), 80, 200, 150}});
+            late.push_back(gfx::Instance{(i * 29) % 165 - 3, (i * 11) % 98 - 2});
+        }
+
+        gfx::RenderQueue q;
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{10, 20, 30, 255});
+        for (int i = 0; i < 40; ++i) q.blend_rect((i * 23) % 150, (i * 13) % 90, 12, 9, gfx::ColorRGBA8{200, 100, 0, 120});
+        q.fill_rect_instanced(inst, 6, 6, gfx::ColorRGBA8{}, true);
+        {
+            // clip 안의 Clear: clip이 덮는 타일(0..63 x 0..31)만 가린다
+            gfx::ClipScope clip(q, gfx::RectI{0, 0, 70, 40});
+            q.clear(gfx::ColorRGBA8{0, 0, 90, 255});
+        }
+        q.fill_rect(64, 32, 64, 64, gfx::ColorRGBA8{0, 120, 0, 255});                       // 타일 (2,1) (3,1) (2,2) (3,2)
+        q.fill_rect(128, 0, 32, 32, gfx::ColorRGBA8{0, 120, 0, 254});                       // 반투명: 가리지 않음
+        q.blit_sprite(0, 32, opaque.data(), 40, 40, 40, gfx::ColorRGBA8{255, 255, 255, 255});   // 타일 (0,1)
+        q.fill_rect_instanced(late, 4, 4, gfx::ColorRGBA8{255, 255, 0, 255}, false);
+        q.text(70, 50, "TOP", gfx::ColorRGBA8{255, 255, 255, 255});
+
+        for (const bool premul : {false, true}) {
+            for (core::JobSystem* j : {(core::JobSystem*)nullptr, js}) {
+                core::FrameContext ctx{};
+                ctx.jobs = j;
+                gfx::PixelCanvas a(kW, kH), b(kW, kH);
+                if (premul) {
+                    a.set_format(gfx::PixelFormat::RGBA8888Premul);
+                    b.set_format(gfx::PixelFormat::RGBA8888Premul);
+                }
+                gfx::SoftwareRenderer on, off;
+                on.set_tile_size(gfx::SoftwareRenderer::kTile);   // 타일 좌표 기대값은 32px 격자 기준
+                off.set_tile_size(gfx::SoftwareRenderer::kTile);
+                off.set_occlusion_culling(false);
+                on.execute(ctx, q, a);
+                off.execute(ctx, q, b);
+
+                const auto pa = a.pixels();
+                const auto pb = b.pixels();
+                for (std::size_t i = 0; i < pa.size(); ++i) {
+                    if (pa[i] != pb[i]) {
+                        std::printf("occlusion: mismatch at (%zu,%zu) premul=%d\n", i % kW, i / kW, (int)premul);
+                        return false;
+                    }
+                }
+
+                const auto& st = on.stats();
+                if (off.stats().culled != 0 || st.bin_entries != off.stats().bin_entries || st.tiles != 15) return false;
+                // 가리는 커맨드가 있는 타일: clip Clear 2개, fill_rect 4개, sprite 1개 (모두 첫 Clear보다 뒤)
+                if (st.occluded_tiles != 7 || st.culled == 0) {
+                    std::printf("occlusion: tiles=%u culled=%u\n", st.occluded_tiles, st.culled);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// @brief 같은 장면을 연속 큐와 paged 큐로 그려 비교 (커맨드 수 > 65536 -> uint32 인덱스 경로)
+    bool check_wide_render() {
+        constexpr std::size_t kCmds = 70000;
+
+        gfx::RenderQueueConfig flat{};
+        flat.max_commands = kCmds + 1;
+        gfx::RenderQueueConfig paged = flat;
+        paged.paged = true;
+
+        gfx::RenderQueue a(flat), b(paged);
+        a.begin_frame();
+        b.begin_frame();
+
+        std::uint32_t rng = 1;
+        for (std::size_t i = 0; i < kCmds; ++i) {
+            rng = rng * 1664525u + 1013904223u;
+            const int x = (int)(rng >> 8) % 96;
+            const int y = (int)(rng >> 16) % 64;
+            const gfx::ColorRGBA8 c{(std::uint8_t)rng, (std::uint8_t)(rng >> 8), (std::uint8_t)(rng >> 16), (std::uint8_t)(rng >> 24)};
+            const std::uint32_t key = gfx::make_sort_key((std::uint8_t)(rng % 3), 0);
+            a.blend_rect(x, y, 5, 4, c, key);
+            b.blend_rect(x, y, 5, 4, c, key);
+        }
+        if (a.size() != kCmds || b.size() != kCmds) return false;
+
+        gfx::PixelCanvas ca(96, 64), cb(96, 64);
+        gfx::SoftwareRenderer ra, rb;
+        ra.execute(a, ca);
+        rb.execute(b, cb);
+
+        const auto pa = ca.pixels();
+        const auto pb = cb.pixels();
+        for (std::size_t i = 0; i < pa.size(); ++i) {
+            if (pa[i] != pb[i]) {
+                std::printf("wide: pixel mismatch at %zu\n", i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_capacity()) return 1;
+    if (!check_paged_mpsc()) return 1;
+    if (!check_worker_segments()) return 1;
+    if (!check_two_job_systems()) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_instanced(nullptr) && check_instanced(js) && check_clip(js) && check_occlusion(js);
+    core::internal::destroy_default_jobsystem(js);
+    if (!ok) return 1;
+
+    if (!check_wide_render()) return 1;
+    return 0;
+}
@@ -0,0 +1,265 @@
+// tests/test_rollback.cpp
+// RollbackBuffer: 링 순환(오래된 프레임 폐기), 공유 pool 버퍼의 소유권 이전 뒤에도 모든 보관 프레임이 정확히 복원되는지,
+// 기본 세트(Sprite2D/Text2D 포함)와 세트 밖 컴포넌트 제거, RunLoop 재시뮬레이션 경로
+// (resimulating 플래그, render_queue 없음, 재시뮬레이션 프레임 재capture)를 확인한다.
+#include <framedot/app/RunLoop.hpp>
+#include <framedot/ecs/Fecs.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    /// @brief 세트 밖 유저 컴포넌트
+    struct Marker {
+        std::uint32_t v{0};
+    };
+
+    /// @brief frame마다 정해지는 상태: Transform2D.x = f, Rect2D 색은 3프레임마다 바뀐다
+    /// (링 용량 3과 맞춰, 공유 버퍼의 소유 슬롯이 덮이는 capture에서 값이 바뀐다)
+    void apply_state(fecs::Registry& reg, fecs::Entity e, std::uint64_t f) {
+        reg.get<fecs::Transform2D>(e).position.x = (float)f;
+        reg.get<fecs::Rect2D>(e).color.r = (std::uint8_t)(f / 3);
+    }
+
+    bool has_state(const fecs::Registry& reg, fecs::Entity e, std::uint64_t f) {
+        return reg.valid(e) && reg.get<fecs::Transform2D>(e).position.x == (float)f
+            && reg.get<fecs::Rect2D>(e).color.r == (std::uint8_t)(f / 3);
+    }
+
+    /// @brief 링 순환 + 매 capture 뒤 보관 중인 모든 프레임 복원 (공유 버퍼 소유권 이전 검증)
+    bool check_ring() {
+        fecs::Registry reg;
+        const auto e = reg.create();
+        reg.emplace<fecs::Transform2D>(e);
+        reg.emplace<fecs::Rect2D>(e);
+        fecs::RollbackBuffer rb(reg, 3);
+        if (rb.capacity() != 3) return false;
+
+        for (std::uint64_t f = 0; f < 10; ++f) {
+            apply_state(reg, e, f);
+            rb.capture(f);
+
+            for (std::uint64_t g = (f >= 2) ? f - 2 : 0; g <= f; ++g) {
+                if (!rb.contains(g) || !rb.restore(g) || !has_state(reg, e, g)) {
+                    std::printf("ring: frame %llu lost after capture %llu\n", (unsigned long long)g, (unsigned long long)f);
+                    return false;
+                }
+            }
+            if (f >= 3 && rb.contains(f - 3)) return false;
+            if (!rb.restore(f)) return false;
+        }
+
+        std::uint64_t oldest = 0;
+        if (!rb.oldest_frame(oldest) || oldest != 7) return false;
+
+        // 보관하지 않은 프레임은 거부하고 registry를 건드리지 않는다
+        reg.emplace<fecs::Velocity2D>(e);
+        if (rb.restore(6) || rb.restore(10) || !reg.all_of<fecs::Velocity2D>(e)) return false;
+
+        // 바뀌지 않은 pool은 한 벌만 보관된다: entity 테이블 1, Rect2D 2 (7/8 공유, 9), Transform2D 3
+        using ecs::snapshot_detail::entity_plan;
+        using ecs::snapshot_detail::pool_plan;
+        reg.remove<fecs::Velocity2D>(e);
+        const std::size_t want = entity_plan(reg).bytes + 2 * pool_plan<fecs::Rect2D>(reg).bytes
+                               + 3 * pool_plan<fecs::Transform2D>(reg).bytes;
+        if (rb.resident_bytes() != want) {
+            std::printf("ring: resident %zu, want %zu\n", rb.resident_bytes(), want);
+            return false;
+        }
+
+        rb.clear();
+        return !rb.contains(9) && !rb.oldest_frame(oldest) && rb.resident_bytes() == 0;
+    }
+
+    /// @brief 생성/파괴가 섞인 프레임 복원: entity 식별자와 다음 create() id가 그대로
+    bool check_structure() {
+        fecs::Registry reg;
+        fecs::RollbackBuffer rb(reg, 4);
+        std::vector<fecs::Entity> ents;
+        for (int i = 0; i < 6; ++i) {
+            ents.push_back(reg.create());
+            reg.emplace<fecs::Transform2D>(ents.back());
+        }
+        rb.capture(0);
+
+        reg.destroy(ents[2]);
+        const auto spawned = reg.create();
+        reg.emplace<fecs::Velocity2D>(spawned);
+        rb.capture(1);
+        const auto next_at_1 = reg.create();
+
+        if (!rb.restore(0) || !reg.valid(ents[2]) || reg.storage<fecs::Velocity2D>().size() != 0) return false;
+        if (!rb.restore(1) || reg.valid(ents[2]) || !reg.valid(spawned) || !reg.all_of<fecs::Velocity2D>(spawned)) return false;
+        return reg.create() == next_at_1;
+    }
+
+    /// @brief 기본 세트는 Sprite2D/Text2D를 보존하고, 세트 밖 컴포넌트는 restore에서 사라진다
+    bool check_default_set() {
+        static const std::uint32_t pixels[4] = {1, 2, 3, 4};
+
+        fecs::Registry reg;
+        const auto e = reg.create();
+        fecs::Sprite2D sp{};
+        sp.pixels = pixels;
+        sp.width = 2;
+        sp.height = 2;
+        sp.stride_pixels = 2;
+        reg.emplace<fecs::Sprite2D>(e, sp);
+        fecs::Text2D tx{};
+        tx.text[0] = 'h';
+        tx.text[1] = 'i';
+        tx.len = 2;
+        reg.emplace<fecs::Text2D>(e, tx);
+        reg.emplace<Marker>(e, Marker{5});
+
+        fecs::RollbackBuffer rb(reg, 2);
+        rb.capture(0);
+        reg.get<fecs::Text2D>(e).len = 0;
+        reg.remove<fecs::Sprite2D>(e);
+
+        if (!rb.restore(0)) return false;
+        const auto* s = reg.try_get<fecs::Sprite2D>(e);
+        const auto* t = reg.try_get<fecs::Text2D>(e);
+        return s && s->pixels == pixels && s->width == 2 && t && t->len == 2 && t->text[1] == 'i'
+            && !reg.all_of<Marker>(e);
+    }
+
+    // ----------------------------
+    // RunLoop 재시뮬레이션
+    // ----------------------------
+
+    class NullSurface final : public rhi::Surface {
+    public:
+        using rhi::Surface::present;
+        void present(const gfx::PixelFrame&) override {}
+    };
+
+    /// @brief frame 2의 입력(속도 변경)이 tick 6에야 도착하는 클라이언트
+    class LateInputClient final : public app::Client {
+    public:
+        struct Call {
+            std::uint64_t frame;
+            bool resimulating;
+            bool has_queue;
+        };
+
+        LateInputClient() : rb(world.registry(), 8) {
+            fecs::systems::install_movement_2d(world);
+            e = world.registry().create();
+            world.registry().emplace<fecs::Transform2D>(e);
+            world.registry().emplace<fecs::Velocity2D>(e, math::Vec2f{1.0f, 0.0f});
+        }
+
+        bool update(const core::FrameContext& ctx) override {
+            calls.push_back(Call{ctx.frame_index, ctx.resimulating, ctx.render_queue != nullptr});
+            step(world.registry(), ctx.frame_index, input_known);
+            world.tick(ctx);
+            return true;
+        }
+
+        void render_prep(const core::FrameContext& ctx, gfx::RenderQueue&) override {
+            rendered.push_back(ctx.frame_index);
+        }
+
+        ecs::RollbackBuffer* rollback() override { return &rb; }
+
+        bool rollback_target(const core::FrameContext& ctx, std::uint64_t& frame) override {
+            if (ctx.frame_index != 6 || input_known) return false;
+            input_known = true;
+            frame = 2;
+            return true;
+        }
+
+        /// @brief frame 2 입력: 속도 변경
+        static void step(fecs::Registry& reg, std::uint64_t frame, bool known) {
+            if (frame == 2 && known) {
+                for (auto [ent, v] : reg.view<fecs::Velocity2D>().each()) {
+                    (void)ent;
+                    v.v.x = 10.0f;
+                }
+            }
+        }
+
+        fecs::World world;
+        ecs::RollbackBuffer rb;
+        fecs::Entity e{fecs::null};
+        bool input_known{false};
+        std::vector<Call> calls;
+        std::vector<std::uint64_t> rendered;
+    };
+
+    bool check_run_loop() {
+        constexpr std::uint64_t kFrames = 10;
+
+        // 기준: 입력을 처음부터 알고 있는 경우의 프레임 시작 위치
+        std::vector<float> want_x;
+        {
+            fecs::World w;
+            fecs::systems::install_movement_2d(w);
+            const auto e = w.registry().create();
+            w.registry().emplace<fecs::Transform2D>(e);
+            w.registry().emplace<fecs::Velocity2D>(e, math::Vec2f{1.0f, 0.0f});
+            core::FrameContext ctx{};
+            ctx.dt_seconds = 1.0 / 60.0;
+            for (std::uint64_t f = 0; f <= kFrames; ++f) {
+                want_x.push_back(w.registry().get<fecs::Transform2D>(e).position.x);
+                ctx.frame_index = f;
+                LateInputClient::step(w.registry(), f, true);
+                w.tick(ctx);
+            }
+        }
+
+        LateInputClient client;
+        gfx::PixelCanvas canvas(16, 16);
+        NullSurface surface;
+        app::RunLoopConfig cfg{};
+        cfg.fixed_timestep = true;
+        cfg.max_frames = kFrames;
+        cfg.worker_threads = 1;
+        if (app::run(client, canvas, surface, cfg) != 0) return false;
+
+        // 호출 순서: 0..5, (재시뮬레이션 2..5), 6..9
+        std::vector<LateInputClient::Call> want;
+        for (std::uint64_t f = 0; f < 6; ++f) want.push_back({f, false, f > 0});
+        for (std::uint64_t f = 2; f < 6; ++f) want.push_back({f, true, false});
+        for (std::uint64_t f = 6; f < kFrames; ++f) want.push_back({f, false, true});
+        if (client.calls.size() != want.size()) return false;
+        for (std::size_t i = 0; i < want.size(); ++i) {
+            const auto& c = client.calls[i];
+            if (c.frame != want[i].frame || c.resimulating != want[i].resimulating || c.has_queue != want[i].has_queue) {
+                std::printf("run_loop: call %zu frame=%llu resim=%d queue=%d\n", i,
+                            (unsigned long long)c.frame, (int)c.resimulating, (int)c.has_queue);
+                return false;
+            }
+        }
+        if (client.rendered.size() != kFrames) return false;   // 재시뮬레이션은 그리지 않는다
+
+        auto& reg = client.world.registry();
+        if (reg.get<fecs::Transform2D>(client.e).position.x != want_x[kFrames]) {
+            std::printf("run_loop: final state diverged\n");
+            return false;
+        }
+
+        // 재시뮬레이션한 프레임(3..5)도 수정된 상태로 다시 capture되어 있어야 한다
+        for (std::uint64_t f = 2; f < kFrames; ++f) {
+            if (!client.rb.restore(f) || reg.get<fecs::Transform2D>(client.e).position.x != want_x[f]) {
+                std::printf("run_loop: ring frame %llu holds stale state\n", (unsigned long long)f);
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_ring()) return 1;
+    if (!check_structure()) return 1;
+    if (!check_default_set()) return 1;
+    if (!check_run_loop()) return 1;
+    return 0;
+}
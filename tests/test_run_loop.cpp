@@ -0,0 +1,91 @@
+// tests/test_run_loop.cpp
+// RunLoop: 래스터가 루프의 FrameContext(잡 시스템)로 실행되어 병렬 타일 경로를 타는지(fixed/가변 timestep 모두),
+// 결과 픽셀이 순차 실행과 같은지 확인한다.
+#include <framedot/app/RunLoop.hpp>
+#include <framedot/gfx/PixelCanvas.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    constexpr int kW = 256, kH = 192;
+
+    void record_scene(gfx::RenderQueue& rq) {
+        rq.clear(gfx::ColorRGBA8{10, 20, 30, 255});
+        for (int i = 0; i < 400; ++i) {
+            rq.blend_rect((i * 37) % kW - 8, (i * 23) % kH - 8, 24, 18,
+                          gfx::ColorRGBA8{(std::uint8_t)(i * 5), 120, (std::uint8_t)(255 - i), 140},
+                          (std::uint32_t)(i % 17));
+        }
+    }
+
+    class CaptureSurface final : public rhi::Surface {
+    public:
+        using rhi::Surface::present;
+        void present(const gfx::PixelFrame& f) override { last.assign(f.pixels.begin(), f.pixels.end()); }
+
+        std::vector<std::uint32_t> last;
+    };
+
+    class SceneClient final : public app::Client {
+    public:
+        bool update(const core::FrameContext&) override { return true; }
+
+        void render_prep(const core::FrameContext&, gfx::RenderQueue& rq) override { record_scene(rq); }
+
+        void on_render_profile(const core::FrameContext& ctx, const gfx::SoftwareRenderer& r) override {
+            ++frames;
+            if (ctx.jobs && ctx.jobs->worker_count() > 0 && r.stats().jobs == 0) serial_frames++;
+        }
+
+        int frames{0};
+        int serial_frames{0};
+    };
+
+    bool check(bool fixed) {
+        SceneClient client;
+        gfx::PixelCanvas canvas(kW, kH);
+        CaptureSurface surface;
+        app::RunLoopConfig cfg{};
+        cfg.fixed_timestep = fixed;
+        cfg.max_frames = 3;
+        cfg.worker_threads = 4;
+        cfg.render_profile = true;
+        if (app::run(client, canvas, surface, cfg) != 0) return false;
+
+        if (client.frames != 3 || client.serial_frames != 0) {
+            std::printf("run_loop(fixed=%d): frames=%d serial=%d\n", (int)fixed, client.frames, client.serial_frames);
+            return false;
+        }
+
+        // 기대값: 같은 장면을 순차로
+        gfx::RenderQueue rq;
+        rq.begin_frame();
+        record_scene(rq);
+        gfx::PixelCanvas expect(kW, kH);
+        gfx::SoftwareRenderer sw;
+        sw.execute(rq, expect);
+        const auto px = expect.pixels();
+        if (surface.last.size() != px.size()) return false;
+        for (std::size_t i = 0; i < px.size(); ++i) {
+            if (surface.last[i] != px[i]) {
+                std::printf("run_loop(fixed=%d): mismatch at (%zu,%zu)\n", (int)fixed, i % kW, i / kW);
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check(true)) return 1;
+    if (!check(false)) return 1;
+    return 0;
+}
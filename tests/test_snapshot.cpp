@@ -0,0 +1,348 @@
+// tests/test_snapshot.cpp
+// Snapshot: full 왕복(entity 식별자/버전/free list 포함), delta 인코딩(Full/Patch/Same)과 재구성,
+// 잘리거나 정렬이 어긋난 버퍼와 손상된 섹션 테이블/식별자(중복, 사용 중이 아닌 entity) 거부, 컴포넌트 크기가 다를 때 registry를 건드리지 않는지 확인한다.
+#include <framedot/ecs/Fecs.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace framedot;
+using ecs::SnapshotSection;
+using ecs::SnapshotSectionKind;
+using Bytes = std::vector<std::byte>;
+
+namespace {
+
+    /// @brief 파괴/재사용으로 버전과 free list가 섞인 registry
+    void populate(fecs::Registry& reg, std::vector<fecs::Entity>& live) {
+        std::vector<fecs::Entity> all;
+        for (int i = 0; i < 120; ++i) all.push_back(reg.create());
+        for (std::size_t i = 0; i < all.size(); i += 7) reg.destroy(all[i]);
+        for (int i = 0; i < 5; ++i) all.push_back(reg.create());   // 재사용 (버전 증가)
+
+        live.clear();
+        for (const auto e : all) {
+            if (reg.valid(e)) live.push_back(e);
+        }
+
+        for (std::size_t i = 0; i < live.size(); ++i) {
+            const auto e = live[i];
+            fecs::Transform2D t{};
+            t.position = math::Vec2f{(float)i, (float)(i * 3)};
+            t.rotation_rad = 0.01f * (float)i;
+            reg.emplace<fecs::Transform2D>(e, t);
+            if (i % 2 == 0) reg.emplace<fecs::Velocity2D>(e, math::Vec2f{1.0f, (float)i});
+            if (i % 3 == 0) {
+                fecs::Rect2D r{};
+                r.color = gfx::ColorRGBA8{(std::uint8_t)i, 2, 3, 255};
+                reg.emplace<fecs::Rect2D>(e, r);
+            }
+            if (i % 5 == 0) reg.emplace<fecs::RenderOrder2D>(e, (std::uint32_t)(1000 - i));
+        }
+        fecs::systems::attach_child(reg, live[0], live[1]);
+        fecs::systems::attach_child(reg, live[0], live[2]);
+    }
+
+    /// @brief 패딩이 없는 타입은 바이트 비교, 패딩이 있는 타입은 필드 비교
+    template <class T>
+    bool same_value(const T& a, const T& b) { return std::memcmp(&a, &b, sizeof(T)) == 0; }
+
+    bool same_value(const fecs::Rect2D& a, const fecs::Rect2D& b) {
+        return a.size.x == b.size.x && a.size.y == b.size.y && a.outline_px == b.outline_px
+            && std::memcmp(&a.color, &b.color, sizeof(a.color)) == 0;
+    }
+
+    bool same_value(const fecs::WorldTransform2D& a, const fecs::WorldTransform2D& b) {
+        return std::memcmp(a.world.m, b.world.m, sizeof(a.world.m)) == 0 && same_value(a.local, b.local)
+            && a.revision == b.revision && a.parent_revision == b.parent_revision && a.dirty == b.dirty;
+    }
+
+    template <class T>
+    bool same_pool(const fecs::Registry& a, const fecs::Registry& b, const std::vector<fecs::Entity>& live) {
+        for (const auto e : live) {
+            const T* x = a.try_get<T>(e);
+            const T* y = b.try_get<T>(e);
+            if (!x != !y) return false;
+            if (x && !same_value(*x, *y)) return false;
+        }
+        return true;
+    }
+
+    bool same_entities(const fecs::Registry& a, const fecs::Registry& b) {
+        const auto* sa = a.storage<entt::entity>();
+        const auto* sb = b.storage<entt::entity>();
+        return sa->size() == sb->size() && sa->free_list() == sb->free_list()
+            && std::memcmp(sa->data(), sb->data(), sa->size() * sizeof(entt::entity)) == 0;
+    }
+
+    /// @brief full 왕복: 식별자/버전/free list와 모든 pool이 같고, 다음 create()도 같은 id
+    bool check_roundtrip() {
+        fecs::Registry reg;
+        std::vector<fecs::Entity> live;
+        populate(reg, live);
+
+        Bytes buf;
+        const std::size_t n = fecs::write_snapshot(reg, buf, 42, fecs::BasicSnapshot2D{});
+        fecs::SnapshotView view;
+        if (n != buf.size() || !fecs::SnapshotView::parse(buf, view) || view.frame() != 42 || view.is_delta()) return false;
+
+        fecs::Registry out;
+        for (int i = 0; i < 300; ++i) out.emplace<fecs::Velocity2D>(out.create());   // 복원 시 비워져야 한다
+        if (!fecs::restore_snapshot(out, view, fecs::BasicSnapshot2D{})) return false;
+
+        if (!same_entities(reg, out)) {
+            std::printf("roundtrip: entity table differs\n");
+            return false;
+        }
+        for (const auto e : live) {
+            if (!out.valid(e)) return false;
+        }
+        const bool pools = same_pool<fecs::Transform2D>(reg, out, live) && same_pool<fecs::Velocity2D>(reg, out, live)
+            && same_pool<fecs::Rect2D>(reg, out, live) && same_pool<fecs::RenderOrder2D>(reg, out, live)
+            && same_pool<fecs::Parent2D>(reg, out, live) && same_pool<fecs::Children2D>(reg, out, live)
+            && same_pool<fecs::WorldTransform2D>(reg, out, live);
+        if (!pools || out.storage<fecs::Velocity2D>().size() != reg.storage<fecs::Velocity2D>().size()) {
+            std::printf("roundtrip: pools differ\n");
+            return false;
+        }
+        return reg.create() == out.create();
+    }
+
+    const SnapshotSection* section_of(const fecs::SnapshotView& v, std::uint32_t id) {
+        return v.find(id);
+    }
+
+    /// @brief delta: 바뀐 pool은 Patch, 개수가 바뀐 pool은 Full, 그대로면 Same. base + delta == cur (바이트 단위)
+    bool check_delta() {
+        using ecs::snapshot_detail::type_id;
+
+        fecs::Registry reg;
+        std::vector<fecs::Entity> live;
+        populate(reg, live);
+
+        Bytes base_buf, cur_buf, delta_buf, rebuilt;
+        fecs::write_snapshot(reg, base_buf, 1, fecs::BasicSnapshot2D{});
+
+        reg.get<fecs::Transform2D>(live[10]).position.x = -1.0f;
+        reg.emplace<fecs::Velocity2D>(live[1], math::Vec2f{5.0f, 5.0f});
+        fecs::write_snapshot(reg, cur_buf, 2, fecs::BasicSnapshot2D{});
+
+        fecs::SnapshotView base, cur, delta, full;
+        if (!fecs::SnapshotView::parse(base_buf, base) || !fecs::SnapshotView::parse(cur_buf, cur)) return false;
+        if (!fecs::write_snapshot_delta(base, cur, delta_buf) || !fecs::SnapshotView::parse(delta_buf, delta)) return false;
+        if (!delta.is_delta() || delta_buf.size() >= cur_buf.size()) return false;
+
+        const SnapshotSection* st = section_of(delta, type_id<fecs::Transform2D>());
+        const SnapshotSection* sv = section_of(delta, type_id<fecs::Velocity2D>());
+        const SnapshotSection* sr = section_of(delta, type_id<fecs::Rect2D>());
+        const SnapshotSection* se = section_of(delta, ecs::kSnapshotEntitySection);
+        if (!st || !sv || !sr || !se || st->kind != SnapshotSectionKind::Patch || sv->kind != SnapshotSectionKind::Full
+            || sr->kind != SnapshotSectionKind::Same || se->kind != SnapshotSectionKind::Same) {
+            std::printf("delta: unexpected section kinds\n");
+            return false;
+        }
+
+        if (!fecs::apply_snapshot_delta(base, delta, rebuilt) || rebuilt != cur_buf) {
+            std::printf("delta: rebuilt snapshot differs\n");
+            return false;
+        }
+        if (!fecs::SnapshotView::parse(rebuilt, full)) return false;
+
+        // delta 자체로는 복원할 수 없고, 다른 base에는 적용되지 않는다
+        fecs::Registry out;
+        if (fecs::restore_snapshot(out, delta, fecs::BasicSnapshot2D{})) return false;
+        if (fecs::apply_snapshot_delta(cur, delta, rebuilt)) return false;
+        return fecs::restore_snapshot(out, full, fecs::BasicSnapshot2D{}) && same_entities(reg, out)
+            && same_pool<fecs::Transform2D>(reg, out, live) && same_pool<fecs::Velocity2D>(reg, out, live);
+    }
+
+    /// @brief 섹션 i를 고친 사본
+    Bytes patched(const Bytes& src, std::size_t i, const std::function<void(SnapshotSection&)>& fn) {
+        Bytes b = src;
+        SnapshotSection s{};
+        const std::size_t at = sizeof(ecs::SnapshotHeader) + i * sizeof(SnapshotSection);
+        std::memcpy(&s, b.data() + at, sizeof(s));
+        fn(s);
+        std::memcpy(b.data() + at, &s, sizeof(s));
+        return b;
+    }
+
+    bool rejects(const Bytes& b, const char* name) {
+        fecs::SnapshotView v;
+        if (!fecs::SnapshotView::parse(b, v) && !v.valid()) return true;
+        std::printf("reject: accepted %s\n", name);
+        return false;
+    }
+
+    /// @brief 잘린/비정렬 버퍼, 손상된 섹션 테이블 거부
+    bool check_reject() {
+        fecs::Registry reg;
+        std::vector<fecs::Entity> live;
+        populate(reg, live);
+
+        Bytes buf, cur, delta;
+        fecs::write_snapshot(reg, buf, 7, fecs::BasicSnapshot2D{});
+        reg.get<fecs::Transform2D>(live[3]).scale.x = 2.0f;
+        fecs::write_snapshot(reg, cur, 8, fecs::BasicSnapshot2D{});
+
+        fecs::SnapshotView vb, vc, v;
+        if (!fecs::SnapshotView::parse(buf, vb) || !fecs::SnapshotView::parse(cur, vc)) return false;
+        if (!fecs::write_snapshot_delta(vb, vc, delta)) return false;
+
+        // 잘린 버퍼 (full/delta 모두, 모든 길이)
+        for (const Bytes* b : {&buf, &delta}) {
+            for (std::size_t len = 0; len < b->size(); ++len) {
+                if (fecs::SnapshotView::parse(std::span<const std::byte>(b->data(), len), v)) {
+                    std::printf("reject: truncated %zu/%zu accepted\n", len, b->size());
+                    return false;
+                }
+            }
+        }
+
+        // 16바이트 정렬이 아닌 시작 주소
+        Bytes shifted(buf.size() + 16);
+        std::memcpy(shifted.data() + 8, buf.data(), buf.size());
+        if (fecs::SnapshotView::parse(std::span<const std::byte>(shifted.data() + 8, buf.size()), v)) return false;
+
+        // 섹션 테이블 손상 (i=0: entity, i=1: Transform2D)
+        const std::size_t tr = 1;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.bytes = 0; s.offset = 0; }), "empty non-empty pool")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.offset += 8; }), "misaligned offset")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.offset = 16; }), "offset inside table")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.count += 1; }), "count/bytes mismatch")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.count = ~0ull / s.elem_size + 1; }), "overflowing count")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.elem_size = 0; }), "zero elem_size")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.kind = SnapshotSectionKind::Same; }), "Same in full")) return false;
+        if (!rejects(patched(buf, tr, [](SnapshotSection& s) { s.kind = (SnapshotSectionKind)7; }), "unknown kind")) return false;
+        if (!rejects(patched(buf, 0, [](SnapshotSection& s) { s.aux = (std::uint32_t)s.count + 1; }), "free_list > count")) return false;
+
+        // 빈 pool 섹션(Velocity2D가 없는 registry)에 offset만 남은 경우
+        fecs::Registry small;
+        small.emplace<fecs::Transform2D>(small.create());
+        Bytes sb;
+        fecs::write_snapshot(small, sb, 0, fecs::BasicSnapshot2D{});
+        if (!fecs::SnapshotView::parse(sb, v)) return false;
+        if (!rejects(patched(sb, 2, [&](SnapshotSection& s) { s.offset = 64; }), "stray offset")) return false;
+
+        // delta: Same인데 데이터가 있거나 Patch인데 데이터가 없는 경우
+        fecs::SnapshotView vd;
+        if (!fecs::SnapshotView::parse(delta, vd)) return false;
+        for (std::size_t i = 0; i < vd.sections().size(); ++i) {
+            const SnapshotSection& s = vd.sections()[i];
+            if (s.kind == SnapshotSectionKind::Same) {
+                const SnapshotSection& p = vd.sections()[tr];   // Transform2D는 Patch
+                if (!rejects(patched(delta, i, [&](SnapshotSection& x) { x.offset = p.offset; x.bytes = 16; }), "Same with data")) return false;
+            } else if (s.kind == SnapshotSectionKind::Patch) {
+                if (!rejects(patched(delta, i, [](SnapshotSection& x) { x.bytes = 0; x.offset = 0; }), "empty Patch")) return false;
+            }
+        }
+        return fecs::SnapshotView::parse(buf, v);
+    }
+
+    /// @brief 섹션 i의 식별자 배열을 fn으로 고친 사본
+    Bytes patched_ids(const Bytes& src, std::size_t i, const std::function<void(entt::entity*, std::size_t)>& fn) {
+        Bytes b = src;
+        SnapshotSection s{};
+        std::memcpy(&s, b.data() + sizeof(ecs::SnapshotHeader) + i * sizeof(SnapshotSection), sizeof(s));
+        fn(reinterpret_cast<entt::entity*>(b.data() + s.offset), (std::size_t)s.count);
+        return b;
+    }
+
+    /// @brief 형식은 맞지만 식별자가 손상된 스냅샷: parse는 통과, restore는 거부하고 registry를 건드리지 않는다
+    bool check_reject_ids() {
+        fecs::Registry reg;
+        std::vector<fecs::Entity> live;
+        populate(reg, live);
+
+        Bytes buf;
+        fecs::write_snapshot(reg, buf, 7, fecs::BasicSnapshot2D{});
+        const auto* st = std::as_const(reg).storage<entt::entity>();
+        const std::size_t in_use = st->free_list();
+        if (in_use >= st->size()) return false;   // populate는 free list를 남긴다
+        const entt::entity released = st->data()[in_use];
+
+        auto restore_rejects = [](const Bytes& b, const char* name) {
+            fecs::SnapshotView v;
+            if (!fecs::SnapshotView::parse(b, v)) {
+                std::printf("reject ids: %s failed to parse\n", name);
+                return false;
+            }
+            fecs::Registry dst;
+            const auto keep = dst.create();
+            dst.emplace<fecs::Velocity2D>(keep, math::Vec2f{4.0f, 5.0f});
+            if (fecs::restore_snapshot(dst, v, fecs::BasicSnapshot2D{}) || !dst.valid(keep)
+                || dst.get<fecs::Velocity2D>(keep).v.y != 5.0f || dst.storage<fecs::Transform2D>().size() != 0) {
+                std::printf("reject ids: accepted %s\n", name);
+                return false;
+            }
+            return true;
+        };
+
+        // entity 테이블만 있는 스냅샷 (pool 검사에 가려지지 않게)
+        fecs::Registry bare_reg;
+        for (int i = 0; i < 8; ++i) bare_reg.create();
+        bare_reg.destroy(entt::entity{6u});
+        Bytes bare;
+        fecs::write_snapshot(bare_reg, bare, 0, fecs::BasicSnapshot2D{});
+        if (!restore_rejects(patched_ids(bare, 0, [](entt::entity* ids, std::size_t) { ids[3] = ids[5]; }), "duplicate entity")) return false;
+        if (!restore_rejects(patched_ids(bare, 0, [](entt::entity* ids, std::size_t n) {
+                ids[n - 1] = entt::entity{(std::uint32_t)entt::to_integral(ids[2]) + (1u << 20)};   // 같은 인덱스, 다른 버전
+            }), "duplicate entity index")) return false;
+        if (!restore_rejects(patched_ids(bare, 0, [](entt::entity* ids, std::size_t) { ids[4] = entt::null; }), "null entity")) return false;
+
+        // i=0: entity 테이블, i=1: Transform2D
+        const std::size_t tr = 1;
+        if (!restore_rejects(patched_ids(buf, tr, [](entt::entity* ids, std::size_t) { ids[1] = ids[0]; }), "duplicate component id")) return false;
+        if (!restore_rejects(patched_ids(buf, tr, [&](entt::entity* ids, std::size_t) { ids[0] = released; }), "released entity id")) return false;
+        if (!restore_rejects(patched_ids(buf, tr, [](entt::entity* ids, std::size_t) {
+                ids[0] = entt::entity{(std::uint32_t)entt::to_integral(ids[0]) + (1u << 20)};   // 버전만 다름
+            }), "stale version")) return false;
+        if (!restore_rejects(patched_ids(buf, tr, [](entt::entity* ids, std::size_t) { ids[0] = entt::entity{0xFFFFEu}; }), "unknown entity")) return false;
+
+        // 손대지 않은 버퍼는 그대로 복원된다 (검증 비트가 남지 않는다)
+        fecs::SnapshotView v;
+        fecs::Registry dst;
+        return fecs::SnapshotView::parse(buf, v) && fecs::restore_snapshot(dst, v, fecs::BasicSnapshot2D{})
+            && same_entities(reg, dst) && same_pool<fecs::Transform2D>(reg, dst, live);
+    }
+
+    struct PointV1 { float x; };
+    struct PointV2 { float x, y; };
+
+    /// @brief 같은 type_id인데 크기가 다르면 복원을 거부하고 registry를 건드리지 않는다
+    bool check_size_mismatch() {
+        using ecs::snapshot_detail::type_id;
+
+        fecs::Registry src;
+        for (int i = 0; i < 10; ++i) src.emplace<PointV1>(src.create(), PointV1{(float)i});
+
+        Bytes buf;
+        fecs::write_snapshot(src, buf, 3, fecs::SnapshotComponents<PointV1>{});
+        // 다른 빌드에서 같은 이름의 타입 레이아웃이 바뀐 상황을 흉내낸다
+        buf = patched(buf, 1, [](SnapshotSection& s) { s.type_id = type_id<PointV2>(); });
+
+        fecs::SnapshotView v;
+        if (!fecs::SnapshotView::parse(buf, v)) return false;
+
+        fecs::Registry dst;
+        const auto keep = dst.create();
+        dst.emplace<PointV2>(keep, PointV2{1.0f, 2.0f});
+        if (fecs::restore_snapshot(dst, v, fecs::SnapshotComponents<PointV2>{})) return false;
+        return dst.valid(keep) && dst.get<PointV2>(keep).y == 2.0f && dst.storage<PointV2>().size() == 1;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_roundtrip()) return 1;
+    if (!check_delta()) return 1;
+    if (!check_reject()) return 1;
+    if (!check_reject_ids()) return 1;
+    if (!check_size_mismatch()) return 1;
+    return 0;
+}
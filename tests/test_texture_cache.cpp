@@ -0,0 +1,205 @@
+// tests/test_texture_cache.cpp
+// TextureCache: 아틀라스 배치(겹침 없음, 전용 페이지), handle 세대, 분류/premultiplied 사본,
+// blit_texture*가 같은 픽셀의 blit_sprite*와 같은 결과인지, update()가 dirty 추적에 반영되는지 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/gfx/TextureCache.hpp>
+#include <framedot/math/Types.hpp>
+#include <framedot_internal/gfx/RasterKernels.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    constexpr int kW = 96, kH = 64;
+
+    std::vector<std::uint32_t> make_image(int w, int h, std::uint32_t seed, bool translucent) {
+        std::vector<std::uint32_t> s((std::size_t)w * (std::size_t)h);
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            const std::uint32_t v = (std::uint32_t)i * 2654435761u + seed * 40503u;
+            s[i] = (v & 0xFFFFFF00u) | (translucent ? (v >> 8 & 0xFFu) : 0xFFu);
+        }
+        return s;
+    }
+
+    bool check_packing() {
+        gfx::TextureCacheConfig cfg{};
+        cfg.page_size = 64;
+        cfg.max_packed = 32;
+        gfx::TextureCache tc(cfg);
+
+        // 행 간격이 폭보다 큰 소스도 복사된다
+        std::vector<std::vector<std::uint32_t>> src;
+        std::vector<gfx::TextureHandle> hs;
+        for (int i = 0; i < 12; ++i) {
+            const int w = 8 + (i % 3) * 4, h = 6 + (i % 4) * 3;
+            src.push_back(make_image(w + 2, h, (std::uint32_t)i, i % 2 == 0));
+            hs.push_back(tc.add(src.back().data(), w, h, (std::uint32_t)w + 2u));
+            if (!hs.back()) return false;
+        }
+        if (tc.size() != 12 || tc.page_count() != 1) return false;
+
+        for (std::size_t i = 0; i < hs.size(); ++i) {
+            const gfx::Texture* t = tc.get(hs[i]);
+            if (!t || t->stride != 64u) return false;
+            for (int y = 0; y < t->h; ++y) {
+                for (int x = 0; x < t->w; ++x) {
+                    if (t->pixels[(std::size_t)y * t->stride + (std::size_t)x] != src[i][(std::size_t)y * (std::size_t)(t->w + 2) + (std::size_t)x]) return false;
+                }
+            }
+            // 같은 페이지 안에서 겹치지 않는다
+            for (std::size_t j = 0; j < i; ++j) {
+                const gfx::Texture* o = tc.get(hs[j]);
+                const bool overlap = t->page == o->page && t->x < o->x + o->w && o->x < t->x + t->w
+                                     && t->y < o->y + o->h && o->y < t->y + t->h;
+                if (overlap) return false;
+            }
+            if (t->x + t->w > 64 || t->y + t->h > 64) return false;
+        }
+
+        // 큰 이미지는 전용 페이지, 제거하면 해제
+        const std::vector<std::uint32_t> big = make_image(100, 10, 99, false);
+        const gfx::TextureHandle hb = tc.add(big.data(), 100, 10, 100);
+        if (!hb || tc.page_count() != 2 || tc.get(hb)->stride != 100u) return false;
+        tc.remove(hb);
+        if (tc.page_count() != 1 || tc.get(hb)) return false;
+
+        // 오래된 handle은 재사용된 슬롯을 가리키지 않는다
+        tc.remove(hs[3]);
+        const gfx::TextureHandle again = tc.add(src[0].data(), 4, 4, 4);
+        if (!again || again.index != hs[3].index || again == hs[3] || tc.get(hs[3])) return false;
+
+        // 잘못된 입력
+        if (tc.add(nullptr, 4, 4, 4) || tc.add(src[0].data(), 4, 4, 3) || tc.add(src[0].data(), 0, 4, 4)) return false;
+
+        tc.clear();
+        return tc.size() == 0 && tc.page_count() == 0 && !tc.get(again);
+    }
+
+    bool check_classify() {
+        gfx::TextureCache tc;
+        const std::vector<std::uint32_t> opaque = make_image(5, 5, 1, false);
+        std::vector<std::uint32_t> binary = opaque;
+        binary[3] &= 0xFFFFFF00u;
+        const std::vector<std::uint32_t> soft = make_image(5, 5, 2, true);
+
+        const gfx::Texture* o = tc.get(tc.add(opaque.data(), 5, 5, 5));
+        const gfx::Texture* b = tc.get(tc.add(binary.data(), 5, 5, 5));
+        const gfx::Texture* s = tc.get(tc.add(soft.data(), 5, 5, 5));
+        if (o->alpha != gfx::TextureAlpha::Opaque || o->premul != o->pixels) return false;
+        if (b->alpha != gfx::TextureAlpha::Binary) return false;
+        if (s->alpha != gfx::TextureAlpha::Translucent || s->premul == s->pixels) return false;
+        for (int y = 0; y < 5; ++y) {
+            for (int x = 0; x < 5; ++x) {
+                const std::size_t i = (std::size_t)y * s->stride + (std::size_t)x;
+                if (s->premul[i] != gfx::internal::premultiply(soft[(std::size_t)y * 5 + (std::size_t)x])) return false;
+            }
+        }
+        return true;
+    }
+
+    bool equal(const gfx::PixelCanvas& a, const gfx::PixelCanvas& b) {
+        const auto pa = a.pixels();
+        const auto pb = b.pixels();
+        for (std::size_t i = 0; i < pa.size(); ++i) {
+            if (pa[i] != pb[i]) {
+                std::printf("texture: mismatch at (%zu,%zu)\n", i % kW, i / kW);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief 텍스처로 그린 결과 == 원본 픽셀로 그린 결과 (원본은 등록 뒤에 바꿔도 무관)
+    bool check_render(bool premul) {
+        std::vector<std::uint32_t> a = make_image(12, 9, 7, true);
+        std::vector<std::uint32_t> b = make_image(7, 7, 8, false);
+        const std::vector<std::uint32_t> a0 = a, b0 = b;
+
+        gfx::TextureCache tc;
+        const gfx::TextureHandle ta = tc.add(a.data(), 12, 9, 12);
+        const gfx::TextureHandle tb = tc.add(b.data(), 7, 7, 7);
+        for (auto& p : a) p = 0;
+        for (auto& p : b) p = 0;
+
+        const gfx::ColorRGBA8 white{255, 255, 255, 255};
+        const gfx::ColorRGBA8 tint{220, 120, 255, 190};
+        const math::Mat3f m = math::make_affine_2d(math::Vec2f{60.0f, 20.0f}, 0.6f, math::Vec2f{2.0f, 1.5f});
+
+        gfx::DisplayList list;
+        list.blit_texture(0, 0, tc, tb, white);
+
+        gfx::RenderQueue qt, qs;
+        for (gfx::RenderQueue* q : {&qt, &qs}) {
+            q->begin_frame();
+            q->clear(gfx::ColorRGBA8{30, 60, 90, 255});
+        }
+        if (!qt.blit_texture(-3, 5, tc, ta, white) || !qt.blit_texture(20, 30, tc, ta, tint)
+            || !qt.blit_texture(40, 2, tc, tb, white) || !qt.blit_texture(30, 40, tc, tb, tint)
+            || !qt.blit_texture_affine(m, tc, ta, tint, gfx::SampleFilter::Bilinear)
+            || !qt.draw_list(list, 80, 50)) return false;
+
+        qs.blit_sprite(-3, 5, a0.data(), 12, 9, 12, white);
+        qs.blit_sprite(20, 30, a0.data(), 12, 9, 12, tint);
+        qs.blit_sprite(40, 2, b0.data(), 7, 7, 7, white);
+        qs.blit_sprite(30, 40, b0.data(), 7, 7, 7, tint);
+        qs.blit_sprite_affine(m, a0.data(), 12, 9, 12, tint, gfx::SampleFilter::Bilinear);
+        qs.blit_sprite(80, 50, b0.data(), 7, 7, 7, white);
+
+        gfx::PixelCanvas ct(kW, kH), cs(kW, kH);
+        if (premul) {
+            ct.set_format(gfx::PixelFormat::RGBA8888Premul);
+            cs.set_format(gfx::PixelFormat::RGBA8888Premul);
+        }
+        gfx::SoftwareRenderer r;
+        r.execute(qt, ct);
+        r.execute(qs, cs);
+        if (!equal(ct, cs)) return false;
+
+        // 없는 handle은 기록되지 않는다
+        tc.remove(tb);
+        return !qt.blit_texture(0, 0, tc, tb, white) && r.sprite_cache_size() == 2;   // qs의 원본 포인터 2개만
+    }
+
+    /// @brief update()로 내용만 바뀌면 (주소 같음) dirty 추적이 그 타일을 다시 그린다
+    bool check_update() {
+        gfx::TextureCache tc;
+        const std::vector<std::uint32_t> a = make_image(8, 8, 3, false);
+        const std::vector<std::uint32_t> b = make_image(8, 8, 4, false);
+        const gfx::TextureHandle t = tc.add(a.data(), 8, 8, 8);
+
+        gfx::RenderQueue q;
+        gfx::PixelCanvas c(kW, kH);
+        gfx::SoftwareRenderer r;
+        r.set_dirty_tracking(true);
+
+        auto frame = [&]() {
+            q.begin_frame();
+            q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+            q.blit_texture(4, 4, tc, t, gfx::ColorRGBA8{255, 255, 255, 255});
+            r.execute(q, c);
+        };
+        frame();
+        frame();
+        if (r.stats().dirty_tiles != 0) return false;
+
+        const gfx::Texture* before = tc.get(t);
+        if (!tc.update(t, b.data(), 8) || tc.get(t) != before) return false;
+        frame();
+        return r.stats().dirty_tiles == 1 && c.pixels()[(std::size_t)4 * kW + 4] == b[0];
+    }
+
+} // namespace
+
+int main() {
+    if (!check_packing()) return 1;
+    if (!check_classify()) return 1;
+    if (!check_render(false) || !check_render(true)) return 1;
+    if (!check_update()) return 1;
+    return 0;
+}
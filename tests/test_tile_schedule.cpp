@@ -0,0 +1,216 @@
+// tests/test_tile_schedule.cpp
+// 타일 크기/job 배치: 고정 크기(8..256)와 자동 크기, 순차/병렬, 합친 타일과 띠로 나눈 타일이 모두 같은 픽셀인지,
+// 자동 크기가 bin 밀도와 워커 수를 따르는지, dirty 추적 중에는 크기가 유지되는지 확인한다.
+#include <framedot/gfx/DisplayList.hpp>
+#include <framedot/gfx/RenderQueue.hpp>
+#include <framedot/gfx/SoftwareRenderer.hpp>
+#include <framedot/math/Types.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    constexpr int kW = 230, kH = 150;
+
+    struct Assets {
+        std::vector<std::uint32_t> sprite;
+        std::vector<gfx::Instance> inst;
+        gfx::DisplayList list;
+    };
+
+    Assets make_assets() {
+        Assets a;
+        a.sprite.resize(24 * 24);
+        for (std::size_t i = 0; i < a.sprite.size(); ++i) {
+            const std::uint32_t v = (std::uint32_t)i * 2654435761u;
+            a.sprite[i] = (v & 0xFFFFFF00u) | ((i % 5 == 0) ? 0x60u : 0xFFu);
+        }
+        for (int i = 0; i < 60; ++i) {
+            a.inst.push_back(gfx::Instance{(i * 37) % 240 - 8, (i * 23) % 160 - 6,
+                                           gfx::ColorRGBA8{(std::uint8_t)(i * 4), 90, 200, 170}});
+        }
+        a.list.fill_rect(0, 0, 30, 12, gfx::ColorRGBA8{20, 220, 90, 200});
+        a.list.line(0, 12, 30, 0, gfx::ColorRGBA8{255, 255, 255, 255});
+        a.list.text(2, 2, "HUD", gfx::ColorRGBA8{0, 0, 0, 255});
+        return a;
+    }
+
+    /// @brief 왼쪽 위 한 곳에 비싼 커맨드가 몰리고 나머지는 드문 장면
+    void record(gfx::RenderQueue& q, const Assets& a) {
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{16, 32, 48, 255});
+
+        const math::Mat3f m = math::make_affine_2d(math::Vec2f{30.0f, 30.0f}, 0.4f, math::Vec2f{2.5f, 2.5f});
+        for (int i = 0; i < 12; ++i) {
+            q.blit_sprite_affine(m, a.sprite.data(), 24, 24, 24, gfx::ColorRGBA8{255, 255, 255, (std::uint8_t)(120 + i)},
+                                 gfx::SampleFilter::Bilinear);
+        }
+        for (int i = 0; i < 30; ++i) q.blend_rect(4 + i, 6 + i / 2, 40, 30, gfx::ColorRGBA8{200, 100, 30, 60});
+
+        for (int i = 0; i < 8; ++i) q.fill_rect(120 + i * 12, 100 + (i % 3) * 9, 6, 5, gfx::ColorRGBA8{255, 255, 0, 255});
+        q.blit_sprite(150, 20, a.sprite.data(), 24, 24, 24, gfx::ColorRGBA8{255, 255, 255, 255});
+        q.fill_rect_instanced(a.inst, 7, 5, gfx::ColorRGBA8{}, true);
+        q.line(-20, 140, 250, 3, gfx::ColorRGBA8{240, 240, 240, 180});
+        q.circle(170, 90, 50, gfx::ColorRGBA8{90, 255, 255, 255});
+        q.fill_circle(60, 120, 22, gfx::ColorRGBA8{255, 60, 160, 140});
+        q.fill_triangle(100, 10, 220, 60, 130, 140, gfx::ColorRGBA8{60, 60, 255, 90});
+        q.text(10, 135, "TILES", gfx::ColorRGBA8{255, 255, 255, 255});
+        {
+            gfx::ClipScope clip(q, gfx::RectI{100, 40, 200, 110});
+            q.blend_rect(80, 30, 140, 90, gfx::ColorRGBA8{0, 0, 0, 100});
+        }
+        q.draw_list(a.list, 190, 130);
+    }
+
+    bool equal(const char* name, int tile, const gfx::PixelCanvas& a, const gfx::PixelCanvas& b) {
+        const auto pa = a.pixels();
+        const auto pb = b.pixels();
+        for (std::size_t i = 0; i < pa.size(); ++i) {
+            if (pa[i] != pb[i]) {
+                std::printf("%s(tile %d): mismatch at (%zu,%zu)\n", name, tile, i % kW, i / kW);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief 모든 타일 크기 x 순차/병렬 == 32px 순차
+    bool check_sizes(core::JobSystem* js, bool premul) {
+        const Assets a = make_assets();
+        gfx::RenderQueue q;
+        record(q, a);
+
+        auto canvas = [&]() {
+            gfx::PixelCanvas c(kW, kH);
+            if (premul) c.set_format(gfx::PixelFormat::RGBA8888Premul);
+            return c;
+        };
+
+        gfx::PixelCanvas ref = canvas();
+        gfx::SoftwareRenderer rr;
+        rr.set_tile_size(gfx::SoftwareRenderer::kTile);
+        rr.execute(q, ref);
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        for (const int tile : {0, 8, 16, 24, 32, 64, 100, 256}) {
+            gfx::SoftwareRenderer r;
+            r.set_tile_size(tile);
+
+            gfx::PixelCanvas serial = canvas(), parallel = canvas();
+            r.execute(q, serial);
+            if (r.stats().jobs != 0) return false;
+            r.execute(ctx, q, parallel);
+            if (!equal("serial", tile, ref, serial) || !equal("parallel", tile, ref, parallel)) return false;
+
+            const auto& st = r.stats();
+            if (tile != 0 && st.tile_size != (std::uint32_t)tile) return false;
+            if (st.dirty_tiles == 0 || (st.tiles >= 2 && st.jobs == 0)) return false;   // 256: 타일 하나는 순차
+        }
+        return true;
+    }
+
+    /// @brief 비싼 타일은 띠로 나뉘고, 싼 타일은 합쳐져 job 수가 그린 타일 수보다 적다
+    bool check_balance(core::JobSystem* js) {
+        const Assets a = make_assets();
+        gfx::RenderQueue q;
+        record(q, a);
+
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::SoftwareRenderer r;
+        r.set_tile_size(64);
+        gfx::PixelCanvas c(kW, kH);
+        r.execute(ctx, q, c);
+        const auto& st = r.stats();
+        if (st.split_tiles == 0) {
+            std::printf("balance: no split tiles (jobs=%u)\n", st.jobs);
+            return false;
+        }
+
+        // 비용이 고른 작은 타일들은 합쳐진다
+        gfx::RenderQueue sparse;
+        sparse.begin_frame();
+        sparse.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        gfx::SoftwareRenderer rs;
+        rs.set_tile_size(16);
+        rs.execute(ctx, sparse, c);
+        return rs.stats().jobs < rs.stats().dirty_tiles && rs.stats().split_tiles == 0;
+    }
+
+    /// @brief 자동 크기: 워커가 많으면 타일 수를 늘리고, bin이 빽빽하면 다음 프레임에 타일을 줄인다
+    bool check_auto(core::JobSystem* js) {
+        gfx::RenderQueue q;
+        auto dense = [&]() {
+            q.begin_frame();
+            q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+            for (int i = 0; i < 4000; ++i) q.fill_rect((i * 13) % kW, (i * 7) % kH, 3, 3, gfx::ColorRGBA8{255, 0, 0, 255});
+        };
+
+        gfx::SoftwareRenderer r;
+        gfx::PixelCanvas c(kW, kH), ref(kW, kH);
+        dense();
+        r.execute(q, c);
+        if (r.stats().tile_size != 64) return false;   // 밀도를 모르는 첫 프레임 (순차)
+        r.execute(q, c);
+        if (r.stats().tile_size >= 64) return false;
+
+        gfx::SoftwareRenderer rr;
+        rr.set_tile_size(gfx::SoftwareRenderer::kTile);
+        rr.execute(q, ref);
+        if (!equal("auto", (int)r.stats().tile_size, ref, c)) return false;
+
+        // 워커가 있으면 드문 장면이어도 타일이 워커 수보다 충분히 많다
+        q.begin_frame();
+        q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+        core::FrameContext ctx{};
+        ctx.jobs = js;
+        gfx::SoftwareRenderer rp;
+        rp.execute(ctx, q, c);
+        return rp.stats().tile_size < 64 && rp.stats().tiles >= 4u * js->worker_count();
+    }
+
+    /// @brief dirty 추적 중에는 밀도가 바뀌어도 타일 격자를 유지한다 (signature 재사용)
+    bool check_tracking() {
+        gfx::RenderQueue q;
+        gfx::SoftwareRenderer r, rf;
+        r.set_dirty_tracking(true);
+        gfx::PixelCanvas c(kW, kH), full(kW, kH);
+
+        std::uint32_t size = 0;
+        for (int f = 0; f < 4; ++f) {
+            q.begin_frame();
+            q.clear(gfx::ColorRGBA8{0, 0, 0, 255});
+            const int n = (f >= 2) ? 4000 : 10;
+            for (int i = 0; i < n; ++i) q.fill_rect((i * 13) % kW, (i * 7) % kH, 3, 3, gfx::ColorRGBA8{255, 0, 0, 255});
+            r.execute(q, c);
+            rf.execute(q, full);
+            if (!equal("tracking", (int)r.stats().tile_size, full, c)) return false;
+
+            if (f == 0) size = r.stats().tile_size;
+            if (r.stats().tile_size != size) return false;
+            if (f == 1 && r.stats().dirty_tiles != 0) return false;
+            if (f == 3 && r.stats().dirty_tiles != 0) return false;
+        }
+
+        // 고정 크기를 바꾸면 전체를 다시 그린다
+        r.set_tile_size(16);
+        r.execute(q, c);
+        return r.stats().tile_size == 16 && r.stats().clean_tiles == 0 && equal("tracking", 16, full, c);
+    }
+
+} // namespace
+
+int main() {
+    if (!check_tracking()) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_sizes(js, false) && check_sizes(js, true) && check_balance(js) && check_auto(js);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+// tests/test_transform_hierarchy.cpp
+// TransformHierarchy2D: 부모 world * 로컬 전파, 바뀌지 않은 서브트리의 재계산 생략,
+// 형제 child 파괴/Parent2D 제거 뒤에도 나머지 형제가 갱신되는지, level 병렬 결과가 순차와 같은지 확인한다.
+#include <framedot/ecs/Fecs.hpp>
+#include <framedot_internal/core/DefaultJobSystem.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace framedot;
+
+namespace {
+
+    using ecs::systems::attach_child;
+
+    fecs::Transform2D tr(float x, float y, float rot = 0.0f, float s = 1.0f) {
+        fecs::Transform2D t{};
+        t.position = math::Vec2f{x, y};
+        t.rotation_rad = rot;
+        t.scale = math::Vec2f{s, s};
+        return t;
+    }
+
+    math::Mat3f local_of(const fecs::Registry& reg, fecs::Entity e) {
+        const auto& t = reg.get<fecs::Transform2D>(e);
+        return math::make_affine_2d(t.position, t.rotation_rad, t.scale);
+    }
+
+    bool same(const math::Mat3f& a, const math::Mat3f& b) {
+        return std::memcmp(a.m, b.m, sizeof(a.m)) == 0;
+    }
+
+    /// @brief e의 world == 부모 world * 로컬 (부모가 없으면 로컬)
+    bool composed(const fecs::Registry& reg, fecs::Entity e, fecs::Entity parent, const char* name) {
+        const math::Mat3f want = (parent != fecs::null)
+            ? math::mul_affine(reg.get<fecs::WorldTransform2D>(parent).world, local_of(reg, e))
+            : local_of(reg, e);
+        if (!same(reg.get<fecs::WorldTransform2D>(e).world, want)) {
+            std::printf("%s: world mismatch\n", name);
+            return false;
+        }
+        return true;
+    }
+
+    std::uint32_t rev(const fecs::Registry& reg, fecs::Entity e) {
+        return reg.get<fecs::WorldTransform2D>(e).revision;
+    }
+
+    fecs::Entity make(fecs::Registry& reg, const fecs::Transform2D& t) {
+        const auto e = reg.create();
+        reg.emplace<fecs::Transform2D>(e, t);
+        reg.emplace<fecs::WorldTransform2D>(e);
+        return e;
+    }
+
+    /// @brief 전파 + dirty 생략
+    bool check_propagation() {
+        fecs::World world;
+        fecs::systems::install_transform_hierarchy_2d(world);
+        auto& reg = world.registry();
+        core::FrameContext ctx{};
+
+        const auto root = make(reg, tr(100.0f, 50.0f, 0.5f, 2.0f));
+        const auto a = make(reg, tr(10.0f, 0.0f));
+        const auto b = make(reg, tr(0.0f, 10.0f, 0.25f));
+        const auto g = make(reg, tr(3.0f, 4.0f, 0.0f, 0.5f));
+        if (!attach_child(reg, root, a) || !attach_child(reg, root, b) || !attach_child(reg, b, g)) return false;
+        if (attach_child(reg, g, root)) return false;   // 순환 거부
+
+        world.tick(ctx);
+        if (!composed(reg, root, fecs::null, "root") || !composed(reg, a, root, "a")
+            || !composed(reg, b, root, "b") || !composed(reg, g, b, "g")) return false;
+
+        // 아무것도 안 바뀌면 재계산하지 않는다
+        const std::uint32_t r0 = rev(reg, root), ra = rev(reg, a), rb = rev(reg, b), rg = rev(reg, g);
+        world.tick(ctx);
+        if (rev(reg, root) != r0 || rev(reg, a) != ra || rev(reg, b) != rb || rev(reg, g) != rg) {
+            std::printf("propagation: clean tree recomputed\n");
+            return false;
+        }
+
+        // b만 바꾸면 b와 그 아래만 다시 계산
+        reg.get<fecs::Transform2D>(b).position.x = 7.0f;
+        world.tick(ctx);
+        if (rev(reg, root) != r0 || rev(reg, a) != ra || rev(reg, b) == rb || rev(reg, g) == rg) {
+            std::printf("propagation: dirty subtree not isolated\n");
+            return false;
+        }
+        if (!composed(reg, b, root, "b'") || !composed(reg, g, b, "g'")) return false;
+
+        // 루트를 바꾸면 전체가 따라온다
+        reg.get<fecs::Transform2D>(root).rotation_rad = -1.0f;
+        world.tick(ctx);
+        return composed(reg, a, root, "a''") && composed(reg, b, root, "b''") && composed(reg, g, b, "g''");
+    }
+
+    /// @brief 형제 중간/첫 child 파괴, Parent2D 직접 제거 뒤에도 남은 형제가 갱신된다
+    bool check_destroy() {
+        fecs::World world;
+        fecs::systems::install_transform_hierarchy_2d(world);
+        auto& reg = world.registry();
+        core::FrameContext ctx{};
+
+        const auto root = make(reg, tr(0.0f, 0.0f));
+        std::vector<fecs::Entity> kids;
+        for (int i = 0; i < 5; ++i) {
+            kids.push_back(make(reg, tr((float)i, 1.0f)));
+            attach_child(reg, root, kids.back());
+        }
+        const auto grand = make(reg, tr(2.0f, 2.0f));
+        attach_child(reg, kids[2], grand);
+        world.tick(ctx);
+
+        // 목록 순서: 4 3 2 1 0 (앞에 붙인다). 중간(2)과 첫 child(4) 파괴
+        reg.destroy(kids[2]);
+        reg.destroy(kids[4]);
+        if (reg.get<fecs::Children2D>(root).count != 3) {
+            std::printf("destroy: count %u\n", reg.get<fecs::Children2D>(root).count);
+            return false;
+        }
+
+        reg.get<fecs::Transform2D>(root).position = math::Vec2f{40.0f, -5.0f};
+        world.tick(ctx);
+        for (const int i : {0, 1, 3}) {
+            if (!composed(reg, kids[(std::size_t)i], root, "destroy: sibling")) return false;
+        }
+        // 부모가 사라진 손자는 루트로 취급된다
+        if (!composed(reg, grand, fecs::null, "destroy: orphan")) return false;
+
+        // Parent2D 직접 제거도 같은 복구를 거친다
+        reg.remove<fecs::Parent2D>(kids[1]);
+        reg.get<fecs::Transform2D>(root).position = math::Vec2f{-8.0f, 3.0f};
+        world.tick(ctx);
+        if (reg.get<fecs::Children2D>(root).count != 2) return false;
+        if (!composed(reg, kids[3], root, "remove: sibling") || !composed(reg, kids[0], root, "remove: sibling")) return false;
+
+        // 재부착: 분리 후 다른 부모에 붙은 child는 새 부모를 따른다
+        attach_child(reg, kids[1], kids[3]);
+        world.tick(ctx);
+        return reg.get<fecs::Children2D>(root).count == 1 && composed(reg, kids[0], root, "reparent: root child")
+            && composed(reg, kids[3], kids[1], "reparent: moved");
+    }
+
+    /// @brief 넓은 level(워커 분할) 결과 == 순차 결과
+    bool check_parallel(core::JobSystem* js) {
+        auto build = [](fecs::World& world, std::vector<fecs::Entity>& all) {
+            fecs::systems::install_transform_hierarchy_2d(world);
+            auto& reg = world.registry();
+            const auto root = make(reg, tr(5.0f, 5.0f, 0.1f));
+            all.push_back(root);
+            for (int i = 0; i < 1500; ++i) {
+                const auto c = make(reg, tr((float)(i % 37), (float)(i % 11), 0.01f * (float)i));
+                attach_child(reg, root, c);
+                all.push_back(c);
+                if (i % 3 == 0) {
+                    const auto g = make(reg, tr(1.0f, 2.0f, 0.0f, 0.75f));
+                    attach_child(reg, c, g);
+                    all.push_back(g);
+                }
+            }
+        };
+
+        fecs::World ws, wp;
+        std::vector<fecs::Entity> es, ep;
+        build(ws, es);
+        build(wp, ep);
+
+        core::FrameContext serial{}, parallel{};
+        parallel.jobs = js;
+        for (int f = 0; f < 3; ++f) {
+            ws.registry().get<fecs::Transform2D>(es[0]).rotation_rad = 0.3f * (float)f;
+            wp.registry().get<fecs::Transform2D>(ep[0]).rotation_rad = 0.3f * (float)f;
+            ws.tick(serial);
+            wp.tick(parallel);
+            for (std::size_t i = 0; i < es.size(); ++i) {
+                if (!same(ws.registry().get<fecs::WorldTransform2D>(es[i]).world,
+                          wp.registry().get<fecs::WorldTransform2D>(ep[i]).world)) {
+                    std::printf("parallel: mismatch at %zu (frame %d)\n", i, f);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+int main() {
+    if (!check_propagation() || !check_destroy()) return 1;
+
+    core::JobSystem* js = core::internal::create_default_jobsystem(4);
+    const bool ok = check_parallel(js);
+    core::internal::destroy_default_jobsystem(js);
+    return ok ? 0 : 1;
+}